@@ -0,0 +1,102 @@
+#include <chrono>
+#include <iomanip>
+
+#include "BenchmarkRunner.h"
+using namespace urchin;
+
+//static
+const float BenchmarkRunner::TIME_STEP = 1.0f / 60.0f;
+const std::vector<std::string> BenchmarkRunner::STAGE_PROFILER_NAMES = {"setupWorkBodies", "coOverlapPair", "integVelocity",
+		"narrowPhase", "solveConstraint", "refreshBodyStat", "integTransform", "applyWorkBodies"};
+
+/**
+ * @param overriddenNumberOfSteps Number of steps to simulate for each scenario (0 to use the scenario number of steps)
+ */
+BenchmarkRunner::BenchmarkRunner(unsigned int overriddenNumberOfSteps) :
+		overriddenNumberOfSteps(overriddenNumberOfSteps)
+{
+
+}
+
+BenchmarkResult BenchmarkRunner::run(const BenchmarkScenario &scenario) const
+{
+	const Vector3<float> gravity(0.0f, -9.81f, 0.0f);
+	unsigned int numberOfSteps = overriddenNumberOfSteps==0 ? scenario.getNumberOfSteps() : overriddenNumberOfSteps;
+
+	auto *bodyManager = new BodyManager();
+	scenario.createBodies(bodyManager);
+	auto *collisionWorld = new CollisionWorld(bodyManager);
+
+	//first step creates the work bodies and fills the broad phase: not measured
+	collisionWorld->process(TIME_STEP, gravity);
+
+	std::vector<double> startStagesTime, endStagesTime;
+	retrieveStagesTime(startStagesTime);
+
+	unsigned long totalPairs = 0;
+	unsigned long totalContacts = 0;
+	auto startTime = std::chrono::steady_clock::now();
+	for(unsigned int step=0; step<numberOfSteps; ++step)
+	{
+		collisionWorld->process(TIME_STEP, gravity);
+
+		const std::vector<ManifoldResult> &manifoldResults = collisionWorld->getLastUpdatedManifoldResults();
+		totalPairs += manifoldResults.size();
+		for(const auto &manifoldResult : manifoldResults)
+		{
+			totalContacts += manifoldResult.getNumContactPoints();
+		}
+	}
+	auto endTime = std::chrono::steady_clock::now();
+
+	retrieveStagesTime(endStagesTime);
+
+	BenchmarkResult result;
+	result.scenarioName = scenario.getName();
+	result.numberOfBodies = static_cast<unsigned int>(bodyManager->getWorkBodies().size());
+	result.numberOfSteps = numberOfSteps;
+	result.totalTimeMs = std::chrono::duration<double, std::milli>(endTime - startTime).count();
+	result.stepsPerSecond = result.totalTimeMs > 0.0 ? (numberOfSteps * 1000.0) / result.totalTimeMs : 0.0;
+	result.averagePairs = static_cast<double>(totalPairs) / numberOfSteps;
+	result.averageContacts = static_cast<double>(totalContacts) / numberOfSteps;
+	for(std::size_t i=0; i<STAGE_PROFILER_NAMES.size(); ++i)
+	{
+		result.stagesAverageTimeMs.emplace_back(STAGE_PROFILER_NAMES[i], (endStagesTime[i] - startStagesTime[i]) / numberOfSteps);
+	}
+
+	delete collisionWorld;
+	delete bodyManager;
+
+	return result;
+}
+
+/**
+ * @param stagesTime [out] Total time in milliseconds spent in each stage since the beginning of the program
+ */
+void BenchmarkRunner::retrieveStagesTime(std::vector<double> &stagesTime)
+{
+	std::shared_ptr<Profiler> profiler = Profiler::getInstance("physics");
+	for(const auto &stageProfilerName : STAGE_PROFILER_NAMES)
+	{
+		const ProfilerNode *profilerNode = profiler->findNode(stageProfilerName);
+		stagesTime.push_back(profilerNode ? profilerNode->getTotalTime() : 0.0);
+	}
+}
+
+void BenchmarkRunner::writeResult(const BenchmarkResult &result, std::ostream &stream)
+{
+	stream << std::fixed << std::setprecision(4);
+	stream << "{\"scenario\":\"" << result.scenarioName << "\"";
+	stream << ",\"bodies\":" << result.numberOfBodies;
+	stream << ",\"steps\":" << result.numberOfSteps;
+	stream << ",\"totalTimeMs\":" << result.totalTimeMs;
+	stream << ",\"stepsPerSecond\":" << result.stepsPerSecond;
+	stream << ",\"averagePairs\":" << result.averagePairs;
+	stream << ",\"averageContacts\":" << result.averageContacts;
+	stream << ",\"stagesAverageTimeMs\":{";
+	for(std::size_t i=0; i<result.stagesAverageTimeMs.size(); ++i)
+	{
+		stream << (i==0 ? "" : ",") << "\"" << result.stagesAverageTimeMs[i].first << "\":" << result.stagesAverageTimeMs[i].second;
+	}
+	stream << "}}" << std::endl;
+}
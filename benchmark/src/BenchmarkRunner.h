@@ -0,0 +1,43 @@
+#ifndef URCHINENGINE_BENCHMARKRUNNER_H
+#define URCHINENGINE_BENCHMARKRUNNER_H
+
+#include <string>
+#include <vector>
+#include <ostream>
+
+#include "scenario/BenchmarkScenario.h"
+
+struct BenchmarkResult
+{
+	std::string scenarioName;
+	unsigned int numberOfBodies;
+	unsigned int numberOfSteps;
+	double totalTimeMs;
+	double stepsPerSecond;
+	double averagePairs;
+	double averageContacts;
+	std::vector<std::pair<std::string, double>> stagesAverageTimeMs;
+};
+
+/**
+* Run benchmark scenarios by driving directly the collision world (no physics thread) and write results in JSON lines
+* format: one JSON object by scenario.
+*/
+class BenchmarkRunner
+{
+	public:
+		explicit BenchmarkRunner(unsigned int);
+
+		BenchmarkResult run(const BenchmarkScenario &) const;
+		static void writeResult(const BenchmarkResult &, std::ostream &);
+
+	private:
+		static const float TIME_STEP;
+		static const std::vector<std::string> STAGE_PROFILER_NAMES;
+
+		static void retrieveStagesTime(std::vector<double> &);
+
+		unsigned int overriddenNumberOfSteps;
+};
+
+#endif
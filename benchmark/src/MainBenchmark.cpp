@@ -0,0 +1,76 @@
+#include <iostream>
+#include <memory>
+#include <vector>
+#include <string>
+#include <algorithm>
+#include "UrchinCommon.h"
+
+#include "BenchmarkRunner.h"
+#include "scenario/BoxStackScenario.h"
+#include "scenario/CubePyramidScenario.h"
+#include "scenario/HeightfieldScenario.h"
+#include "scenario/CompoundShapeScenario.h"
+#include "scenario/CcdBulletScenario.h"
+
+/**
+ * Usage: physicsBenchmark [-s <numberOfSteps>] [scenarioName...]
+ * Results are written on the standard output in JSON lines format. An unknown scenario name stops the benchmark with
+ * a non-zero exit code.
+ */
+int main(int argc, char *argv[])
+{
+	unsigned int numberOfSteps = 0;
+	std::vector<std::string> selectedScenarioNames;
+	for(int i=1; i<argc; ++i)
+	{
+		std::string argument(argv[i]);
+		if(argument=="-s" && i+1<argc)
+		{
+			numberOfSteps = static_cast<unsigned int>(std::stoul(argv[++i]));
+		}else
+		{
+			selectedScenarioNames.push_back(argument);
+		}
+	}
+
+	urchin::ConfigService::instance()->loadProperties("resources/engine.properties");
+
+	std::vector<std::unique_ptr<BenchmarkScenario>> scenarios;
+	scenarios.push_back(std::make_unique<BoxStackScenario>());
+	scenarios.push_back(std::make_unique<CubePyramidScenario>());
+	scenarios.push_back(std::make_unique<HeightfieldScenario>());
+	scenarios.push_back(std::make_unique<CompoundShapeScenario>());
+	scenarios.push_back(std::make_unique<CcdBulletScenario>());
+
+	for(const auto &selectedScenarioName : selectedScenarioNames)
+	{
+		bool isKnown = std::any_of(scenarios.begin(), scenarios.end(), [&](const auto &scenario) { return scenario->getName()==selectedScenarioName; });
+		if(!isKnown)
+		{
+			std::cerr << "Unknown scenario '" << selectedScenarioName << "'. Valid scenarios:";
+			for(const auto &scenario : scenarios)
+			{
+				std::cerr << " " << scenario->getName();
+			}
+			std::cerr << std::endl;
+
+			urchin::SingletonManager::destroyAllSingletons();
+			return 1;
+		}
+	}
+
+	BenchmarkRunner benchmarkRunner(numberOfSteps);
+	for(const auto &scenario : scenarios)
+	{
+		bool isSelected = selectedScenarioNames.empty()
+				|| std::find(selectedScenarioNames.begin(), selectedScenarioNames.end(), scenario->getName())!=selectedScenarioNames.end();
+		if(isSelected)
+		{
+			BenchmarkResult result = benchmarkRunner.run(*scenario);
+			BenchmarkRunner::writeResult(result, std::cout);
+		}
+	}
+
+	urchin::SingletonManager::destroyAllSingletons();
+	return 0;
+}
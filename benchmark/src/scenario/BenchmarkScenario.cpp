@@ -0,0 +1,31 @@
+#include <utility>
+
+#include "scenario/BenchmarkScenario.h"
+using namespace urchin;
+
+BenchmarkScenario::BenchmarkScenario(std::string name, unsigned int numberOfSteps) :
+		name(std::move(name)),
+		numberOfSteps(numberOfSteps)
+{
+
+}
+
+const std::string &BenchmarkScenario::getName() const
+{
+	return name;
+}
+
+unsigned int BenchmarkScenario::getNumberOfSteps() const
+{
+	return numberOfSteps;
+}
+
+/**
+ * @param mass Mass of the body (0 for a static body)
+ */
+RigidBody *BenchmarkScenario::createBody(const std::string &id, const Point3<float> &position, const std::shared_ptr<const CollisionShape3D> &shape, float mass)
+{
+	auto *body = new RigidBody(id, Transform<float>(position, Quaternion<float>(), 1.0f), shape);
+	body->setMass(mass);
+	return body;
+}
@@ -0,0 +1,31 @@
+#ifndef URCHINENGINE_BENCHMARKSCENARIO_H
+#define URCHINENGINE_BENCHMARKSCENARIO_H
+
+#include <string>
+#include <memory>
+#include "UrchinCommon.h"
+#include "UrchinPhysicsEngine.h"
+
+/**
+* Canned scenario of the physics benchmark: define the bodies of the world and the number of steps to simulate.
+*/
+class BenchmarkScenario
+{
+	public:
+		BenchmarkScenario(std::string, unsigned int);
+		virtual ~BenchmarkScenario() = default;
+
+		const std::string &getName() const;
+		unsigned int getNumberOfSteps() const;
+
+		virtual void createBodies(urchin::BodyManager *) const = 0;
+
+	protected:
+		static urchin::RigidBody *createBody(const std::string &, const urchin::Point3<float> &, const std::shared_ptr<const urchin::CollisionShape3D> &, float);
+
+	private:
+		std::string name;
+		unsigned int numberOfSteps;
+};
+
+#endif
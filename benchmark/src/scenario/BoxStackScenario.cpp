@@ -0,0 +1,28 @@
+#include "scenario/BoxStackScenario.h"
+using namespace urchin;
+
+BoxStackScenario::BoxStackScenario() :
+		BenchmarkScenario("boxStack", 300)
+{
+
+}
+
+void BoxStackScenario::createBodies(BodyManager *bodyManager) const
+{
+	const unsigned int numberOfStacks = 8;
+	const unsigned int stackHeight = 12;
+
+	auto groundShape = std::make_shared<CollisionBoxShape>(Vector3<float>(50.0f, 0.5f, 50.0f));
+	bodyManager->addBody(createBody("ground", Point3<float>(0.0f, -0.5f, 0.0f), groundShape, 0.0f));
+
+	auto boxShape = std::make_shared<CollisionBoxShape>(Vector3<float>(0.5f, 0.5f, 0.5f));
+	for(unsigned int stackIndex=0; stackIndex<numberOfStacks; ++stackIndex)
+	{
+		for(unsigned int level=0; level<stackHeight; ++level)
+		{
+			Point3<float> position(static_cast<float>(stackIndex) * 3.0f - 10.0f, static_cast<float>(level) * 1.01f + 0.5f, 0.0f);
+			std::string id = "box_" + std::to_string(stackIndex) + "_" + std::to_string(level);
+			bodyManager->addBody(createBody(id, position, boxShape, 1.0f));
+		}
+	}
+}
@@ -0,0 +1,17 @@
+#ifndef URCHINENGINE_BOXSTACKSCENARIO_H
+#define URCHINENGINE_BOXSTACKSCENARIO_H
+
+#include "scenario/BenchmarkScenario.h"
+
+/**
+* Stacks of boxes resting on a static ground: stresses the constraint solver with deep contact chains.
+*/
+class BoxStackScenario : public BenchmarkScenario
+{
+	public:
+		BoxStackScenario();
+
+		void createBodies(urchin::BodyManager *) const override;
+};
+
+#endif
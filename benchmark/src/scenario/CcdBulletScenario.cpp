@@ -0,0 +1,31 @@
+#include "scenario/CcdBulletScenario.h"
+using namespace urchin;
+
+CcdBulletScenario::CcdBulletScenario() :
+		BenchmarkScenario("ccdBullet", 300)
+{
+
+}
+
+void CcdBulletScenario::createBodies(BodyManager *bodyManager) const
+{
+	const float bulletSpeed = 300.0f; //units/s: 5 units by step at 60Hz
+	const float bulletMass = 0.1f;
+
+	auto groundShape = std::make_shared<CollisionBoxShape>(Vector3<float>(50.0f, 0.5f, 50.0f));
+	bodyManager->addBody(createBody("ground", Point3<float>(0.0f, -0.5f, 0.0f), groundShape, 0.0f));
+	auto wallShape = std::make_shared<CollisionBoxShape>(Vector3<float>(0.1f, 10.0f, 20.0f));
+	bodyManager->addBody(createBody("wall", Point3<float>(20.0f, 10.0f, 0.0f), wallShape, 0.0f));
+
+	auto bulletShape = std::make_shared<CollisionSphereShape>(0.05f);
+	for(unsigned int y=0; y<10; ++y)
+	{
+		for(unsigned int z=0; z<10; ++z)
+		{
+			Point3<float> position(-20.0f, static_cast<float>(y) * 1.5f + 2.0f, static_cast<float>(z) * 3.0f - 15.0f);
+			RigidBody *bullet = createBody("bullet_" + std::to_string(y) + "_" + std::to_string(z), position, bulletShape, bulletMass);
+			bullet->applyCentralMomentum(Vector3<float>(bulletSpeed * bulletMass, 0.0f, 0.0f));
+			bodyManager->addBody(bullet);
+		}
+	}
+}
@@ -0,0 +1,17 @@
+#ifndef URCHINENGINE_CCDBULLETSCENARIO_H
+#define URCHINENGINE_CCDBULLETSCENARIO_H
+
+#include "scenario/BenchmarkScenario.h"
+
+/**
+* Small and fast spheres shot against a thin wall: stresses the continuous collision detection.
+*/
+class CcdBulletScenario : public BenchmarkScenario
+{
+	public:
+		CcdBulletScenario();
+
+		void createBodies(urchin::BodyManager *) const override;
+};
+
+#endif
@@ -0,0 +1,42 @@
+#include "scenario/CompoundShapeScenario.h"
+using namespace urchin;
+
+CompoundShapeScenario::CompoundShapeScenario() :
+		BenchmarkScenario("compoundShape", 300)
+{
+
+}
+
+void CompoundShapeScenario::createBodies(BodyManager *bodyManager) const
+{
+	auto groundShape = std::make_shared<CollisionBoxShape>(Vector3<float>(50.0f, 0.5f, 50.0f));
+	bodyManager->addBody(createBody("ground", Point3<float>(0.0f, -0.5f, 0.0f), groundShape, 0.0f));
+
+	//dumbbell: two spheres linked by a box
+	std::vector<std::shared_ptr<const LocalizedCollisionShape>> localizedShapes;
+	const Point3<float> childPositions[3] = {Point3<float>(-1.0f, 0.0f, 0.0f), Point3<float>(0.0f, 0.0f, 0.0f), Point3<float>(1.0f, 0.0f, 0.0f)};
+	for(std::size_t i=0; i<3; ++i)
+	{
+		auto localizedShape = std::make_shared<LocalizedCollisionShape>();
+		localizedShape->position = i;
+		if(i==1)
+		{
+			localizedShape->shape = std::make_shared<CollisionBoxShape>(Vector3<float>(0.6f, 0.15f, 0.15f));
+		}else
+		{
+			localizedShape->shape = std::make_shared<CollisionSphereShape>(0.4f);
+		}
+		localizedShape->transform = PhysicsTransform(childPositions[i], Quaternion<float>());
+		localizedShapes.push_back(localizedShape);
+	}
+	auto compoundShape = std::make_shared<CollisionCompoundShape>(localizedShapes);
+
+	for(unsigned int x=0; x<10; ++x)
+	{
+		for(unsigned int level=0; level<10; ++level)
+		{
+			Point3<float> position(static_cast<float>(x) * 3.5f - 16.0f, static_cast<float>(level) * 1.2f + 1.0f, static_cast<float>(level % 2) * 0.3f);
+			bodyManager->addBody(createBody("compound_" + std::to_string(x) + "_" + std::to_string(level), position, compoundShape, 1.0f));
+		}
+	}
+}
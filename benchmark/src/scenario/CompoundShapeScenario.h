@@ -0,0 +1,17 @@
+#ifndef URCHINENGINE_COMPOUNDSHAPESCENARIO_H
+#define URCHINENGINE_COMPOUNDSHAPESCENARIO_H
+
+#include "scenario/BenchmarkScenario.h"
+
+/**
+* Bodies made of several convex shapes falling on a static ground: stresses the compound shape collision algorithm.
+*/
+class CompoundShapeScenario : public BenchmarkScenario
+{
+	public:
+		CompoundShapeScenario();
+
+		void createBodies(urchin::BodyManager *) const override;
+};
+
+#endif
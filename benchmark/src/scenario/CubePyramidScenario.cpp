@@ -0,0 +1,33 @@
+#include "scenario/CubePyramidScenario.h"
+using namespace urchin;
+
+CubePyramidScenario::CubePyramidScenario() :
+		BenchmarkScenario("cubePyramid", 200)
+{
+
+}
+
+void CubePyramidScenario::createBodies(BodyManager *bodyManager) const
+{
+	const unsigned int numberOfCubes = 1000;
+	const unsigned int baseSize = 14; //sum of squares until 14 is greater than 1000
+
+	auto groundShape = std::make_shared<CollisionBoxShape>(Vector3<float>(50.0f, 0.5f, 50.0f));
+	bodyManager->addBody(createBody("ground", Point3<float>(0.0f, -0.5f, 0.0f), groundShape, 0.0f));
+
+	auto cubeShape = std::make_shared<CollisionBoxShape>(Vector3<float>(0.5f, 0.5f, 0.5f));
+	unsigned int cubeIndex = 0;
+	for(unsigned int level=0; level<baseSize && cubeIndex<numberOfCubes; ++level)
+	{
+		unsigned int levelSize = baseSize - level;
+		float levelOffset = static_cast<float>(level) * 0.5f;
+		for(unsigned int x=0; x<levelSize && cubeIndex<numberOfCubes; ++x)
+		{
+			for(unsigned int z=0; z<levelSize && cubeIndex<numberOfCubes; ++z)
+			{
+				Point3<float> position(static_cast<float>(x) + levelOffset, static_cast<float>(level) * 1.01f + 0.5f, static_cast<float>(z) + levelOffset);
+				bodyManager->addBody(createBody("cube_" + std::to_string(cubeIndex++), position, cubeShape, 1.0f));
+			}
+		}
+	}
+}
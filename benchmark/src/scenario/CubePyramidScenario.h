@@ -0,0 +1,17 @@
+#ifndef URCHINENGINE_CUBEPYRAMIDSCENARIO_H
+#define URCHINENGINE_CUBEPYRAMIDSCENARIO_H
+
+#include "scenario/BenchmarkScenario.h"
+
+/**
+* Square based pyramid of 1000 cubes: stresses all stages with a large number of resting contacts.
+*/
+class CubePyramidScenario : public BenchmarkScenario
+{
+	public:
+		CubePyramidScenario();
+
+		void createBodies(urchin::BodyManager *) const override;
+};
+
+#endif
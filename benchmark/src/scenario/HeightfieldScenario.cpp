@@ -0,0 +1,41 @@
+#include <cmath>
+
+#include "scenario/HeightfieldScenario.h"
+using namespace urchin;
+
+HeightfieldScenario::HeightfieldScenario() :
+		BenchmarkScenario("heightfield", 300)
+{
+
+}
+
+void HeightfieldScenario::createBodies(BodyManager *bodyManager) const
+{
+	const unsigned int heightfieldSize = 257;
+	const float halfSize = static_cast<float>(heightfieldSize - 1) / 2.0f;
+
+	std::vector<Point3<float>> vertices;
+	vertices.reserve(heightfieldSize * heightfieldSize);
+	for(unsigned int z=0; z<heightfieldSize; ++z)
+	{
+		for(unsigned int x=0; x<heightfieldSize; ++x)
+		{
+			float xPosition = static_cast<float>(x) - halfSize;
+			float zPosition = static_cast<float>(z) - halfSize;
+			float height = 2.0f * std::sin(xPosition * 0.15f) * std::cos(zPosition * 0.15f);
+			vertices.emplace_back(Point3<float>(xPosition, height, zPosition));
+		}
+	}
+	auto heightfieldShape = std::make_shared<CollisionHeightfieldShape>(vertices, heightfieldSize, heightfieldSize);
+	bodyManager->addBody(createBody("heightfield", Point3<float>(0.0f, 0.0f, 0.0f), heightfieldShape, 0.0f));
+
+	auto sphereShape = std::make_shared<CollisionSphereShape>(0.5f);
+	for(unsigned int x=0; x<20; ++x)
+	{
+		for(unsigned int z=0; z<20; ++z)
+		{
+			Point3<float> position(static_cast<float>(x) * 6.0f - 57.0f, 5.0f, static_cast<float>(z) * 6.0f - 57.0f);
+			bodyManager->addBody(createBody("sphere_" + std::to_string(x) + "_" + std::to_string(z), position, sphereShape, 1.0f));
+		}
+	}
+}
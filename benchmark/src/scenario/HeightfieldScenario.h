@@ -0,0 +1,17 @@
+#ifndef URCHINENGINE_HEIGHTFIELDSCENARIO_H
+#define URCHINENGINE_HEIGHTFIELDSCENARIO_H
+
+#include "scenario/BenchmarkScenario.h"
+
+/**
+* Spheres rolling on a large heightfield: stresses the concave shape collision algorithm.
+*/
+class HeightfieldScenario : public BenchmarkScenario
+{
+	public:
+		HeightfieldScenario();
+
+		void createBodies(urchin::BodyManager *) const override;
+};
+
+#endif
@@ -23,6 +23,7 @@
 #include "tools/vector/VectorEraser.h"
 #include "tools/thread/LockById.h"
 #include "tools/thread/ScopeLockById.h"
+#include "tools/thread/ThreadPool.h"
 
 #include "pattern/observer/Observable.h"
 #include "pattern/observer/Observer.h"
@@ -33,6 +34,7 @@
 #include "partitioning/aabbtree/AABBTree.h"
 #include "partitioning/aabbtree/AABBNode.h"
 #include "partitioning/aabbtree/AABBNodeData.h"
+#include "partitioning/aabbtree/AABBTreeBrowseStack.h"
 #include "partitioning/octree/Octreeable.h"
 #include "partitioning/octree/OctreeManager.h"
 #include "partitioning/octree/Octree.h"
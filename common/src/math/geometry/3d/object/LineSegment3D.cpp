@@ -109,6 +109,60 @@ namespace urchin
 		return ap.squareLength() - ((apDotAb * apDotAb) / abSquareLength);
 	}
 
+	/**
+	 * @param closestPointThis [out] Point on segment AB closest to other segment
+	 * @param closestPointOther [out] Point on other segment closest to segment AB
+	 */
+	template<class T> void LineSegment3D<T>::closestPoints(const LineSegment3D<T> &other, Point3<T> &closestPointThis, Point3<T> &closestPointOther) const
+	{
+		Vector3<T> d1 = a.vector(b);
+		Vector3<T> d2 = other.getA().vector(other.getB());
+		Vector3<T> r = other.getA().vector(a);
+		T squareLength1 = d1.squareLength();
+		T squareLength2 = d2.squareLength();
+		T f = d2.dotProduct(r);
+
+		T s, t;
+		if(squareLength1==(T)0.0 && squareLength2==(T)0.0)
+		{ //both segments degenerate into points
+			s = 0.0;
+			t = 0.0;
+		}else if(squareLength1==(T)0.0)
+		{ //segment AB degenerates into a point
+			s = 0.0;
+			t = std::min((T)1.0, std::max((T)0.0, f / squareLength2));
+		}else
+		{
+			T c = d1.dotProduct(r);
+			if(squareLength2==(T)0.0)
+			{ //other segment degenerates into a point
+				t = 0.0;
+				s = std::min((T)1.0, std::max((T)0.0, -c / squareLength1));
+			}else
+			{
+				T d1DotD2 = d1.dotProduct(d2);
+				T denominator = squareLength1 * squareLength2 - d1DotD2 * d1DotD2;
+
+				//parallel segments: any point of AB is suitable, take A
+				s = (denominator > (T)0.0) ? std::min((T)1.0, std::max((T)0.0, (d1DotD2 * f - c * squareLength2) / denominator)) : (T)0.0;
+
+				t = (d1DotD2 * s + f) / squareLength2;
+				if(t < (T)0.0)
+				{
+					t = 0.0;
+					s = std::min((T)1.0, std::max((T)0.0, -c / squareLength1));
+				}else if(t > (T)1.0)
+				{
+					t = 1.0;
+					s = std::min((T)1.0, std::max((T)0.0, (d1DotD2 - c) / squareLength1));
+				}
+			}
+		}
+
+		closestPointThis = a.translate(d1 * s);
+		closestPointOther = other.getA().translate(d2 * t);
+	}
+
     template<class T> Vector3<T> LineSegment3D<T>::toVector() const
     {
         return a.vector(b);
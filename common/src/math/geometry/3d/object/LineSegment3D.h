@@ -25,6 +25,7 @@ namespace urchin
 			Point3<T> closestPoint(const Point3<T> &) const;
 			Point3<T> closestPoint(const Point3<T> &, T [2]) const;
 			T squareDistance(const Point3<T> &) const;
+			void closestPoints(const LineSegment3D<T> &, Point3<T> &, Point3<T> &) const;
 
             Vector3<T> toVector() const;
             Line3D<T> toLine() const;
@@ -1,6 +1,8 @@
 #ifndef URCHINENGINE_AABBNODE_H
 #define URCHINENGINE_AABBNODE_H
 
+#include <limits>
+
 #include "partitioning/aabbtree/AABBNodeData.h"
 #include "math/geometry/3d/object/AABBox.h"
 
@@ -9,41 +11,37 @@ namespace urchin
 
     template<class OBJ> class AABBTree;
 
+	/**
+	* Node of an AABBTree. Nodes are stored in a contiguous array of the tree and reference each other by index.
+	*/
 	template<class OBJ> class AABBNode
 	{
 		public:
             friend class AABBTree<OBJ>;
 
-			explicit AABBNode(AABBNodeData<OBJ> *);
-			~AABBNode();
+            static constexpr unsigned int NULL_NODE = std::numeric_limits<unsigned int>::max();
+
+			AABBNode();
 
             AABBNodeData<OBJ> *getNodeData() const;
 
 			bool isLeaf() const;
 			bool isRoot() const;
 
-			void setParent(AABBNode *);
-			AABBNode *getParent() const;
-
-			void setLeftChild(AABBNode *);
-			AABBNode *getLeftChild() const;
-			void setRightChild(AABBNode *);
-			AABBNode *getRightChild() const;
-
-			AABBNode *getSibling() const;
+			unsigned int getParent() const;
+			unsigned int getLeftChild() const;
+			unsigned int getRightChild() const;
+			int getHeight() const;
 
 			const AABBox<float> &getAABBox() const;
-			void updateAABBox(float);
-
-	    protected:
-            void clearNodeData();
 
 		private:
             AABBNodeData<OBJ> *nodeData;
 			AABBox<float> aabbox;
 
-			AABBNode<OBJ> *parentNode;
-			AABBNode<OBJ> *children[2];
+			unsigned int parentNode; //next free node when node is not used
+			unsigned int children[2];
+			int height; //0 for leaf, -1 when node is not used
 	};
 
     #include "AABBNode.inl"
@@ -1,17 +1,10 @@
-template<class OBJ> AABBNode<OBJ>::AABBNode(AABBNodeData<OBJ> *nodeData) :
-        nodeData(nodeData),
-        parentNode(nullptr)
+template<class OBJ> AABBNode<OBJ>::AABBNode() :
+        nodeData(nullptr),
+        parentNode(NULL_NODE),
+        height(-1)
 {
-    this->children[0] = nullptr;
-    this->children[1] = nullptr;
-}
-
-template<class OBJ> AABBNode<OBJ>::~AABBNode()
-{
-    delete children[0];
-    delete children[1];
-
-    delete nodeData;
+    this->children[0] = NULL_NODE;
+    this->children[1] = NULL_NODE;
 }
 
 template<class OBJ> AABBNodeData<OBJ> *AABBNode<OBJ>::getNodeData() const
@@ -21,55 +14,32 @@ template<class OBJ> AABBNodeData<OBJ> *AABBNode<OBJ>::getNodeData() const
 
 template<class OBJ> bool AABBNode<OBJ>::isLeaf() const
 {
-    return children[0]==nullptr;
+    return children[0]==NULL_NODE;
 }
 
 template<class OBJ> bool AABBNode<OBJ>::isRoot() const
 {
-    return parentNode==nullptr;
-}
-
-template<class OBJ> void AABBNode<OBJ>::setParent(AABBNode *parentNode)
-{
-    this->parentNode = parentNode;
+    return parentNode==NULL_NODE;
 }
 
-template<class OBJ> AABBNode<OBJ> *AABBNode<OBJ>::getParent() const
+template<class OBJ> unsigned int AABBNode<OBJ>::getParent() const
 {
     return parentNode;
 }
 
-template<class OBJ> void AABBNode<OBJ>::setLeftChild(AABBNode *leftChild)
-{
-    this->children[0] = leftChild;
-    if(leftChild)
-    {
-        this->children[0]->setParent(this);
-    }
-}
-
-template<class OBJ> AABBNode<OBJ> *AABBNode<OBJ>::getLeftChild() const
+template<class OBJ> unsigned int AABBNode<OBJ>::getLeftChild() const
 {
     return children[0];
 }
 
-template<class OBJ> void AABBNode<OBJ>::setRightChild(AABBNode *rightChild)
-{
-    this->children[1] = rightChild;
-    if(rightChild)
-    {
-        this->children[1]->setParent(this);
-    }
-}
-
-template<class OBJ> AABBNode<OBJ> *AABBNode<OBJ>::getRightChild() const
+template<class OBJ> unsigned int AABBNode<OBJ>::getRightChild() const
 {
     return children[1];
 }
 
-template<class OBJ> AABBNode<OBJ> *AABBNode<OBJ>::getSibling() const
+template<class OBJ> int AABBNode<OBJ>::getHeight() const
 {
-    return parentNode->getLeftChild()==this ? parentNode->getRightChild() : parentNode->getLeftChild();
+    return height;
 }
 
 /**
@@ -79,22 +49,3 @@ template<class OBJ> const AABBox<float> &AABBNode<OBJ>::getAABBox() const
 {
     return aabbox;
 }
-
-template<class OBJ> void AABBNode<OBJ>::updateAABBox(float fatMargin)
-{
-    if (isLeaf())
-    {
-        Point3<float> fatMargin3(fatMargin, fatMargin, fatMargin);
-        AABBox<float> objectBox = nodeData->retrieveObjectAABBox();
-
-        aabbox = AABBox<float>(objectBox.getMin()-fatMargin3, objectBox.getMax()+fatMargin3);
-    }else
-    {
-        aabbox = children[0]->getAABBox().merge(children[1]->getAABBox());
-    }
-}
-
-template<class OBJ> void AABBNode<OBJ>::clearNodeData()
-{
-    nodeData = nullptr;
-}
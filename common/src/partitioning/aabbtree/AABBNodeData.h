@@ -2,19 +2,25 @@
 #define URCHINENGINE_AABBNODEDATA_H
 
 #include <string>
+#include <limits>
 
 #include "math/geometry/3d/object/AABBox.h"
 
 namespace urchin
 {
 
+    template<class OBJ> class AABBTree;
+
     template<class OBJ> class AABBNodeData
     {
         public:
+            friend class AABBTree<OBJ>;
+
             explicit AABBNodeData(OBJ);
             virtual ~AABBNodeData() = default;
 
             OBJ getNodeObject() const;
+            unsigned int getNodeId() const;
 
             virtual AABBNodeData<OBJ> *clone() const = 0;
 
@@ -24,6 +30,7 @@ namespace urchin
 
         private:
             OBJ nodeObject;
+            unsigned int nodeId;
     };
 
     #include "AABBNodeData.inl"
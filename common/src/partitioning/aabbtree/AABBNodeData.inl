@@ -1,5 +1,6 @@
 template<class OBJ> AABBNodeData<OBJ>::AABBNodeData(OBJ nodeObject) :
-        nodeObject(nodeObject)
+        nodeObject(nodeObject),
+        nodeId(std::numeric_limits<unsigned int>::max())
 {
 
 }
@@ -8,3 +9,11 @@ template<class OBJ> OBJ AABBNodeData<OBJ>::getNodeObject() const
 {
     return nodeObject;
 }
+
+/**
+ * @return Index of the leaf node in the tree: allow to access to the node in constant time
+ */
+template<class OBJ> unsigned int AABBNodeData<OBJ>::getNodeId() const
+{
+    return nodeId;
+}
@@ -1,8 +1,14 @@
 #ifndef URCHINENGINE_AABBTREE_H
 #define URCHINENGINE_AABBTREE_H
 
+#include <vector>
+#include <unordered_map>
+#include <algorithm>
+#include <cassert>
+
 #include "partitioning/aabbtree/AABBNode.h"
 #include "partitioning/aabbtree/AABBNodeData.h"
+#include "partitioning/aabbtree/AABBTreeBrowseStack.h"
 #include "math/geometry/3d/Ray.h"
 
 #define BOUNDARIES_MARGIN_PERCENTAGE 0.3f
@@ -10,6 +16,10 @@
 namespace urchin
 {
 
+	/**
+	* Dynamic AABBox tree. Nodes are pooled in a contiguous array and the tree is kept balanced thanks to rotations.
+	* Queries only use local traversal containers: const queries can be executed concurrently by several threads.
+	*/
 	template<class OBJ> class AABBTree
 	{
 		public:
@@ -18,36 +28,57 @@ namespace urchin
 
 			void updateFatMargin(float);
 
-            AABBNode<OBJ> *getRootNode() const;
+            unsigned int getRootNode() const;
+            const AABBNode<OBJ> &getNode(unsigned int) const;
+            int getHeight() const;
+
+            bool containsObject(OBJ) const;
             AABBNodeData<OBJ> *getNodeData(OBJ) const;
             void getAllNodeObjects(std::vector<OBJ> &) const;
 
 			void addObject(AABBNodeData<OBJ> *);
-            virtual void postAddObjectCallback(AABBNode<OBJ> *);
+            virtual void postAddObjectCallback(AABBNodeData<OBJ> *);
 
 			void removeObject(AABBNodeData<OBJ> *);
 			void removeObject(OBJ);
-            virtual void preRemoveObjectCallback(AABBNode<OBJ> *);
+            virtual void preRemoveObjectCallback(AABBNodeData<OBJ> *);
 
 			void updateObjects();
-			virtual void preUpdateObjectCallback(AABBNode<OBJ> *);
+			void updateObjects(const std::vector<OBJ> &);
+			virtual void preUpdateObjectCallback(AABBNodeData<OBJ> *);
 
 			void aabboxQuery(const AABBox<float> &, std::vector<OBJ> &) const;
 			void rayQuery(const Ray<float> &, std::vector<OBJ> &) const;
 			void enlargedRayQuery(const Ray<float> &, float, const OBJ, std::vector<OBJ> &) const;
+			void batchRayQuery(const std::vector<Ray<float>> &, const std::vector<float> &, std::vector<std::vector<OBJ>> &) const;
 
 	    protected:
-            std::map<OBJ, AABBNode<OBJ> *> objectsNode;
-            mutable std::vector<AABBNode<OBJ> *> browseNodes;
+            std::unordered_map<OBJ, AABBNodeData<OBJ> *> objectsNodeData;
 
 		private:
-            std::vector<AABBNodeData<OBJ> *> extractAllNodeData();
-			void insertNode(AABBNode<OBJ> *, AABBNode<OBJ> *);
-			void replaceNode(AABBNode<OBJ> *, AABBNode<OBJ> *);
-			void removeNode(AABBNode<OBJ> *);
+            struct BatchBrowseNode
+            {
+                unsigned int nodeId;
+                unsigned int raysBegin;
+                unsigned int raysEnd;
+            };
+
+            void updateObject(AABBNodeData<OBJ> *);
+
+            unsigned int allocateNode();
+            void freeNode(unsigned int);
+
+            void insertLeaf(unsigned int);
+            void removeLeaf(unsigned int);
+            void refitAncestors(unsigned int);
+            unsigned int balance(unsigned int);
+            void refitNode(unsigned int);
+            static float computeSurfaceArea(const AABBox<float> &);
 
 			float fatMargin;
-			AABBNode<OBJ> *rootNode;
+			std::vector<AABBNode<OBJ>> nodes;
+			unsigned int rootNode;
+			unsigned int freeNodeList;
 	};
 
     #include "AABBTree.inl"
@@ -1,165 +1,125 @@
-
 template<class OBJ> AABBTree<OBJ>::AABBTree(float fatMargin) :
         fatMargin(fatMargin),
-        rootNode(nullptr)
+        rootNode(AABBNode<OBJ>::NULL_NODE),
+        freeNodeList(AABBNode<OBJ>::NULL_NODE)
 {
 
 }
 
 template<class OBJ> AABBTree<OBJ>::~AABBTree()
 {
-    delete rootNode;
+    for(auto &objectNodeData : objectsNodeData)
+    {
+        delete objectNodeData.second;
+    }
 }
 
 template<class OBJ> void AABBTree<OBJ>::updateFatMargin(float fatMargin)
 {
     this->fatMargin = fatMargin;
 
-    std::vector<AABBNodeData<OBJ> *> allNodeData = extractAllNodeData();
-    delete rootNode;
-    rootNode = nullptr;
+    std::vector<AABBNodeData<OBJ> *> allNodeData;
+    allNodeData.reserve(objectsNodeData.size());
+    for(const auto &node : nodes)
+    { //nodes order (instead of map order) to have a deterministic tree
+        if(node.height == 0)
+        {
+            allNodeData.push_back(node.nodeData);
+        }
+    }
+
+    nodes.clear();
+    objectsNodeData.clear();
+    rootNode = AABBNode<OBJ>::NULL_NODE;
+    freeNodeList = AABBNode<OBJ>::NULL_NODE;
     for(const auto nodeData : allNodeData)
     {
         addObject(nodeData);
     }
 }
 
-template <class OBJ> AABBNode<OBJ> *AABBTree<OBJ>::getRootNode() const
+template <class OBJ> unsigned int AABBTree<OBJ>::getRootNode() const
 {
     return rootNode;
 }
 
-template <class OBJ> AABBNodeData<OBJ> *AABBTree<OBJ>::getNodeData(OBJ object) const
+template <class OBJ> const AABBNode<OBJ> &AABBTree<OBJ>::getNode(unsigned int nodeId) const
 {
-    return objectsNode.find(object)->second->getNodeData();
+    return nodes[nodeId];
 }
 
 /**
- *
- * @tparam nodeObjects [out] Returns all node objects in the tree
+ * @return Height of the tree (0 when tree is empty or has only one object)
  */
-template <class OBJ> void AABBTree<OBJ>::getAllNodeObjects(std::vector<OBJ> &nodeObjects) const
+template <class OBJ> int AABBTree<OBJ>::getHeight() const
 {
-    browseNodes.clear();
-    if(rootNode != nullptr)
+    if(rootNode == AABBNode<OBJ>::NULL_NODE)
     {
-        browseNodes.push_back(rootNode);
+        return 0;
     }
+    return nodes[rootNode].height;
+}
 
-    for(std::size_t i=0; i<browseNodes.size(); ++i)
-    { //tree traversal: pre-order (iterative)
-        const AABBNode<OBJ> *currentNode = browseNodes[i];
-
-        if (currentNode->isLeaf())
-        {
-            nodeObjects.push_back(currentNode->getNodeData()->getNodeObject());
-        }else
-        {
-            browseNodes.push_back(currentNode->getRightChild());
-            browseNodes.push_back(currentNode->getLeftChild());
-        }
-    }
+template <class OBJ> bool AABBTree<OBJ>::containsObject(OBJ object) const
+{
+    return objectsNodeData.find(object) != objectsNodeData.end();
 }
 
-template <class OBJ> std::vector<AABBNodeData<OBJ> *> AABBTree<OBJ>::extractAllNodeData()
+template <class OBJ> AABBNodeData<OBJ> *AABBTree<OBJ>::getNodeData(OBJ object) const
 {
-    std::vector<AABBNodeData<OBJ> *> allNodeData = {};
+    return objectsNodeData.find(object)->second;
+}
 
-    browseNodes.clear();
-    if(rootNode != nullptr)
+/**
+ *
+ * @tparam nodeObjects [out] Returns all node objects in the tree
+ */
+template <class OBJ> void AABBTree<OBJ>::getAllNodeObjects(std::vector<OBJ> &nodeObjects) const
+{
+    std::vector<unsigned int> browseNodes; //local queue: queries can be executed concurrently
+    if(rootNode != AABBNode<OBJ>::NULL_NODE)
     {
         browseNodes.push_back(rootNode);
     }
 
     for(std::size_t i=0; i<browseNodes.size(); ++i)
-    { //tree traversal: pre-order (iterative)
-        AABBNode<OBJ> *currentNode = browseNodes[i];
+    { //tree traversal: level-order (iterative) to keep the objects order expected by the navigation mesh generation
+        const AABBNode<OBJ> &currentNode = nodes[browseNodes[i]];
 
-        if (currentNode->isLeaf())
+        if (currentNode.isLeaf())
         {
-            allNodeData.push_back(currentNode->getNodeData());
-            currentNode->clearNodeData();
+            nodeObjects.push_back(currentNode.getNodeData()->getNodeObject());
         }else
         {
-            browseNodes.push_back(currentNode->getRightChild());
-            browseNodes.push_back(currentNode->getLeftChild());
+            browseNodes.push_back(currentNode.getRightChild());
+            browseNodes.push_back(currentNode.getLeftChild());
         }
     }
-
-    return allNodeData;
 }
 
 template <class OBJ> void AABBTree<OBJ>::addObject(AABBNodeData<OBJ> *nodeData)
 {
-    auto *nodeToInsert = new AABBNode<OBJ>(nodeData);
+    unsigned int leafNode = allocateNode();
+    AABBNode<OBJ> &leaf = nodes[leafNode];
 
-    if (rootNode)
-    {
-        nodeToInsert->updateAABBox(fatMargin);
-        insertNode(nodeToInsert, rootNode);
-    }else
-    {
-        rootNode = nodeToInsert;
-        rootNode->updateAABBox(fatMargin);
-    }
+    Point3<float> fatMargin3(fatMargin, fatMargin, fatMargin);
+    AABBox<float> objectBox = nodeData->retrieveObjectAABBox();
+    leaf.aabbox = AABBox<float>(objectBox.getMin() - fatMargin3, objectBox.getMax() + fatMargin3);
+    leaf.nodeData = nodeData;
+    leaf.height = 0;
+    nodeData->nodeId = leafNode;
 
-    objectsNode[nodeData->getNodeObject()] = nodeToInsert;
+    insertLeaf(leafNode);
+    objectsNodeData[nodeData->getNodeObject()] = nodeData;
 
-    postAddObjectCallback(nodeToInsert);
+    postAddObjectCallback(nodeData);
 }
 
-template<class OBJ>  void AABBTree<OBJ>::postAddObjectCallback(AABBNode<OBJ> *)
+template<class OBJ>  void AABBTree<OBJ>::postAddObjectCallback(AABBNodeData<OBJ> *)
 {
     //can be override
 }
 
-template<class OBJ> void AABBTree<OBJ>::insertNode(AABBNode<OBJ> *nodeToInsert, AABBNode<OBJ> *currentNode)
-{
-    if (currentNode->isLeaf())
-    {
-        auto *newParent = new AABBNode<OBJ>(nullptr);
-        replaceNode(currentNode, newParent);
-        newParent->setLeftChild(nodeToInsert);
-        newParent->setRightChild(currentNode);
-        newParent->updateAABBox(fatMargin);
-    }else
-    {
-        const AABBox<float> &leftAABBox = currentNode->getLeftChild()->getAABBox();
-        float volumeDiffLeft = leftAABBox.merge(nodeToInsert->getAABBox()).getVolume() - leftAABBox.getVolume();
-
-        const AABBox<float> &rightAABBox = currentNode->getRightChild()->getAABBox();
-        float volumeDiffRight = rightAABBox.merge(nodeToInsert->getAABBox()).getVolume() - rightAABBox.getVolume();
-
-        if(volumeDiffLeft < volumeDiffRight)
-        {
-            insertNode(nodeToInsert, currentNode->getLeftChild());
-        }else
-        {
-            insertNode(nodeToInsert, currentNode->getRightChild());
-        }
-
-        currentNode->updateAABBox(fatMargin);
-    }
-}
-
-template<class OBJ> void AABBTree<OBJ>::replaceNode(AABBNode<OBJ> *nodeToReplace, AABBNode<OBJ> *newNode)
-{
-    if(nodeToReplace->getParent())
-    {
-        if(nodeToReplace->getParent()->getLeftChild()==nodeToReplace)
-        {
-            nodeToReplace->getParent()->setLeftChild(newNode);
-        }else
-        {
-            nodeToReplace->getParent()->setRightChild(newNode);
-        }
-    }else
-    {
-        rootNode = newNode;
-        newNode->setParent(nullptr);
-    }
-}
-
 template<class OBJ> void AABBTree<OBJ>::removeObject(AABBNodeData<OBJ> *nodeData)
 {
     removeObject(nodeData->getNodeObject());
@@ -167,68 +127,73 @@ template<class OBJ> void AABBTree<OBJ>::removeObject(AABBNodeData<OBJ> *nodeData
 
 template<class OBJ> void AABBTree<OBJ>::removeObject(OBJ object)
 {
-    auto itFind = objectsNode.find(object);
-    if(itFind!=objectsNode.end())
+    auto itFind = objectsNodeData.find(object);
+    if(itFind!=objectsNodeData.end())
     {
-        AABBNode<OBJ> *nodeToRemove = itFind->second;
-        preRemoveObjectCallback(nodeToRemove);
+        AABBNodeData<OBJ> *nodeData = itFind->second;
+        preRemoveObjectCallback(nodeData);
 
-        objectsNode.erase(object);
-        removeNode(nodeToRemove);
+        objectsNodeData.erase(itFind);
+        removeLeaf(nodeData->getNodeId());
+        freeNode(nodeData->getNodeId());
+        delete nodeData;
     }
 }
 
-template<class OBJ> void AABBTree<OBJ>::preRemoveObjectCallback(AABBNode<OBJ> *)
+template<class OBJ> void AABBTree<OBJ>::preRemoveObjectCallback(AABBNodeData<OBJ> *)
 {
     //can be override
 }
 
-template<class OBJ> void AABBTree<OBJ>::removeNode(AABBNode<OBJ> *nodeToRemove)
+template<class OBJ> void AABBTree<OBJ>::updateObjects()
 {
-    AABBNode<OBJ> *parentNode = nodeToRemove->getParent();
-
-    if(!parentNode)
-    {
-        rootNode = nullptr;
-    }else
-    {
-        AABBNode<OBJ> *sibling = nodeToRemove->getSibling();
-        replaceNode(parentNode, sibling);
+    for(unsigned int nodeId=0; nodeId<nodes.size(); ++nodeId)
+    { //leaf node ids are stable: nodes added during the loop are either visited (fat box include object box) or not visited
+        if(nodes[nodeId].height != 0)
+        { //not used node or branch node
+            continue;
+        }
 
-        parentNode->setLeftChild(nullptr); //avoid child removal
-        parentNode->setRightChild(nullptr); //avoid child removal
-        delete parentNode;
+        updateObject(nodes[nodeId].nodeData);
     }
-
-    delete nodeToRemove;
 }
 
-template<class OBJ> void AABBTree<OBJ>::updateObjects()
+/**
+ * Updates only the given objects instead of browsing all the leaves of the tree. Objects not present in the tree are ignored.
+ * Objects are browsed from the last one to the first one: the callbacks can remove the updated object from the vector
+ * as long as the vector is compacted by moving its last element.
+ */
+template<class OBJ> void AABBTree<OBJ>::updateObjects(const std::vector<OBJ> &objects)
 {
-    for(int i=objectsNode.size()-1; i>=0; --i)
-    { //loop backward to remove elements
-        auto it = objectsNode.begin();
-        std::advance(it, i);
-
-        AABBNode<OBJ> *leaf = it->second;
-        if(it->second->getNodeData()->isObjectMoving())
+    for(std::size_t i=objects.size(); i-- > 0;)
+    {
+        auto itFind = objectsNodeData.find(objects[i]);
+        if(itFind != objectsNodeData.end())
         {
-            preUpdateObjectCallback(leaf);
+            updateObject(itFind->second);
+        }
+    }
+}
 
-            const AABBox<float> &leafFatAABBox = leaf->getAABBox();
-            const AABBox<float> &objectAABBox = leaf->getNodeData()->retrieveObjectAABBox();
+template<class OBJ> void AABBTree<OBJ>::updateObject(AABBNodeData<OBJ> *nodeData)
+{
+    if(nodeData->isObjectMoving())
+    {
+        preUpdateObjectCallback(nodeData);
 
-            if(!leafFatAABBox.include(objectAABBox))
-            {
-                AABBNodeData<OBJ> *clonedNodeData = leaf->getNodeData()->clone();
-                removeObject(leaf->getNodeData());
-                addObject(clonedNodeData);
-            }
+        const AABBox<float> &leafFatAABBox = nodes[nodeData->getNodeId()].aabbox;
+        const AABBox<float> &objectAABBox = nodeData->retrieveObjectAABBox();
+
+        if(!leafFatAABBox.include(objectAABBox))
+        {
+            AABBNodeData<OBJ> *clonedNodeData = nodeData->clone();
+            removeObject(nodeData);
+            addObject(clonedNodeData);
         }
     }
 }
 
-template<class OBJ> void AABBTree<OBJ>::preUpdateObjectCallback(AABBNode<OBJ> *)
+template<class OBJ> void AABBTree<OBJ>::preUpdateObjectCallback(AABBNodeData<OBJ> *)
 {
     //can be override
 }
@@ -238,25 +203,25 @@ template<class OBJ> void AABBTree<OBJ>::preUpdateObjectCallback(AABBNode<OBJ> *)
  */
 template<class OBJ> void AABBTree<OBJ>::aabboxQuery(const AABBox<float> &aabbox, std::vector<OBJ> &objectsAABBoxHit) const
 {
-    browseNodes.clear();
-    if(rootNode != nullptr)
+    std::vector<unsigned int> browseNodes; //local queue: queries can be executed concurrently
+    if(rootNode != AABBNode<OBJ>::NULL_NODE)
     {
         browseNodes.push_back(rootNode);
     }
 
     for(std::size_t i=0; i<browseNodes.size(); ++i)
-    { //tree traversal: pre-order (iterative)
-        const AABBNode<OBJ> *currentNode = browseNodes[i];
+    { //tree traversal: level-order (iterative) to keep the objects order expected by the navigation mesh generation
+        const AABBNode<OBJ> &currentNode = nodes[browseNodes[i]];
 
-        if(currentNode->getAABBox().collideWithAABBox(aabbox))
+        if(currentNode.getAABBox().collideWithAABBox(aabbox))
         {
-            if (currentNode->isLeaf())
+            if (currentNode.isLeaf())
             {
-                objectsAABBoxHit.push_back(currentNode->getNodeData()->getNodeObject());
+                objectsAABBoxHit.push_back(currentNode.getNodeData()->getNodeObject());
             }else
             {
-                browseNodes.push_back(currentNode->getRightChild());
-                browseNodes.push_back(currentNode->getLeftChild());
+                browseNodes.push_back(currentNode.getRightChild());
+                browseNodes.push_back(currentNode.getLeftChild());
             }
         }
     }
@@ -267,25 +232,25 @@ template<class OBJ> void AABBTree<OBJ>::aabboxQuery(const AABBox<float> &aabbox,
  */
 template<class OBJ> void AABBTree<OBJ>::rayQuery(const Ray<float> &ray, std::vector<OBJ> &objectsAABBoxHitRay) const
 {
-    browseNodes.clear();
-    if(rootNode != nullptr)
+    AABBTreeBrowseStack<unsigned int> browseNodes; //local stack: queries can be executed concurrently
+    if(rootNode != AABBNode<OBJ>::NULL_NODE)
     {
-        browseNodes.push_back(rootNode);
+        browseNodes.push(rootNode);
     }
 
-    for(std::size_t i=0; i<browseNodes.size(); ++i)
+    while(!browseNodes.isEmpty())
     { //tree traversal: pre-order (iterative)
-        const AABBNode<OBJ> *currentNode = browseNodes[i];
+        const AABBNode<OBJ> &currentNode = nodes[browseNodes.pop()];
 
-        if(currentNode->getAABBox().collideWithRay(ray))
+        if(currentNode.getAABBox().collideWithRay(ray))
         {
-            if (currentNode->isLeaf())
+            if (currentNode.isLeaf())
             {
-                objectsAABBoxHitRay.push_back(currentNode->getNodeData()->getNodeObject());
+                objectsAABBoxHitRay.push_back(currentNode.getNodeData()->getNodeObject());
             }else
             {
-                browseNodes.push_back(currentNode->getRightChild());
-                browseNodes.push_back(currentNode->getLeftChild());
+                browseNodes.push(currentNode.getRightChild());
+                browseNodes.push(currentNode.getLeftChild());
             }
         }
     }
@@ -300,31 +265,317 @@ template<class OBJ> void AABBTree<OBJ>::rayQuery(const Ray<float> &ray, std::vec
 template<class OBJ> void AABBTree<OBJ>::enlargedRayQuery(const Ray<float> &ray, float enlargeNodeBoxHalfSize, const OBJ objectToExclude,
                                std::vector<OBJ> &objectsAABBoxHitEnlargedRay) const
 {
-    browseNodes.clear();
-    if(rootNode != nullptr)
+    AABBTreeBrowseStack<unsigned int> browseNodes; //local stack: queries can be executed concurrently
+    if(rootNode != AABBNode<OBJ>::NULL_NODE)
     {
-        browseNodes.push_back(rootNode);
+        browseNodes.push(rootNode);
     }
 
-    for(std::size_t i=0; i<browseNodes.size(); ++i)
+    while(!browseNodes.isEmpty())
     { //tree traversal: pre-order (iterative)
-        const AABBNode<OBJ> *currentNode = browseNodes[i];
+        const AABBNode<OBJ> &currentNode = nodes[browseNodes.pop()];
 
-        AABBox<float> extendedNodeAABBox = currentNode->getAABBox().enlarge(enlargeNodeBoxHalfSize, enlargeNodeBoxHalfSize);
+        AABBox<float> extendedNodeAABBox = currentNode.getAABBox().enlarge(enlargeNodeBoxHalfSize, enlargeNodeBoxHalfSize);
         if(extendedNodeAABBox.collideWithRay(ray))
         {
-            if (currentNode->isLeaf())
+            if (currentNode.isLeaf())
             {
-                OBJ object = currentNode->getNodeData()->getNodeObject();
+                OBJ object = currentNode.getNodeData()->getNodeObject();
                 if(object!=objectToExclude)
                 {
                     objectsAABBoxHitEnlargedRay.push_back(object);
                 }
             }else
             {
-                browseNodes.push_back(currentNode->getRightChild());
-                browseNodes.push_back(currentNode->getLeftChild());
+                browseNodes.push(currentNode.getRightChild());
+                browseNodes.push(currentNode.getLeftChild());
+            }
+        }
+    }
+}
+
+/**
+ * Process several (enlarged) ray tests in one tree traversal: each node is visited once with the rays still hitting its parent node.
+ * @param enlargeNodeBoxHalfSizes Enlargement of node boxes for each ray (see enlargedRayQuery). Value 0 for a classical ray test.
+ * @param objectsAABBoxHitRays [out] Objects AABBox hit for each ray. Objects are added to the existing content of the vectors.
+ */
+template<class OBJ> void AABBTree<OBJ>::batchRayQuery(const std::vector<Ray<float>> &rays, const std::vector<float> &enlargeNodeBoxHalfSizes,
+                               std::vector<std::vector<OBJ>> &objectsAABBoxHitRays) const
+{
+    assert(rays.size() == enlargeNodeBoxHalfSizes.size());
+    if(objectsAABBoxHitRays.size() < rays.size())
+    {
+        objectsAABBoxHitRays.resize(rays.size());
+    }
+
+    if(rootNode == AABBNode<OBJ>::NULL_NODE || rays.empty())
+    {
+        return;
+    }
+
+    AABBTreeBrowseStack<BatchBrowseNode> browseBatchNodes; //local stack: queries can be executed concurrently
+    std::vector<unsigned int> browseRays;
+    browseRays.reserve(rays.size() * 2);
+    for(unsigned int rayIndex=0; rayIndex<rays.size(); ++rayIndex)
+    {
+        browseRays.push_back(rayIndex);
+    }
+    browseBatchNodes.push({rootNode, 0, static_cast<unsigned int>(rays.size())});
+
+    while(!browseBatchNodes.isEmpty())
+    { //tree traversal: pre-order (iterative)
+        BatchBrowseNode browseNode = browseBatchNodes.pop();
+        const AABBNode<OBJ> &currentNode = nodes[browseNode.nodeId];
+
+        //rays after 'raysEnd' belong to sub-trees already processed
+        browseRays.resize(browseNode.raysEnd);
+        auto raysHitBegin = static_cast<unsigned int>(browseRays.size());
+        for(unsigned int i=browseNode.raysBegin; i<browseNode.raysEnd; ++i)
+        {
+            unsigned int rayIndex = browseRays[i];
+            float enlargeNodeBoxHalfSize = enlargeNodeBoxHalfSizes[rayIndex];
+            bool rayHitNode = enlargeNodeBoxHalfSize == 0.0f ? currentNode.getAABBox().collideWithRay(rays[rayIndex])
+                    : currentNode.getAABBox().enlarge(enlargeNodeBoxHalfSize, enlargeNodeBoxHalfSize).collideWithRay(rays[rayIndex]);
+            if(rayHitNode)
+            {
+                browseRays.push_back(rayIndex);
+            }
+        }
+        auto raysHitEnd = static_cast<unsigned int>(browseRays.size());
+
+        if(raysHitBegin == raysHitEnd)
+        {
+            continue;
+        }
+
+        if (currentNode.isLeaf())
+        {
+            OBJ object = currentNode.getNodeData()->getNodeObject();
+            for(unsigned int i=raysHitBegin; i<raysHitEnd; ++i)
+            {
+                objectsAABBoxHitRays[browseRays[i]].push_back(object);
             }
+        }else
+        {
+            browseBatchNodes.push({currentNode.getRightChild(), raysHitBegin, raysHitEnd});
+            browseBatchNodes.push({currentNode.getLeftChild(), raysHitBegin, raysHitEnd});
+        }
+    }
+}
+
+/**
+ * @return Index of a new node. Nodes array can be resized: references on nodes are invalidated.
+ */
+template<class OBJ> unsigned int AABBTree<OBJ>::allocateNode()
+{
+    if(freeNodeList == AABBNode<OBJ>::NULL_NODE)
+    {
+        nodes.emplace_back(AABBNode<OBJ>());
+        return static_cast<unsigned int>(nodes.size() - 1);
+    }
+
+    unsigned int nodeId = freeNodeList;
+    freeNodeList = nodes[nodeId].parentNode;
+    nodes[nodeId] = AABBNode<OBJ>();
+    return nodeId;
+}
+
+template<class OBJ> void AABBTree<OBJ>::freeNode(unsigned int nodeId)
+{
+    AABBNode<OBJ> &node = nodes[nodeId];
+    node.nodeData = nullptr;
+    node.children[0] = AABBNode<OBJ>::NULL_NODE;
+    node.children[1] = AABBNode<OBJ>::NULL_NODE;
+    node.height = -1;
+
+    node.parentNode = freeNodeList;
+    freeNodeList = nodeId;
+}
+
+/**
+ * Insert the leaf as sibling of the node having the lowest cost. Cost is based on the surface area heuristic (SAH).
+ */
+template<class OBJ> void AABBTree<OBJ>::insertLeaf(unsigned int leafNode)
+{
+    if(rootNode == AABBNode<OBJ>::NULL_NODE)
+    {
+        rootNode = leafNode;
+        nodes[rootNode].parentNode = AABBNode<OBJ>::NULL_NODE;
+        return;
+    }
+
+    const AABBox<float> leafAABBox = nodes[leafNode].aabbox;
+    unsigned int siblingNode = rootNode;
+    while(!nodes[siblingNode].isLeaf())
+    {
+        const AABBNode<OBJ> &currentNode = nodes[siblingNode];
+        const AABBNode<OBJ> &leftChild = nodes[currentNode.getLeftChild()];
+        const AABBNode<OBJ> &rightChild = nodes[currentNode.getRightChild()];
+
+        float area = computeSurfaceArea(currentNode.aabbox);
+        float combinedArea = computeSurfaceArea(currentNode.aabbox.merge(leafAABBox));
+
+        //cost of creating a new parent for this node and the new leaf
+        float cost = 2.0f * combinedArea;
+
+        //minimum cost of pushing the leaf further down the tree
+        float inheritanceCost = 2.0f * (combinedArea - area);
+        float leftCost = computeSurfaceArea(leftChild.aabbox.merge(leafAABBox)) + inheritanceCost;
+        if(!leftChild.isLeaf())
+        {
+            leftCost -= computeSurfaceArea(leftChild.aabbox);
+        }
+        float rightCost = computeSurfaceArea(rightChild.aabbox.merge(leafAABBox)) + inheritanceCost;
+        if(!rightChild.isLeaf())
+        {
+            rightCost -= computeSurfaceArea(rightChild.aabbox);
+        }
+
+        if(cost < leftCost && cost < rightCost)
+        {
+            break;
         }
+
+        siblingNode = (leftCost < rightCost) ? currentNode.getLeftChild() : currentNode.getRightChild();
     }
+
+    unsigned int oldParentNode = nodes[siblingNode].parentNode;
+    unsigned int newParentNode = allocateNode();
+    AABBNode<OBJ> &newParent = nodes[newParentNode];
+    newParent.parentNode = oldParentNode;
+    newParent.aabbox = leafAABBox.merge(nodes[siblingNode].aabbox);
+    newParent.height = nodes[siblingNode].height + 1;
+    newParent.children[0] = leafNode;
+    newParent.children[1] = siblingNode;
+    nodes[leafNode].parentNode = newParentNode;
+    nodes[siblingNode].parentNode = newParentNode;
+
+    if(oldParentNode == AABBNode<OBJ>::NULL_NODE)
+    {
+        rootNode = newParentNode;
+    }else if(nodes[oldParentNode].children[0] == siblingNode)
+    {
+        nodes[oldParentNode].children[0] = newParentNode;
+    }else
+    {
+        nodes[oldParentNode].children[1] = newParentNode;
+    }
+
+    refitAncestors(newParentNode);
+}
+
+template<class OBJ> void AABBTree<OBJ>::removeLeaf(unsigned int leafNode)
+{
+    if(leafNode == rootNode)
+    {
+        rootNode = AABBNode<OBJ>::NULL_NODE;
+        return;
+    }
+
+    unsigned int parentNode = nodes[leafNode].parentNode;
+    unsigned int grandParentNode = nodes[parentNode].parentNode;
+    unsigned int siblingNode = (nodes[parentNode].children[0] == leafNode) ? nodes[parentNode].children[1] : nodes[parentNode].children[0];
+
+    nodes[siblingNode].parentNode = grandParentNode;
+    freeNode(parentNode);
+
+    if(grandParentNode == AABBNode<OBJ>::NULL_NODE)
+    {
+        rootNode = siblingNode;
+    }else
+    {
+        if(nodes[grandParentNode].children[0] == parentNode)
+        {
+            nodes[grandParentNode].children[0] = siblingNode;
+        }else
+        {
+            nodes[grandParentNode].children[1] = siblingNode;
+        }
+
+        refitAncestors(grandParentNode);
+    }
+}
+
+/**
+ * Re-balance and refit bounding boxes from the node up to the root
+ */
+template<class OBJ> void AABBTree<OBJ>::refitAncestors(unsigned int nodeId)
+{
+    while(nodeId != AABBNode<OBJ>::NULL_NODE)
+    {
+        nodeId = balance(nodeId);
+        refitNode(nodeId);
+
+        nodeId = nodes[nodeId].parentNode;
+    }
+}
+
+/**
+ * Perform a left or right rotation if node A is imbalanced (children heights differ of more than one)
+ * @return Index of the node which replaces the node A in the tree
+ */
+template<class OBJ> unsigned int AABBTree<OBJ>::balance(unsigned int nodeA)
+{
+    AABBNode<OBJ> &a = nodes[nodeA];
+    if(a.isLeaf() || a.height < 2)
+    {
+        return nodeA;
+    }
+
+    unsigned int nodeB = a.children[0];
+    unsigned int nodeC = a.children[1];
+    int balanceFactor = nodes[nodeC].height - nodes[nodeB].height;
+
+    if(balanceFactor > 1 || balanceFactor < -1)
+    { //rotate the higher child (named 'up') to replace A
+        unsigned int upChildIndex = (balanceFactor > 1) ? 1 : 0;
+        unsigned int nodeUp = a.children[upChildIndex];
+        AABBNode<OBJ> &up = nodes[nodeUp];
+        unsigned int nodeUpChild1 = up.children[0];
+        unsigned int nodeUpChild2 = up.children[1];
+
+        //swap A and up
+        up.children[0] = nodeA;
+        up.parentNode = a.parentNode;
+        a.parentNode = nodeUp;
+        if(up.parentNode == AABBNode<OBJ>::NULL_NODE)
+        {
+            rootNode = nodeUp;
+        }else if(nodes[up.parentNode].children[0] == nodeA)
+        {
+            nodes[up.parentNode].children[0] = nodeUp;
+        }else
+        {
+            nodes[up.parentNode].children[1] = nodeUp;
+        }
+
+        //highest child of 'up' stays in 'up', lowest child moves to A
+        unsigned int nodeHighest = (nodes[nodeUpChild1].height > nodes[nodeUpChild2].height) ? nodeUpChild1 : nodeUpChild2;
+        unsigned int nodeLowest = (nodeHighest == nodeUpChild1) ? nodeUpChild2 : nodeUpChild1;
+        up.children[1] = nodeHighest;
+        a.children[upChildIndex] = nodeLowest;
+        nodes[nodeLowest].parentNode = nodeA;
+
+        refitNode(nodeA);
+        refitNode(nodeUp);
+        return nodeUp;
+    }
+
+    return nodeA;
+}
+
+template<class OBJ> void AABBTree<OBJ>::refitNode(unsigned int nodeId)
+{
+    AABBNode<OBJ> &node = nodes[nodeId];
+    const AABBNode<OBJ> &leftChild = nodes[node.children[0]];
+    const AABBNode<OBJ> &rightChild = nodes[node.children[1]];
+
+    node.height = 1 + std::max(leftChild.height, rightChild.height);
+    node.aabbox = leftChild.aabbox.merge(rightChild.aabbox);
+}
+
+template<class OBJ> float AABBTree<OBJ>::computeSurfaceArea(const AABBox<float> &aabbox)
+{
+    const Vector3<float> &halfSizes = aabbox.getHalfSizes();
+    return 8.0f * (halfSizes.X * halfSizes.Y + halfSizes.Y * halfSizes.Z + halfSizes.Z * halfSizes.X);
 }
@@ -0,0 +1,4 @@
+namespace urchin
+{
+
+}
@@ -0,0 +1,35 @@
+#ifndef URCHINENGINE_AABBTREEBROWSESTACK_H
+#define URCHINENGINE_AABBTREEBROWSESTACK_H
+
+#include <vector>
+#include <cassert>
+
+namespace urchin
+{
+
+	/**
+	* Stack of nodes to browse during a tree traversal. First elements are stored inline (no allocation for usual tree heights)
+	* and the stack spills to a heap vector when it is full: the tree height is not bounded.
+	*/
+	template<class T> class AABBTreeBrowseStack
+	{
+		public:
+			AABBTreeBrowseStack();
+
+			void push(const T &);
+			T pop();
+			bool isEmpty() const;
+
+		private:
+			static constexpr unsigned int INLINE_SIZE = 64;
+
+			T inlineElements[INLINE_SIZE];
+			unsigned int numberOfInlineElements;
+			std::vector<T> spilledElements;
+	};
+
+    #include "AABBTreeBrowseStack.inl"
+
+}
+
+#endif
@@ -0,0 +1,37 @@
+template<class T> AABBTreeBrowseStack<T>::AABBTreeBrowseStack() :
+        numberOfInlineElements(0)
+{
+
+}
+
+template<class T> void AABBTreeBrowseStack<T>::push(const T &element)
+{
+    if(numberOfInlineElements < INLINE_SIZE)
+    {
+        inlineElements[numberOfInlineElements++] = element;
+    }else
+    {
+        spilledElements.push_back(element);
+    }
+}
+
+/**
+ * @return Last pushed element. Spilled elements are always above the inline elements.
+ */
+template<class T> T AABBTreeBrowseStack<T>::pop()
+{
+    if(!spilledElements.empty())
+    {
+        T element = spilledElements.back();
+        spilledElements.pop_back();
+        return element;
+    }
+
+    assert(numberOfInlineElements > 0);
+    return inlineElements[--numberOfInlineElements];
+}
+
+template<class T> bool AABBTreeBrowseStack<T>::isEmpty() const
+{
+    return numberOfInlineElements==0;
+}
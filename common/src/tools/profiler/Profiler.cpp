@@ -12,6 +12,8 @@ namespace urchin
     std::map<std::string, std::shared_ptr<Profiler>> Profiler::instances;
 
     Profiler::Profiler(const std::string &instanceName) :
+            profilingThreadId(std::thread::id()),
+            ignoredProfileLogged(false),
             instanceName(instanceName),
             profilerRoot(new ProfilerNode("root", nullptr)),
             currentNode(profilerRoot)
@@ -38,9 +40,32 @@ namespace urchin
         return profiler;
     }
 
+    /**
+     * Bind the profiler to the current thread: only the profiles of this thread are recorded. Must be called by a thread
+     * dedicated to the profiled instance (e.g.: physics thread) before its first profile.
+     */
+    void Profiler::bindThread()
+    {
+        std::thread::id boundThreadId;
+        std::thread::id currentThreadId = std::this_thread::get_id();
+        if(!profilingThreadId.compare_exchange_strong(boundThreadId, currentThreadId) && boundThreadId!=currentThreadId && isEnable)
+        {
+            Logger::logger().logWarning("Profiler '" + instanceName + "' is already bound to another thread: profiles of the current thread are ignored.");
+        }
+    }
+
+    /**
+     * Unbind the profiler from the current thread. Must be called when the bound thread ends: another thread can then be bound.
+     */
+    void Profiler::unbindThread()
+    {
+        std::thread::id currentThreadId = std::this_thread::get_id();
+        profilingThreadId.compare_exchange_strong(currentThreadId, std::thread::id());
+    }
+
     void Profiler::startNewProfile(const std::string &nodeName)
     {
-        if(isEnable)
+        if(isEnable && isProfilingThread())
         {
             assert(nodeName.length() <= 15); //ensure to use "small string optimization"
 
@@ -64,7 +89,7 @@ namespace urchin
 
     void Profiler::stopProfile(const std::string &nodeName)
     {
-        if(isEnable)
+        if(isEnable && isProfilingThread())
         {
             if (!nodeName.empty() && currentNode->getName() != nodeName)
             {
@@ -85,6 +110,55 @@ namespace urchin
         }
     }
 
+    /**
+     * Profiler nodes are not thread safe: only the bound thread is profiled (see bindThread). When no thread is bound, the
+     * first thread starting a profile is bound. Profiles started by other threads (e.g. worker threads) are ignored.
+     */
+    bool Profiler::isProfilingThread()
+    {
+        std::thread::id noThreadId;
+        std::thread::id currentThreadId = std::this_thread::get_id();
+        profilingThreadId.compare_exchange_strong(noThreadId, currentThreadId);
+
+        if(profilingThreadId.load() != currentThreadId)
+        {
+            if(!ignoredProfileLogged.exchange(true))
+            {
+                Logger::logger().logInfo("Profiler '" + instanceName + "' ignores the profiles of the threads not bound to it (e.g.: worker threads).");
+            }
+            return false;
+        }
+        return true;
+    }
+
+    /**
+     * @return First node found with the provided name or null if the node doesn't exist (not profiled yet or profiler
+     * disabled)
+     */
+    const ProfilerNode *Profiler::findNode(const std::string &nodeName) const
+    {
+        return findNode(profilerRoot, nodeName);
+    }
+
+    const ProfilerNode *Profiler::findNode(const ProfilerNode *node, const std::string &nodeName)
+    {
+        if(node->getName() == nodeName)
+        {
+            return node;
+        }
+
+        for(const auto &child : node->getChildren())
+        {
+            const ProfilerNode *foundNode = findNode(child, nodeName);
+            if(foundNode)
+            {
+                return foundNode;
+            }
+        }
+
+        return nullptr;
+    }
+
     void Profiler::log()
     {
         if(isEnable)
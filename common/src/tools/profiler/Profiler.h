@@ -4,6 +4,8 @@
 #include <memory>
 #include <map>
 #include <stack>
+#include <atomic>
+#include <thread>
 
 #include "tools/profiler/ProfilerNode.h"
 
@@ -18,15 +20,25 @@ namespace urchin
 
             static std::shared_ptr<Profiler> getInstance(const std::string &);
 
+            void bindThread();
+            void unbindThread();
+
             void startNewProfile(const std::string &);
             void stopProfile(const std::string &nodeName = "");
 
+            const ProfilerNode *findNode(const std::string &) const;
+
             void log();
 
         private:
+            bool isProfilingThread();
+            static const ProfilerNode *findNode(const ProfilerNode *, const std::string &);
+
             static std::map<std::string, std::shared_ptr<Profiler>> instances;
 
             bool isEnable;
+            std::atomic<std::thread::id> profilingThreadId;
+            std::atomic_bool ignoredProfileLogged;
             std::string instanceName;
 
             ProfilerNode *profilerRoot;
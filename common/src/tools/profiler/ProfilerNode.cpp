@@ -94,6 +94,19 @@ namespace urchin
         return isStopped;
     }
 
+    /**
+     * @return Total time in milliseconds of all the calls (including the first one)
+     */
+    double ProfilerNode::getTotalTime() const
+    {
+        return std::accumulate(times.begin(), times.end(), 0.0);
+    }
+
+    unsigned int ProfilerNode::getNumberOfCalls() const
+    {
+        return static_cast<unsigned int>(times.size());
+    }
+
     double ProfilerNode::computeTotalTimes() const
     { //remove first element (avoid counting time for potential initialization process)
         return std::accumulate(times.begin() + 1, times.end(), 0.0);
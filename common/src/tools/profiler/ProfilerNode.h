@@ -26,6 +26,9 @@ namespace urchin
             void startTimer();
             bool stopTimer();
 
+            double getTotalTime() const;
+            unsigned int getNumberOfCalls() const;
+
             void log(unsigned int, std::stringstream &, double);
 
         private:
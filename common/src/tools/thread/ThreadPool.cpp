@@ -0,0 +1,133 @@
+#include <algorithm>
+
+#include "ThreadPool.h"
+
+namespace urchin
+{
+
+    /**
+     * @param numberOfThreads Number of threads executing the tasks (calling thread included). Value 1 means that tasks are executed serially.
+     */
+    ThreadPool::ThreadPool(unsigned int numberOfThreads) :
+            numberOfThreads(std::max(1u, numberOfThreads)),
+            stopWorkers(false),
+            jobGeneration(0),
+            job(nullptr),
+            numberOfTasks(0),
+            nextTask(0),
+            numberOfTasksDone(0)
+    {
+        for(unsigned int i=1; i<this->numberOfThreads; ++i)
+        {
+            workers.emplace_back(&ThreadPool::workerLoop, this);
+        }
+    }
+
+    ThreadPool::~ThreadPool()
+    {
+        {
+            std::lock_guard<std::mutex> lock(mutex);
+            stopWorkers = true;
+        }
+        jobAvailable.notify_all();
+
+        for(auto &worker : workers)
+        {
+            worker.join();
+        }
+    }
+
+    unsigned int ThreadPool::getNumberOfThreads() const
+    {
+        return numberOfThreads;
+    }
+
+    /**
+     * Execute the task for each index in [0, numberOfTasks[ and wait for the end of the executions.
+     * First exception thrown by a task is re-thrown in the calling thread.
+     */
+    void ThreadPool::parallelFor(unsigned int numberOfTasks, const std::function<void(unsigned int)> &task)
+    {
+        if(workers.empty() || numberOfTasks <= 1)
+        {
+            for(unsigned int taskIndex=0; taskIndex<numberOfTasks; ++taskIndex)
+            {
+                task(taskIndex);
+            }
+            return;
+        }
+
+        std::lock_guard<std::mutex> executionLock(executionMutex);
+        std::unique_lock<std::mutex> lock(mutex);
+
+        this->job = &task;
+        this->numberOfTasks = numberOfTasks;
+        this->nextTask = 0;
+        this->numberOfTasksDone = 0;
+        this->jobException = nullptr;
+        unsigned int currentGeneration = ++jobGeneration;
+        jobAvailable.notify_all();
+
+        executeTasks(lock, currentGeneration);
+        jobDone.wait(lock, [&]{return numberOfTasksDone == this->numberOfTasks;});
+
+        this->job = nullptr;
+        if(jobException)
+        {
+            std::rethrow_exception(jobException);
+        }
+    }
+
+    void ThreadPool::workerLoop()
+    {
+        std::unique_lock<std::mutex> lock(mutex);
+        unsigned int lastGeneration = jobGeneration;
+
+        while(true)
+        {
+            jobAvailable.wait(lock, [&]{return stopWorkers || jobGeneration != lastGeneration;});
+            if(stopWorkers)
+            {
+                return;
+            }
+
+            lastGeneration = jobGeneration;
+            executeTasks(lock, lastGeneration);
+        }
+    }
+
+    /**
+     * Execute the remaining tasks of the job. Lock is released during the execution of each task.
+     * Job cannot change while one of its tasks is executed because the job ends only when all its tasks are done.
+     */
+    void ThreadPool::executeTasks(std::unique_lock<std::mutex> &lock, unsigned int generation)
+    {
+        while(jobGeneration == generation && nextTask < numberOfTasks)
+        {
+            unsigned int taskIndex = nextTask++;
+            const std::function<void(unsigned int)> *currentJob = job;
+
+            lock.unlock();
+            std::exception_ptr taskException = nullptr;
+            try
+            {
+                (*currentJob)(taskIndex);
+            }catch(...)
+            {
+                taskException = std::current_exception();
+            }
+            lock.lock();
+
+            if(taskException && !jobException)
+            {
+                jobException = taskException;
+            }
+
+            if(++numberOfTasksDone == numberOfTasks)
+            {
+                jobDone.notify_all();
+            }
+        }
+    }
+
+}
@@ -0,0 +1,50 @@
+#ifndef URCHINENGINE_THREADPOOL_H
+#define URCHINENGINE_THREADPOOL_H
+
+#include <vector>
+#include <thread>
+#include <mutex>
+#include <condition_variable>
+#include <functional>
+#include <exception>
+
+namespace urchin
+{
+
+    /**
+    * Pool of worker threads executing indexed tasks. The calling thread takes part to the execution of the tasks.
+    */
+    class ThreadPool
+    {
+        public:
+            explicit ThreadPool(unsigned int);
+            ~ThreadPool();
+
+            unsigned int getNumberOfThreads() const;
+
+            void parallelFor(unsigned int, const std::function<void(unsigned int)> &);
+
+        private:
+            void workerLoop();
+            void executeTasks(std::unique_lock<std::mutex> &, unsigned int);
+
+            const unsigned int numberOfThreads;
+            std::vector<std::thread> workers;
+
+            std::mutex executionMutex;
+            std::mutex mutex;
+            std::condition_variable jobAvailable;
+            std::condition_variable jobDone;
+
+            bool stopWorkers;
+            unsigned int jobGeneration;
+            const std::function<void(unsigned int)> *job;
+            unsigned int numberOfTasks;
+            unsigned int nextTask;
+            unsigned int numberOfTasksDone;
+            std::exception_ptr jobException;
+    };
+
+}
+
+#endif
@@ -475,14 +475,16 @@ namespace urchin
 
 	void Map::refreshEntities()
 	{
+		float interpolationFactor = physicsWorld->getInterpolationFactor();
+
 		for(SceneObject *sceneObject : sceneObjects)
 		{
-			sceneObject->refresh();
+			sceneObject->refresh(interpolationFactor);
 		}
 
 		for(SceneTerrain *sceneTerrain : sceneTerrains)
 		{
-			sceneTerrain->refresh();
+			sceneTerrain->refresh(interpolationFactor);
 		}
 	}
 
@@ -2,15 +2,32 @@
 
 namespace urchin
 {
-    void SceneEntity::refresh()
+    SceneEntity::SceneEntity() :
+            wasActive(false)
+    {
+
+    }
+
+    /**
+     * @param interpolationFactor Factor used to interpolate the rigid body transform between the two last physics steps
+     */
+    void SceneEntity::refresh(float interpolationFactor)
     {
         RigidBody *rigidBody = getRigidBody();
         if(rigidBody)
         {
-            if(rigidBody->isActive() || rigidBody->isManuallyMovedAndResetFlag())
+            bool isActive = rigidBody->isActive();
+            if(isActive || rigidBody->isManuallyMovedAndResetFlag())
             {
-                moveTo(rigidBody->getTransform());
+                moveTo(rigidBody->getInterpolatedTransform(interpolationFactor));
+            }else if(wasActive)
+            { //body just became inactive: move to its latest transform
+                moveTo(rigidBody->getInterpolatedTransform(1.0f));
             }
+            wasActive = isActive;
+        }else
+        {
+            wasActive = false;
         }
     }
 }
@@ -10,13 +10,17 @@ namespace urchin
     class SceneEntity
     {
         public:
+            SceneEntity();
             virtual ~SceneEntity() = default;
 
-            void refresh();
+            void refresh(float);
 
         protected:
             virtual RigidBody *getRigidBody() const = 0;
             virtual void moveTo(const Transform<float> &) = 0;
+
+        private:
+            bool wasActive;
     };
 
 }
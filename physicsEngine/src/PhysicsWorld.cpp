@@ -3,23 +3,36 @@
 
 #include "PhysicsWorld.h"
 #include "processable/raytest/RayTester.h"
+#include "processable/batchquery/BatchQueryTester.h"
+#include "utils/timer/FixedStepTimer.h"
 
 #define DEFAULT_GRAVITY Vector3<float>(0.0f, -9.81f, 0.0f)
 
 namespace urchin
 {
 
-    //static
-    std::exception_ptr PhysicsWorld::physicsThreadExceptionPtr = nullptr;
-
 	PhysicsWorld::PhysicsWorld() :
+			PhysicsWorld(true)
+	{
+
+	}
+
+	/**
+	 * @param useWorkerThreads Indicates if the collision world can use its own worker threads. Worlds processed by a
+	 * PhysicsWorldScheduler don't use them: the parallelism is done across the worlds.
+	 */
+	PhysicsWorld::PhysicsWorld(bool useWorkerThreads) :
+			maxSubsteps(ConfigService::instance()->getUnsignedIntValue("physicsWorld.maxSubsteps")),
 			physicsSimulationThread(nullptr),
 			physicsSimulationStopper(false),
+			physicsThreadExceptionPtr(nullptr),
+			scheduled(false),
 			gravity(DEFAULT_GRAVITY),
 			timeStep(0.0f),
 			paused(true),
+			lastStepTime(0),
 			bodyManager(new BodyManager()),
-			collisionWorld(new CollisionWorld(bodyManager)),
+			collisionWorld(new CollisionWorld(bodyManager, useWorkerThreads)),
             collisionVisualizer(nullptr)
 	{
 		NumericalCheck::instance()->perform();
@@ -105,6 +118,82 @@ namespace urchin
 		return rayTester->getRayTestResult();
 	}
 
+	/**
+	 * Resolve the tests of the batch query after the next physics update. All tests are resolved together.
+	 */
+	std::shared_ptr<const BatchQueryResult> PhysicsWorld::batchQueryTest(const BatchQuery &batchQuery)
+	{
+		std::shared_ptr<BatchQueryTester> batchQueryTester = std::make_shared<BatchQueryTester>(batchQuery);
+		batchQueryTester->initialize(this);
+
+		std::lock_guard<std::mutex> lock(mutex);
+		oneShotProcessables.push_back(batchQueryTester);
+
+		return batchQueryTester->getBatchQueryResult();
+	}
+
+	/**
+	 * Resolve the tests of the batch query in the calling thread on the state of the last physics update. If a physics
+	 * update is in progress, the method waits for its end: the call can block up to the duration of a physics step. This
+	 * method cannot be called from a processable.
+	 * @return Result of the batch query (always ready)
+	 */
+	std::shared_ptr<const BatchQueryResult> PhysicsWorld::synchronousBatchQueryTest(const BatchQuery &batchQuery)
+	{
+		BatchQueryTester batchQueryTester(batchQuery);
+		batchQueryTester.initialize(this);
+
+		std::lock_guard<std::mutex> lock(collisionWorldMutex);
+		batchQueryTester.execute(0.0f, Vector3<float>(0.0f, 0.0f, 0.0f));
+
+		return batchQueryTester.getBatchQueryResult();
+	}
+
+	/**
+	 * Captures the state of the bodies and their persistent contact points. Bodies added to the world since the last
+	 * physics step are not part of the snapshot.
+	 * @param snapshot [out] Snapshot filled with the world state. Snapshot can be reused for several captures.
+	 */
+	void PhysicsWorld::captureSnapshot(PhysicsWorldSnapshot &snapshot)
+	{
+		std::lock_guard<std::mutex> lock(collisionWorldMutex);
+		collisionWorld->captureSnapshot(snapshot);
+	}
+
+	/**
+	 * Restores the world state captured in the snapshot. The world must contain the same bodies as at the time of the
+	 * capture. Character controllers are not part of the snapshot.
+	 */
+	void PhysicsWorld::restoreSnapshot(const PhysicsWorldSnapshot &snapshot)
+	{
+		std::lock_guard<std::mutex> lock(collisionWorldMutex);
+		collisionWorld->restoreSnapshot(snapshot);
+	}
+
+	/**
+	 * Counters of the last physics step: bodies, broad phase pairs, narrow phase tests by algorithm type, GJK/EPA
+	 * iterations, CCD tests, solved contacts and collision algorithms pool usage. This method can be called from any
+	 * thread (e.g.: game thread at each frame) without waiting for the end of a physics update.
+	 */
+	PhysicsStatistics PhysicsWorld::getStatistics() const
+	{
+		std::lock_guard<std::mutex> lock(mutex);
+
+		return lastStepStatistics;
+	}
+
+	/**
+	 * Defines a custom filter of the pairs of bodies in addition to the collision groups and masks of the bodies. If a
+	 * physics update is in progress, the method waits for its end. Existing pairs are kept: define the filter before
+	 * adding the bodies.
+	 * @param collisionFilter Collision filter or null to remove the filter
+	 */
+	void PhysicsWorld::setCollisionFilter(const std::shared_ptr<const CollisionFilter> &collisionFilter)
+	{
+		std::lock_guard<std::mutex> lock(collisionWorldMutex);
+		collisionWorld->getBroadPhaseManager()->setCollisionFilter(collisionFilter);
+	}
+
 	/**
 	 * @param gravity Gravity expressed in units/s^2
 	 */
@@ -126,7 +215,8 @@ namespace urchin
 	}
 
 	/**
-	 * Set up the physics simulation in new thread
+	 * Set up the physics simulation in new thread. The simulation is processed with a fixed time step: when the physics
+	 * thread is late, several steps (limited by 'physicsWorld.maxSubsteps') are processed to catch up.
 	 * @param timeStep Frequency updates expressed in second
 	 */
 	void PhysicsWorld::setUp(float timeStep)
@@ -134,6 +224,9 @@ namespace urchin
 		if(physicsSimulationThread)
 		{
 			throw std::runtime_error("Physics thread is already started");
+		}else if(scheduled)
+		{
+			throw std::runtime_error("Physics world is processed by a scheduler: setUp cannot be called");
 		}
 
 		this->timeStep = timeStep;
@@ -141,6 +234,24 @@ namespace urchin
 		physicsSimulationThread = new std::thread(&PhysicsWorld::startPhysicsUpdate, this);
 	}
 
+	/**
+	 * @return Factor to use for interpolating the bodies transform between the two last physics steps (see
+	 * AbstractBody::getInterpolatedTransform). Factor is 0 just after a physics step and reaches 1 when the next step is
+	 * expected.
+	 */
+	float PhysicsWorld::getInterpolationFactor() const
+	{
+		std::int64_t stepTime = lastStepTime.load(std::memory_order_relaxed);
+		if(stepTime==0 || timeStep <= 0.0f)
+		{
+			return 1.0f;
+		}
+
+		std::int64_t currentTime = std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::steady_clock::now().time_since_epoch()).count();
+		float elapsedTime = static_cast<float>(currentTime - stepTime) / 1000000.0f;
+		return std::min(std::max(elapsedTime / timeStep, 0.0f), 1.0f);
+	}
+
 	void PhysicsWorld::pause()
 	{
 		std::lock_guard<std::mutex> lock(mutex);
@@ -175,52 +286,39 @@ namespace urchin
 	 */
 	void PhysicsWorld::controlExecution()
 	{
-		if(physicsThreadExceptionPtr)
+		std::exception_ptr exceptionPtr;
+		{
+			std::lock_guard<std::mutex> lock(mutex);
+			exceptionPtr = physicsThreadExceptionPtr;
+		}
+
+		if(exceptionPtr)
 		{
-			std::rethrow_exception(physicsThreadExceptionPtr);
+			std::rethrow_exception(exceptionPtr);
 		}
 	}
 
 	void PhysicsWorld::startPhysicsUpdate()
 	{
+		Profiler::getInstance("physics")->bindThread();
 		try
 		{
-			float remainingTime = 0.0f;
-            float maxAdditionalTimeStep = timeStep * 0.5f;
-			auto frameStartTime = std::chrono::high_resolution_clock::now();
+			FixedStepTimer fixedStepTimer(timeStep, maxSubsteps);
 
 			while (continueExecution())
 			{
-                float additionalTimeStep = std::abs(remainingTime);
-                if(additionalTimeStep > maxAdditionalTimeStep)
-                {
-					//Cannot process physics update with 'additionalTimeStep'. Value is too big and can lead to physics errors.
-					//Use 'maxAdditionalTimeStep' which lead to slow-down of the physics.
-                    additionalTimeStep = maxAdditionalTimeStep;
-                }
-
-                processPhysicsUpdate(timeStep + additionalTimeStep);
-
-				auto frameEndTime = std::chrono::high_resolution_clock::now();
-				auto diffTimeMicroSeconds = std::chrono::duration_cast<std::chrono::microseconds>(frameEndTime - frameStartTime).count();
-				remainingTime = (timeStep + additionalTimeStep) - static_cast<float>(diffTimeMicroSeconds / 1000000.0);
-
-				if (remainingTime >= 0.0f)
-				{
-					std::this_thread::sleep_for(std::chrono::milliseconds(static_cast<int>(remainingTime * 1000.0f)));
-
-					remainingTime = 0.0f;
-					frameStartTime = std::chrono::high_resolution_clock::now();
-				} else
+				unsigned int numberOfSteps = fixedStepTimer.waitNextSteps();
+				for(unsigned int i=0; i<numberOfSteps && continueExecution(); ++i)
 				{
-					frameStartTime = frameEndTime;
+					processPhysicsUpdate(timeStep);
 				}
 			}
 		}catch(std::exception &e)
 		{
             Logger::logger().logError("Error cause physics thread crash: exception reported to main thread");
-			physicsThreadExceptionPtr = std::current_exception();
+			setPhysicsThreadException(std::current_exception());
 		}
+		Profiler::getInstance("physics")->unbindThread();
 	}
 
 	/**
@@ -254,12 +352,38 @@ namespace urchin
 		//physics execution
 		if(!paused)
 		{
+			std::lock_guard<std::mutex> lock(collisionWorldMutex);
+
 			setupProcessables(copiedProcessables, frameTimeStep, gravity);
 
 			collisionWorld->process(frameTimeStep, gravity);
+			{
+				std::lock_guard<std::mutex> statisticsLock(mutex);
+				lastStepStatistics = collisionWorld->getStatistics();
+			}
 
 			executeProcessables(copiedProcessables, frameTimeStep, gravity);
 		}
+
+		lastStepTime.store(std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::steady_clock::now().time_since_epoch()).count(), std::memory_order_relaxed);
+	}
+
+	/**
+	 * Stores the exception which stopped the processing of the world. Method can be called from the thread processing the
+	 * world (physics thread or thread of a PhysicsWorldScheduler).
+	 */
+	void PhysicsWorld::setPhysicsThreadException(const std::exception_ptr &exceptionPtr)
+	{
+		std::lock_guard<std::mutex> lock(mutex);
+
+		physicsThreadExceptionPtr = exceptionPtr;
+	}
+
+	bool PhysicsWorld::hasPhysicsThreadException() const
+	{
+		std::lock_guard<std::mutex> lock(mutex);
+
+		return physicsThreadExceptionPtr != nullptr;
 	}
 
 	/**
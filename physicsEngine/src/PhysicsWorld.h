@@ -6,6 +6,7 @@
 #include <memory>
 #include <thread>
 #include <mutex>
+#include <cstdint>
 #include "UrchinCommon.h"
 
 #include "body/model/AbstractBody.h"
@@ -13,6 +14,10 @@
 #include "collision/CollisionWorld.h"
 #include "processable/Processable.h"
 #include "processable/raytest/RayTestResult.h"
+#include "processable/batchquery/BatchQuery.h"
+#include "processable/batchquery/BatchQueryResult.h"
+#include "snapshot/PhysicsWorldSnapshot.h"
+#include "statistics/PhysicsStatistics.h"
 #include "visualizer/CollisionVisualizer.h"
 
 namespace urchin
@@ -20,8 +25,11 @@ namespace urchin
 
 	class PhysicsWorld
 	{
+		friend class PhysicsWorldScheduler;
+
 		public:
 			PhysicsWorld();
+			explicit PhysicsWorld(bool);
 			~PhysicsWorld();
 
 			BodyManager *getBodyManager() const;
@@ -34,11 +42,21 @@ namespace urchin
 			void removeProcessable(const std::shared_ptr<Processable> &);
 
 			std::shared_ptr<const RayTestResult> rayTest(const Ray<float> &);
+			std::shared_ptr<const BatchQueryResult> batchQueryTest(const BatchQuery &);
+			std::shared_ptr<const BatchQueryResult> synchronousBatchQueryTest(const BatchQuery &); //waits for the end of the running physics step
+
+			void captureSnapshot(PhysicsWorldSnapshot &);
+			void restoreSnapshot(const PhysicsWorldSnapshot &);
+
+			PhysicsStatistics getStatistics() const;
+
+			void setCollisionFilter(const std::shared_ptr<const CollisionFilter> &);
 
 			void setGravity(const Vector3<float> &);
 			Vector3<float> getGravity() const;
 
 			void setUp(float);
+			float getInterpolationFactor() const;
 			void pause();
 			void unpause();
 			bool isPaused() const;
@@ -52,18 +70,26 @@ namespace urchin
 			void startPhysicsUpdate();
 			bool continueExecution();
 			void processPhysicsUpdate(float);
+			void setPhysicsThreadException(const std::exception_ptr &);
+			bool hasPhysicsThreadException() const;
 
 			void setupProcessables(const std::vector<std::shared_ptr<Processable>> &, float, const Vector3<float> &);
 			void executeProcessables(const std::vector<std::shared_ptr<Processable>> &, float, const Vector3<float> &);
 
+			const unsigned int maxSubsteps;
+
 			std::thread *physicsSimulationThread;
 			std::atomic_bool physicsSimulationStopper;
-			static std::exception_ptr physicsThreadExceptionPtr;
+			std::exception_ptr physicsThreadExceptionPtr; //guarded by mutex
+			bool scheduled; //processed by a PhysicsWorldScheduler
 
 			mutable std::mutex mutex;
+			std::mutex collisionWorldMutex; //locked while collision world is processed
 			Vector3<float> gravity;
 			float timeStep;
 			bool paused;
+			std::atomic<std::int64_t> lastStepTime; //in microseconds
+			PhysicsStatistics lastStepStatistics;
 
 			BodyManager *bodyManager;
 			CollisionWorld *collisionWorld;
@@ -0,0 +1,184 @@
+#include <algorithm>
+#include <stdexcept>
+
+#include "PhysicsWorldScheduler.h"
+#include "utils/timer/FixedStepTimer.h"
+
+namespace urchin
+{
+
+	/**
+	 * @param timeStep Frequency updates of the worlds expressed in second
+	 * @param numberOfThreads Number of threads processing the worlds (including the scheduler thread)
+	 */
+	PhysicsWorldScheduler::PhysicsWorldScheduler(float timeStep, unsigned int numberOfThreads) :
+			timeStep(timeStep),
+			maxSubsteps(ConfigService::instance()->getUnsignedIntValue("physicsWorld.maxSubsteps")),
+			threadPool(std::max(numberOfThreads, 1u)),
+			schedulerThread(nullptr),
+			schedulerStopper(false),
+			schedulerExceptionPtr(nullptr)
+	{
+
+	}
+
+	PhysicsWorldScheduler::~PhysicsWorldScheduler()
+	{
+		if(schedulerThread)
+		{
+			interrupt();
+			schedulerThread->join();
+
+			delete schedulerThread;
+		}
+
+		for(auto world : worlds)
+		{
+			delete world;
+		}
+	}
+
+	/**
+	 * @return New physics world processed by the scheduler. World is owned by the scheduler and must not be set up.
+	 */
+	PhysicsWorld *PhysicsWorldScheduler::createWorld()
+	{
+		auto *world = new PhysicsWorld(false);
+		world->scheduled = true;
+		world->timeStep = timeStep;
+
+		std::lock_guard<std::mutex> lock(worldsMutex);
+		worlds.push_back(world);
+
+		return world;
+	}
+
+	/**
+	 * Destroy the world. If the world is being processed, the method waits for the end of the processing.
+	 */
+	void PhysicsWorldScheduler::destroyWorld(PhysicsWorld *world)
+	{
+		std::lock_guard<std::mutex> processLock(processMutex);
+		{
+			std::lock_guard<std::mutex> lock(worldsMutex);
+
+			auto itFind = std::find(worlds.begin(), worlds.end(), world);
+			if(itFind==worlds.end())
+			{
+				throw std::invalid_argument("Physics world is not owned by the scheduler");
+			}
+			worlds.erase(itFind);
+		}
+
+		delete world;
+	}
+
+	std::vector<PhysicsWorld *> PhysicsWorldScheduler::getWorlds() const
+	{
+		std::lock_guard<std::mutex> lock(worldsMutex);
+
+		return worlds;
+	}
+
+	/**
+	 * Start the processing of the worlds in a new thread
+	 */
+	void PhysicsWorldScheduler::start()
+	{
+		if(schedulerThread)
+		{
+			throw std::runtime_error("Physics scheduler thread is already started");
+		}
+
+		schedulerThread = new std::thread(&PhysicsWorldScheduler::startPhysicsUpdate, this);
+	}
+
+	/**
+	 * Interrupt the thread
+	 */
+	void PhysicsWorldScheduler::interrupt()
+	{
+		schedulerStopper.store(true, std::memory_order_relaxed);
+	}
+
+	/**
+	 * Check if thread has been stopped by an exception and rethrow exception on main thread
+	 */
+	void PhysicsWorldScheduler::controlExecution()
+	{
+		std::exception_ptr exceptionPtr;
+		{
+			std::lock_guard<std::mutex> lock(worldsMutex);
+			exceptionPtr = schedulerExceptionPtr;
+		}
+
+		if(exceptionPtr)
+		{
+			std::rethrow_exception(exceptionPtr);
+		}
+	}
+
+	/**
+	 * The profiler is bound to the scheduler thread: only the worlds processed by this thread are profiled.
+	 */
+	void PhysicsWorldScheduler::startPhysicsUpdate()
+	{
+		Profiler::getInstance("physics")->bindThread();
+		try
+		{
+			FixedStepTimer fixedStepTimer(timeStep, maxSubsteps);
+
+			while (continueExecution())
+			{
+				unsigned int numberOfSteps = fixedStepTimer.waitNextSteps();
+				for(unsigned int i=0; i<numberOfSteps && continueExecution(); ++i)
+				{
+					processWorlds();
+				}
+			}
+		}catch(std::exception &e)
+		{
+			Logger::logger().logError("Error cause physics scheduler thread crash: exception reported to main thread");
+			std::lock_guard<std::mutex> lock(worldsMutex);
+			schedulerExceptionPtr = std::current_exception();
+		}
+		Profiler::getInstance("physics")->unbindThread();
+	}
+
+	/**
+	 * @return True if thread execution is not interrupted
+	 */
+	bool PhysicsWorldScheduler::continueExecution()
+	{
+		return !schedulerStopper.load(std::memory_order_relaxed);
+	}
+
+	void PhysicsWorldScheduler::processWorlds()
+	{
+		std::lock_guard<std::mutex> processLock(processMutex);
+		{
+			std::lock_guard<std::mutex> lock(worldsMutex);
+			copiedWorlds.clear();
+			for(auto world : worlds)
+			{
+				if(!world->hasPhysicsThreadException())
+				{ //worlds stopped by an exception are not processed anymore
+					copiedWorlds.push_back(world);
+				}
+			}
+		}
+
+		threadPool.parallelFor(static_cast<unsigned int>(copiedWorlds.size()), [&](unsigned int worldIndex) {
+			PhysicsWorld *world = copiedWorlds[worldIndex];
+			try
+			{
+				world->processPhysicsUpdate(timeStep);
+			}catch(std::exception &e)
+			{
+				Logger::logger().logError("Error cause physics world crash: exception reported to main thread by the world");
+				world->setPhysicsThreadException(std::current_exception());
+			}
+		});
+	}
+
+}
@@ -0,0 +1,58 @@
+#ifndef URCHINENGINE_PHYSICSWORLDSCHEDULER_H
+#define URCHINENGINE_PHYSICSWORLDSCHEDULER_H
+
+#include <vector>
+#include <atomic>
+#include <thread>
+#include <mutex>
+#include <exception>
+#include "UrchinCommon.h"
+
+#include "PhysicsWorld.h"
+
+namespace urchin
+{
+
+	/**
+	* Process several physics worlds with a shared thread pool: all worlds are stepped with the same fixed time step and
+	* each world is processed by one thread of the pool. Worlds have their own bodies, locks and processables. The pool of
+	* collision objects is shared by the worlds (see CollisionConvexObjectPool).
+	* A world stopped by an exception is not processed anymore and its exception is rethrown by its controlExecution
+	* method: the other worlds continue to be processed.
+	*/
+	class PhysicsWorldScheduler
+	{
+		public:
+			PhysicsWorldScheduler(float, unsigned int);
+			~PhysicsWorldScheduler();
+
+			PhysicsWorld *createWorld();
+			void destroyWorld(PhysicsWorld *);
+			std::vector<PhysicsWorld *> getWorlds() const;
+
+			void start();
+			void interrupt();
+			void controlExecution();
+
+		private:
+			void startPhysicsUpdate();
+			bool continueExecution();
+			void processWorlds();
+
+			const float timeStep;
+			const unsigned int maxSubsteps;
+			ThreadPool threadPool;
+
+			std::thread *schedulerThread;
+			std::atomic_bool schedulerStopper;
+			std::exception_ptr schedulerExceptionPtr; //guarded by worldsMutex
+
+			mutable std::mutex worldsMutex;
+			std::mutex processMutex; //locked while worlds are processed
+			std::vector<PhysicsWorld *> worlds;
+			std::vector<PhysicsWorld *> copiedWorlds;
+	};
+
+}
+
+#endif
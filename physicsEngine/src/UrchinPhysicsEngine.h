@@ -2,11 +2,13 @@
 #define URCHINENGINE_URCHINPHYSICSENGINE_H
 
 #include "PhysicsWorld.h"
+#include "PhysicsWorldScheduler.h"
 
 #include "body/model/RigidBody.h"
 #include "body/work/WorkRigidBody.h"
 #include "body/work/WorkGhostBody.h"
 #include "body/InertiaCalculation.h"
+#include "body/BodyStateSnapshot.h"
 
 #include "shape/CollisionShape3D.h"
 #include "shape/CollisionSphereShape.h"
@@ -25,11 +27,13 @@
 #include "object/CollisionCylinderObject.h"
 #include "object/CollisionConeObject.h"
 #include "object/CollisionConvexHullObject.h"
+#include "object/StandaloneConvexHullObject.h"
 #include "object/CollisionTriangleObject.h"
 
 #include "collision/OverlappingPair.h"
 #include "collision/ManifoldResult.h"
 #include "collision/ManifoldContactPoint.h"
+#include "collision/broadphase/CollisionFilter.h"
 #include "collision/broadphase/aabbtree/AABBTreeAlgorithm.h"
 #include "collision/narrowphase/algorithm/epa/EPAAlgorithm.h"
 #include "collision/narrowphase/algorithm/epa/result/EPAResult.h"
@@ -41,8 +45,15 @@
 
 #include "processable/Processable.h"
 #include "processable/raytest/RayTestResult.h"
+#include "processable/batchquery/BatchQuery.h"
+#include "processable/batchquery/BatchQueryResult.h"
+
+#include "snapshot/PhysicsWorldSnapshot.h"
+
+#include "statistics/PhysicsStatistics.h"
 
 #include "character/PhysicsCharacterController.h"
+#include "character/PhysicsCharacterControllerBatch.h"
 #include "character/PhysicsCharacter.h"
 
 #include "visualizer/CollisionVisualizer.h"
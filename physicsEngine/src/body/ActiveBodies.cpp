@@ -0,0 +1,42 @@
+#include <limits>
+#include <cassert>
+
+#include "body/ActiveBodies.h"
+#include "body/work/AbstractWorkBody.h"
+
+namespace urchin
+{
+
+	//static
+	const unsigned int ActiveBodies::NO_ACTIVE_INDEX = std::numeric_limits<unsigned int>::max();
+
+	void ActiveBodies::addBody(AbstractWorkBody *body)
+	{
+		assert(body->getActiveBodyIndex()==NO_ACTIVE_INDEX);
+
+		body->setActiveBodyIndex(static_cast<unsigned int>(bodies.size()));
+		bodies.push_back(body);
+	}
+
+	/**
+	 * Removes the body in constant time: the last body of the list takes the place of the removed body
+	 */
+	void ActiveBodies::removeBody(AbstractWorkBody *body)
+	{
+		unsigned int activeBodyIndex = body->getActiveBodyIndex();
+		assert(activeBodyIndex < bodies.size() && bodies[activeBodyIndex]==body);
+
+		AbstractWorkBody *lastBody = bodies.back();
+		bodies[activeBodyIndex] = lastBody;
+		lastBody->setActiveBodyIndex(activeBodyIndex);
+		bodies.pop_back();
+
+		body->setActiveBodyIndex(NO_ACTIVE_INDEX);
+	}
+
+	const std::vector<AbstractWorkBody *> &ActiveBodies::getBodies() const
+	{
+		return bodies;
+	}
+
+}
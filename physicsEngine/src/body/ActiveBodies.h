@@ -0,0 +1,31 @@
+#ifndef URCHINENGINE_ACTIVEBODIES_H
+#define URCHINENGINE_ACTIVEBODIES_H
+
+#include <vector>
+
+namespace urchin
+{
+
+	class AbstractWorkBody;
+
+	/**
+	* Compact list of the active work bodies. The list is updated incrementally when the active state of a body changes:
+	* the physics passes iterate over the active bodies only instead of over all the bodies of the world.
+	*/
+	class ActiveBodies
+	{
+		public:
+			static const unsigned int NO_ACTIVE_INDEX;
+
+			void addBody(AbstractWorkBody *);
+			void removeBody(AbstractWorkBody *);
+
+			const std::vector<AbstractWorkBody *> &getBodies() const;
+
+		private:
+			std::vector<AbstractWorkBody *> bodies;
+	};
+
+}
+
+#endif
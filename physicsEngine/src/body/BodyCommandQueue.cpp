@@ -0,0 +1,61 @@
+#include <algorithm>
+
+#include "body/BodyCommandQueue.h"
+
+namespace urchin
+{
+
+	BodyCommandQueue::BodyCommandQueue() :
+			head(nullptr)
+	{
+
+	}
+
+	BodyCommandQueue::~BodyCommandQueue()
+	{
+		CommandNode *node = head.exchange(nullptr);
+		while(node)
+		{
+			CommandNode *nextNode = node->next;
+			delete node;
+			node = nextNode;
+		}
+	}
+
+	/**
+	 * Pushes a command. Can be called from any thread.
+	 */
+	void BodyCommandQueue::push(BodyCommand::CommandType type, AbstractBody *body)
+	{
+		auto *node = new CommandNode();
+		node->command.type = type;
+		node->command.body = body;
+		node->next = head.load(std::memory_order_relaxed);
+
+		while(!head.compare_exchange_weak(node->next, node, std::memory_order_release, std::memory_order_relaxed))
+		{
+			//node->next updated with the current head: retry
+		}
+	}
+
+	/**
+	 * Pops all commands in the order of their push. Must be called from the physics thread.
+	 * @param commands [out] Commands popped
+	 */
+	void BodyCommandQueue::popAll(std::vector<BodyCommand> &commands)
+	{
+		CommandNode *node = head.exchange(nullptr, std::memory_order_acquire);
+
+		std::size_t firstCommandIndex = commands.size();
+		while(node)
+		{
+			commands.push_back(node->command);
+
+			CommandNode *nextNode = node->next;
+			delete node;
+			node = nextNode;
+		}
+		std::reverse(commands.begin() + firstCommandIndex, commands.end());
+	}
+
+}
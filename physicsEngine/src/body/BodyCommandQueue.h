@@ -0,0 +1,49 @@
+#ifndef URCHINENGINE_BODYCOMMANDQUEUE_H
+#define URCHINENGINE_BODYCOMMANDQUEUE_H
+
+#include <vector>
+#include <atomic>
+
+#include "body/model/AbstractBody.h"
+
+namespace urchin
+{
+
+	struct BodyCommand
+	{
+		enum CommandType
+		{
+			ADD_BODY,
+			REMOVE_BODY
+		};
+
+		CommandType type;
+		AbstractBody *body;
+	};
+
+	/**
+	* Lock-free queue of commands coming from user threads (multiple producers) and consumed by the physics thread
+	* (single consumer).
+	*/
+	class BodyCommandQueue
+	{
+		public:
+			BodyCommandQueue();
+			~BodyCommandQueue();
+
+			void push(BodyCommand::CommandType, AbstractBody *);
+			void popAll(std::vector<BodyCommand> &);
+
+		private:
+			struct CommandNode
+			{
+				BodyCommand command;
+				CommandNode *next;
+			};
+
+			std::atomic<CommandNode *> head;
+	};
+
+}
+
+#endif
@@ -1,6 +1,9 @@
 #include <algorithm>
+#include <stdexcept>
+#include <string>
 
 #include "body/BodyManager.h"
+#include "body/work/WorkRigidBody.h"
 
 namespace urchin
 {
@@ -13,6 +16,16 @@ namespace urchin
 
 	BodyManager::~BodyManager()
 	{
+		commands.clear();
+		commandQueue.popAll(commands);
+		for(auto &command : commands)
+		{
+			if(command.type==BodyCommand::ADD_BODY)
+			{
+				bodies.push_back(command.body);
+			}
+		}
+
 		for(auto &body : bodies)
 		{
 			delete body;
@@ -27,14 +40,16 @@ namespace urchin
 	void BodyManager::addBody(AbstractBody *body)
 	{
 		body->setIsNew(true);
+		body->setStateSnapshot(&stateSnapshot);
 
-		std::lock_guard<std::mutex> lock(bodiesMutex);
-		this->bodies.push_back(body);
+		commandQueue.push(BodyCommand::ADD_BODY, body);
 	}
 
 	void BodyManager::removeBody(AbstractBody *body)
 	{
 		body->markAsDeleted();
+
+		commandQueue.push(BodyCommand::REMOVE_BODY, body);
 	}
 
 	AbstractWorkBody *BodyManager::getLastUpdatedWorkBody() const
@@ -42,40 +57,188 @@ namespace urchin
 		return lastUpdatedWorkBody;
 	}
 
+	/**
+	 * @return Bodies processed by the physics thread. Must be called from the physics thread.
+	 */
+	const std::vector<AbstractBody *> &BodyManager::getBodies() const
+	{
+		return bodies;
+	}
+
 	const std::vector<AbstractWorkBody *> &BodyManager::getWorkBodies() const
 	{
 		return workBodies;
 	}
 
 	/**
-	 * Setup work bodies with new data on bodies
+	 * Adds the work body in the list of active work bodies each time it becomes active. Allow to track work bodies not
+	 * managed by the body manager (e.g.: ghost body of character controller). Must be called from the physics thread.
 	 */
-	void BodyManager::setupWorkBodies()
+	void BodyManager::trackActiveState(AbstractWorkBody *workBody)
 	{
-		ScopeProfiler profiler("physics", "setupWorkBodies");
-		std::lock_guard<std::mutex> lock(bodiesMutex);
+		workBody->setActiveBodies(&activeWorkBodies);
+	}
+
+	/**
+	 * @return Work bodies currently active. List is updated when the active state of a work body changes.
+	 */
+	const std::vector<AbstractWorkBody *> &BodyManager::getActiveWorkBodies() const
+	{
+		return activeWorkBodies.getBodies();
+	}
 
-		auto it = bodies.begin();
-		while(it!=bodies.end())
+	/**
+	 * Writes the state of the work bodies in the snapshot. Bodies are written in the order of the bodies list.
+	 */
+	void BodyManager::captureBodies(PhysicsWorldSnapshot &snapshot) const
+	{
+		snapshot.writeUnsignedInt(static_cast<std::uint32_t>(bodies.size()));
+
+		for(const auto &body : bodies)
 		{
-			AbstractBody *body = *it;
+			const AbstractWorkBody *workBody = body->getWorkBody();
+			snapshot.writePoint(workBody->getPosition());
+			snapshot.writeQuaternion(workBody->getOrientation());
+			snapshot.writeBool(workBody->isActive());
 
-			if(body->isNew())
+			const WorkRigidBody *workRigidBody = WorkRigidBody::upCast(workBody);
+			snapshot.writeBool(workRigidBody!=nullptr);
+			if(workRigidBody)
 			{
-				createNewWorkBody(body);
-				++it;
-			}else if(body->isDeleted())
+				snapshot.writeVector(workRigidBody->getLinearVelocity());
+				snapshot.writeVector(workRigidBody->getAngularVelocity());
+				snapshot.writeVector(workRigidBody->getTotalMomentum());
+				snapshot.writeVector(workRigidBody->getTotalTorqueMomentum());
+			}
+		}
+	}
+
+	/**
+	 * Restores the state of the work bodies from the snapshot. The list of active work bodies is rebuilt in the order of
+	 * the bodies list: the resimulation doesn't depend on the state preceding the restoration.
+	 * The snapshot is fully checked before any modification: an invalid snapshot leaves the bodies untouched.
+	 * @param offset [in,out] Offset of the bodies state in the snapshot
+	 */
+	void BodyManager::restoreBodies(const PhysicsWorldSnapshot &snapshot, std::size_t &offset)
+	{
+		std::size_t checkOffset = offset;
+		checkSnapshotBodies(snapshot, checkOffset);
+		snapshot.readUnsignedInt(offset); //bodies count
+
+		for(auto &body : bodies)
+		{
+			body->getWorkBody()->setIsActive(false);
+		}
+
+		for(auto &body : bodies)
+		{
+			AbstractWorkBody *workBody = body->getWorkBody();
+			workBody->setPosition(snapshot.readPoint(offset));
+			workBody->setOrientation(snapshot.readQuaternion(offset));
+			bool isActive = snapshot.readBool(offset);
+
+			WorkRigidBody *workRigidBody = WorkRigidBody::upCast(workBody);
+			snapshot.readBool(offset); //is rigid body
+			if(workRigidBody)
+			{
+				workRigidBody->setLinearVelocity(snapshot.readVector(offset));
+				workRigidBody->setAngularVelocity(snapshot.readVector(offset));
+				workRigidBody->setTotalMomentum(snapshot.readVector(offset));
+				workRigidBody->setTotalTorqueMomentum(snapshot.readVector(offset));
+				workRigidBody->refreshInvWorldInertia();
+			}
+
+			if(!workBody->isStatic())
+			{
+				workBody->setIsActive(isActive);
+			}
+
+			//body teleported: no interpolation with the state preceding the restoration
+			stateSnapshot.resetStateHistory(body->getStateIndex());
+		}
+	}
+
+	/**
+	 * Checks, without modifying the bodies, that the snapshot is complete and matches the number and the type of the bodies.
+	 * @param offset [in,out] Offset of the bodies state in the snapshot, moved to the end of the bodies state
+	 */
+	void BodyManager::checkSnapshotBodies(const PhysicsWorldSnapshot &snapshot, std::size_t &offset) const
+	{
+		std::uint32_t bodiesCount = snapshot.readUnsignedInt(offset);
+		if(bodiesCount!=bodies.size())
+		{
+			throw std::invalid_argument("Number of bodies in snapshot (" + std::to_string(bodiesCount) + ") is different from the number of bodies in world ("
+					+ std::to_string(bodies.size()) + ").");
+		}
+
+		for(const auto &body : bodies)
+		{
+			snapshot.readPoint(offset);
+			snapshot.readQuaternion(offset);
+			snapshot.readBool(offset);
+
+			bool isRigidBody = WorkRigidBody::upCast(body->getWorkBody())!=nullptr;
+			if(snapshot.readBool(offset)!=isRigidBody)
 			{
-				it = deleteBody(body, it);
-			}else if(body->needFullRefresh())
+				throw std::invalid_argument("Type of body " + body->getId() + " in snapshot is different from the type of body in world.");
+			}
+			if(isRigidBody)
+			{
+				for(unsigned int i=0; i<4; ++i)
+				{ //linear velocity, angular velocity, total momentum and total torque momentum
+					snapshot.readVector(offset);
+				}
+			}
+		}
+	}
+
+	/**
+	 * Setup work bodies with new data on bodies. Only the bodies modified by the user are locked.
+	 */
+	void BodyManager::setupWorkBodies()
+	{
+		ScopeProfiler profiler("physics", "setupWorkBodies");
+
+		processCommands();
+
+		for(auto &body : bodies)
+		{
+			if(body->needFullRefresh())
 			{
 				deleteWorkBody(body);
 				createNewWorkBody(body);
-				++it;
-			}else
+			}else if(body->needUpdate())
 			{
 				body->updateTo(body->getWorkBody());
-				++it;
+			}else
+			{
+				WorkRigidBody *workRigidBody = WorkRigidBody::upCast(body->getWorkBody());
+				if(workRigidBody)
+				{
+					workRigidBody->refreshInvWorldInertia();
+				}
+			}
+		}
+	}
+
+	void BodyManager::processCommands()
+	{
+		commands.clear();
+		commandQueue.popAll(commands);
+
+		for(auto &command : commands)
+		{
+			if(command.type==BodyCommand::ADD_BODY)
+			{
+				bodies.push_back(command.body);
+				createNewWorkBody(command.body);
+			}else if(command.type==BodyCommand::REMOVE_BODY)
+			{
+				auto itFind = std::find(bodies.begin(), bodies.end(), command.body);
+				if(itFind!=bodies.end())
+				{
+					deleteBody(command.body, itFind);
+				}
 			}
 		}
 	}
@@ -83,11 +246,20 @@ namespace urchin
 	void BodyManager::createNewWorkBody(AbstractBody *body)
 	{
 		//create new work body
-		AbstractWorkBody *workBody = body->createWorkBody();
-		body->setWorkBody(workBody);
 		body->setIsNew(false);
 		body->setNeedFullRefresh(false);
+		body->captureTransformVersion();
+		AbstractWorkBody *workBody = body->createWorkBody();
+		body->setWorkBody(workBody);
+		trackActiveState(workBody);
 		workBodies.push_back(workBody);
+		if(body->getStateIndex()==BodyStateSnapshot::NO_STATE_INDEX)
+		{
+			body->setStateIndex(stateSnapshot.allocateStateIndex());
+		}else
+		{ //body recreated: no interpolation with the previous work body
+			stateSnapshot.resetStateHistory(body->getStateIndex());
+		}
 
 		//update work body
 		body->updateTo(workBody);
@@ -101,6 +273,7 @@ namespace urchin
 	{
 		//delete work body
 		deleteWorkBody(body);
+		stateSnapshot.releaseStateIndex(body->getStateIndex());
 
 		//delete body
 		auto newIt = bodies.erase(it);
@@ -129,19 +302,27 @@ namespace urchin
 		}
 	}
 
+	/**
+	 * Publishes the state of work bodies in a new snapshot. Bodies are not locked.
+	 */
 	void BodyManager::applyWorkBodies()
 	{
-		std::lock_guard<std::mutex> lock(bodiesMutex);
+		ScopeProfiler profiler("physics", "applyWorkBodies");
+
+		stateSnapshot.beginWrite();
 
-		for (auto &body : bodies)
+		BodyState state;
+		for(auto &body : bodies)
 		{
-			AbstractWorkBody *workBody = body->getWorkBody();
-			if(!workBody)
-			{ //work body is not created yet
-				continue;
-			}
+			body->applyFrom(body->getWorkBody(), state);
+			stateSnapshot.writeState(body->getStateIndex(), state);
+		}
 
-			body->applyFrom(workBody);
+		stateSnapshot.publish();
+
+		for(auto &body : bodies)
+		{
+			body->publishState();
 		}
 	}
 
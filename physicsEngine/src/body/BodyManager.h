@@ -1,10 +1,14 @@
 #ifndef URCHINENGINE_BODYMANAGER_H
 #define URCHINENGINE_BODYMANAGER_H
 
-#include <mutex>
+#include <vector>
 
 #include "body/model/AbstractBody.h"
 #include "body/work/AbstractWorkBody.h"
+#include "body/BodyStateSnapshot.h"
+#include "body/BodyCommandQueue.h"
+#include "body/ActiveBodies.h"
+#include "snapshot/PhysicsWorldSnapshot.h"
 
 namespace urchin
 {
@@ -12,6 +16,8 @@ namespace urchin
 	/**
 	* A bodies manager allowing to manage bodies modifications coming from two different thread. Indeed, the user
 	* can add/remove/update bodies from thread 1 while physics engine update the same bodies on thread 2.
+	* Additions and removals are transmitted through a lock-free command queue and the bodies state computed by the
+	* physics engine is published in a lock-free snapshot: the user thread and the physics thread never wait each other.
 	*/
 	class BodyManager : public Observable
 	{
@@ -32,17 +38,28 @@ namespace urchin
 			void setupWorkBodies();
 			void applyWorkBodies();
 
+			const std::vector<AbstractBody *> &getBodies() const;
 			const std::vector<AbstractWorkBody *> &getWorkBodies() const;
+			void trackActiveState(AbstractWorkBody *);
+			const std::vector<AbstractWorkBody *> &getActiveWorkBodies() const;
+
+			void captureBodies(PhysicsWorldSnapshot &) const;
+			void checkSnapshotBodies(const PhysicsWorldSnapshot &, std::size_t &) const;
+			void restoreBodies(const PhysicsWorldSnapshot &, std::size_t &);
 
 		private:
+			void processCommands();
 			void createNewWorkBody(AbstractBody *);
 			std::vector<AbstractBody *>::iterator deleteBody(AbstractBody *, const std::vector<AbstractBody *>::iterator &);
 			void deleteWorkBody(AbstractBody *body);
 
 			std::vector<AbstractBody *> bodies;
 			std::vector<AbstractWorkBody *> workBodies;
+			ActiveBodies activeWorkBodies;
 
-			mutable std::mutex bodiesMutex;
+			BodyCommandQueue commandQueue;
+			std::vector<BodyCommand> commands;
+			BodyStateSnapshot stateSnapshot;
 
 			AbstractWorkBody *lastUpdatedWorkBody;
 	};
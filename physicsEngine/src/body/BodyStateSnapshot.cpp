@@ -0,0 +1,156 @@
+#include <limits>
+#include <thread>
+#include <cassert>
+
+#include "body/BodyStateSnapshot.h"
+
+namespace urchin
+{
+
+	//static
+	const unsigned int BodyStateSnapshot::NO_STATE_INDEX = std::numeric_limits<unsigned int>::max();
+	const int BodyStateSnapshot::NO_BUFFER = -1;
+
+	BodyStateSnapshot::BodyStateSnapshot() :
+			latestBuffer(NO_BUFFER),
+			writeBuffer(NO_BUFFER),
+			numberOfStates(0)
+	{
+		for(auto &readerCount : readersCount)
+		{
+			readerCount.store(0);
+		}
+	}
+
+	/**
+	 * Reserves a state index for a body. Must be called from the physics thread.
+	 */
+	unsigned int BodyStateSnapshot::allocateStateIndex()
+	{
+		unsigned int stateIndex;
+		if(!freeStateIndices.empty())
+		{
+			stateIndex = freeStateIndices.back();
+			freeStateIndices.pop_back();
+		}else
+		{
+			stateIndex = numberOfStates++;
+			stateHistoryResets.push_back(true);
+		}
+
+		resetStateHistory(stateIndex);
+		return stateIndex;
+	}
+
+	/**
+	 * Releases a state index of a body. Must be called from the physics thread.
+	 */
+	void BodyStateSnapshot::releaseStateIndex(unsigned int stateIndex)
+	{
+		freeStateIndices.push_back(stateIndex);
+	}
+
+	/**
+	 * Indicates that the next written state has no previous state to interpolate from (e.g.: body teleported). Must be
+	 * called from the physics thread.
+	 */
+	void BodyStateSnapshot::resetStateHistory(unsigned int stateIndex)
+	{
+		stateHistoryResets[stateIndex] = true;
+	}
+
+	/**
+	 * Selects a buffer which is neither the latest published buffer nor read by a reader. Must be called from the physics
+	 * thread.
+	 */
+	void BodyStateSnapshot::beginWrite()
+	{
+		writeBuffer = NO_BUFFER;
+		while(writeBuffer==NO_BUFFER)
+		{
+			int latest = latestBuffer.load();
+			for(int i=0; i<(int)NUMBER_OF_BUFFERS; ++i)
+			{
+				if(i!=latest && readersCount[i].load()==0)
+				{
+					writeBuffer = i;
+					break;
+				}
+			}
+
+			if(writeBuffer==NO_BUFFER)
+			{ //all buffers are read: readers hold a buffer only for copying a state
+				std::this_thread::yield();
+			}
+		}
+
+		buffers[writeBuffer].resize(numberOfStates);
+	}
+
+	void BodyStateSnapshot::writeState(unsigned int stateIndex, const BodyState &state)
+	{
+		#ifndef NDEBUG
+			assert(writeBuffer!=NO_BUFFER);
+		#endif
+
+		BodyState &writtenState = buffers[writeBuffer][stateIndex];
+		writtenState = state;
+
+		int latest = latestBuffer.load();
+		if(latest!=NO_BUFFER && stateIndex < buffers[latest].size() && !stateHistoryResets[stateIndex])
+		{
+			writtenState.previousPosition = buffers[latest][stateIndex].position;
+			writtenState.previousOrientation = buffers[latest][stateIndex].orientation;
+		}else
+		{
+			writtenState.previousPosition = state.position;
+			writtenState.previousOrientation = state.orientation;
+			stateHistoryResets[stateIndex] = false;
+		}
+	}
+
+	void BodyStateSnapshot::publish()
+	{
+		latestBuffer.store(writeBuffer);
+		writeBuffer = NO_BUFFER;
+	}
+
+	/**
+	 * @param state [out] Latest published state of the body. Can be called from any thread.
+	 * @return True when a state has been published for the state index
+	 */
+	bool BodyStateSnapshot::readState(unsigned int stateIndex, BodyState &state) const
+	{
+		if(stateIndex==NO_STATE_INDEX)
+		{
+			return false;
+		}
+
+		int bufferIndex;
+		while(true)
+		{
+			bufferIndex = latestBuffer.load();
+			if(bufferIndex==NO_BUFFER)
+			{
+				return false;
+			}
+
+			readersCount[bufferIndex].fetch_add(1);
+			if(latestBuffer.load()==bufferIndex)
+			{ //buffer cannot be selected by the writer anymore while reader count is not null
+				break;
+			}
+			readersCount[bufferIndex].fetch_sub(1);
+		}
+
+		bool stateFound = stateIndex < buffers[bufferIndex].size();
+		if(stateFound)
+		{
+			state = buffers[bufferIndex][stateIndex];
+		}
+
+		readersCount[bufferIndex].fetch_sub(1);
+		return stateFound;
+	}
+
+}
@@ -0,0 +1,61 @@
+#ifndef URCHINENGINE_BODYSTATESNAPSHOT_H
+#define URCHINENGINE_BODYSTATESNAPSHOT_H
+
+#include <vector>
+#include <atomic>
+#include "UrchinCommon.h"
+
+namespace urchin
+{
+
+	struct BodyState
+	{
+		Point3<float> position;
+		Quaternion<float> orientation;
+		Vector3<float> linearVelocity;
+		Vector3<float> angularVelocity;
+
+		//state of the previous publication (used for interpolation)
+		Point3<float> previousPosition;
+		Quaternion<float> previousOrientation;
+	};
+
+	/**
+	* Triple buffered snapshot of bodies state. The physics thread writes the states in a buffer not used by any reader
+	* and publishes it with a single atomic operation. Readers (user thread, render thread...) never block the physics
+	* thread and are never blocked by it.
+	*/
+	class BodyStateSnapshot
+	{
+		public:
+			static const unsigned int NUMBER_OF_BUFFERS = 3;
+			static const unsigned int NO_STATE_INDEX;
+
+			BodyStateSnapshot();
+
+			unsigned int allocateStateIndex();
+			void releaseStateIndex(unsigned int);
+			void resetStateHistory(unsigned int);
+
+			void beginWrite();
+			void writeState(unsigned int, const BodyState &);
+			void publish();
+
+			bool readState(unsigned int, BodyState &) const;
+
+		private:
+			static const int NO_BUFFER;
+
+			std::vector<BodyState> buffers[NUMBER_OF_BUFFERS];
+			std::atomic_int latestBuffer;
+			mutable std::atomic_uint readersCount[NUMBER_OF_BUFFERS];
+
+			int writeBuffer;
+			unsigned int numberOfStates;
+			std::vector<unsigned int> freeStateIndices;
+			std::vector<bool> stateHistoryResets;
+	};
+
+}
+
+#endif
@@ -0,0 +1,34 @@
+#include <algorithm>
+
+#include "body/StaticStateChanges.h"
+
+namespace urchin
+{
+
+	/**
+	 * Adds a body whose static state changed. A body can be added several times when its state changes several times.
+	 */
+	void StaticStateChanges::addBody(AbstractWorkBody *body)
+	{
+		bodies.push_back(body);
+	}
+
+	/**
+	 * Removes all the occurrences of the body (e.g.: body deleted before the changes are processed)
+	 */
+	void StaticStateChanges::removeBody(AbstractWorkBody *body)
+	{
+		bodies.erase(std::remove(bodies.begin(), bodies.end(), body), bodies.end());
+	}
+
+	void StaticStateChanges::clear()
+	{
+		bodies.clear();
+	}
+
+	const std::vector<AbstractWorkBody *> &StaticStateChanges::getBodies() const
+	{
+		return bodies;
+	}
+
+}
@@ -0,0 +1,30 @@
+#ifndef URCHINENGINE_STATICSTATECHANGES_H
+#define URCHINENGINE_STATICSTATECHANGES_H
+
+#include <vector>
+
+namespace urchin
+{
+
+	class AbstractWorkBody;
+
+	/**
+	* List of the work bodies whose static state changed. The list is filled by the bodies themselves when their static state
+	* changes: the consumer processes these bodies only instead of checking the state of all the bodies.
+	*/
+	class StaticStateChanges
+	{
+		public:
+			void addBody(AbstractWorkBody *);
+			void removeBody(AbstractWorkBody *);
+			void clear();
+
+			const std::vector<AbstractWorkBody *> &getBodies() const;
+
+		private:
+			std::vector<AbstractWorkBody *> bodies;
+	};
+
+}
+
+#endif
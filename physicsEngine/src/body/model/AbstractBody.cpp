@@ -12,8 +12,15 @@ namespace urchin
             bIsNew(false),
             bIsDeleted(false),
             bNeedFullRefresh(false),
+            bNeedUpdate(false),
 			workBody(nullptr),
+			stateSnapshot(nullptr),
+			stateIndex(BodyStateSnapshot::NO_STATE_INDEX),
+			workTransformVersion(0),
+			publishedStateIndex(BodyStateSnapshot::NO_STATE_INDEX),
+			publishedTransformVersion(0),
 			transform(std::move(transform)),
+			transformVersion(0),
 			isManuallyMoved(false),
 			id(std::move(id)),
             originalShape(std::move(shape)),
@@ -21,6 +28,8 @@ namespace urchin
             friction(0.0f),
             rollingFriction(0.0f),
             ccdMotionThreshold(0.0f),
+            collisionGroup(AbstractWorkBody::DEFAULT_COLLISION_GROUP),
+            collisionMask(AbstractWorkBody::ALL_COLLISION_GROUPS),
             bIsStatic(true),
             bIsActive(false)
 	{
@@ -32,8 +41,15 @@ namespace urchin
             bIsNew(false),
             bIsDeleted(false),
             bNeedFullRefresh(false),
+            bNeedUpdate(false),
 			workBody(nullptr),
+			stateSnapshot(nullptr),
+			stateIndex(BodyStateSnapshot::NO_STATE_INDEX),
+			workTransformVersion(0),
+			publishedStateIndex(BodyStateSnapshot::NO_STATE_INDEX),
+			publishedTransformVersion(0),
 			transform(abstractBody.getTransform()),
+			transformVersion(0),
 			isManuallyMoved(false),
 			id(abstractBody.getId()),
 			originalShape(std::shared_ptr<const CollisionShape3D>(abstractBody.getOriginalShape()->clone())),
@@ -41,11 +57,15 @@ namespace urchin
             friction(0.0f),
             rollingFriction(0.0f),
             ccdMotionThreshold(0.0f),
+            collisionGroup(AbstractWorkBody::DEFAULT_COLLISION_GROUP),
+            collisionMask(AbstractWorkBody::ALL_COLLISION_GROUPS),
             bIsStatic(true),
             bIsActive(false)
 	{
 		initialize(abstractBody.getRestitution(), abstractBody.getFriction(), abstractBody.getRollingFriction());
 		setCcdMotionThreshold(abstractBody.getCcdMotionThreshold());
+		setCollisionGroup(abstractBody.getCollisionGroup());
+		setCollisionMask(abstractBody.getCollisionMask());
 	}
 
 	void AbstractBody::initialize(float restitution, float friction, float rollingFriction)
@@ -54,6 +74,7 @@ namespace urchin
 		bIsNew.store(false, std::memory_order_relaxed);
 		bIsDeleted.store(false, std::memory_order_relaxed);
 		bNeedFullRefresh.store(false, std::memory_order_relaxed);
+		bNeedUpdate.store(false, std::memory_order_relaxed);
 		bIsStatic.store(true, std::memory_order_relaxed);
 		bIsActive.store(false, std::memory_order_relaxed);
 
@@ -102,6 +123,65 @@ namespace urchin
 		return bNeedFullRefresh.load(std::memory_order_relaxed);
 	}
 
+	/**
+	 * @param needUpdate Indicate whether body data has been modified and must be pushed to the work body
+	 */
+	void AbstractBody::setNeedUpdate(bool needUpdate)
+	{
+		this->bNeedUpdate.store(needUpdate, std::memory_order_relaxed);
+	}
+
+	bool AbstractBody::needUpdate() const
+	{
+		return bNeedUpdate.load(std::memory_order_relaxed);
+	}
+
+	void AbstractBody::setStateSnapshot(const BodyStateSnapshot *stateSnapshot)
+	{
+		this->stateSnapshot = stateSnapshot;
+	}
+
+	/**
+	 * @param stateIndex Index of the body in the state snapshot. Must be called from the physics thread.
+	 */
+	void AbstractBody::setStateIndex(unsigned int stateIndex)
+	{
+		this->stateIndex = stateIndex;
+	}
+
+	unsigned int AbstractBody::getStateIndex() const
+	{
+		return stateIndex;
+	}
+
+	/**
+	 * Memorizes the version of the transform used to create the work body. Must be called from the physics thread before
+	 * the work body creation.
+	 */
+	void AbstractBody::captureTransformVersion()
+	{
+		workTransformVersion = transformVersion.load();
+	}
+
+	/**
+	 * Makes the state of the body readable from the last published snapshot. Must be called from the physics thread once
+	 * the snapshot has been published.
+	 */
+	void AbstractBody::publishState()
+	{
+		publishedStateIndex.store(stateIndex);
+		publishedTransformVersion.store(workTransformVersion);
+	}
+
+	/**
+	 * @param state [out] State of the body in the last published snapshot
+	 * @return True when the body has a state in the last published snapshot
+	 */
+	bool AbstractBody::readState(BodyState &state) const
+	{
+		return stateSnapshot && stateSnapshot->readState(publishedStateIndex.load(), state);
+	}
+
 	void AbstractBody::setWorkBody(AbstractWorkBody *workBody)
 	{
 		this->workBody = workBody;
@@ -122,24 +202,22 @@ namespace urchin
 		workBody->setFriction(friction);
 		workBody->setRollingFriction(rollingFriction);
 		workBody->setCcdMotionThreshold(ccdMotionThreshold);
+		workBody->setCollisionGroup(collisionGroup);
+		workBody->setCollisionMask(collisionMask);
+
+		this->setNeedUpdate(false);
 	}
 
-	bool AbstractBody::applyFrom(const AbstractWorkBody *workBody)
+	/**
+	 * Fills the body state from the work body. This method doesn't lock the body mutex: body attributes are not modified.
+	 * @param state [out] Body state to publish
+	 */
+	void AbstractBody::applyFrom(const AbstractWorkBody *workBody, BodyState &state)
 	{
-        #ifndef NDEBUG
-            assert(!bodyMutex.try_lock()); //body mutex should be locked before call this method
-        #endif
+		bIsActive.store(workBody->isActive(), std::memory_order_relaxed);
 
-		bool fullRefreshRequested = bNeedFullRefresh.load(std::memory_order_relaxed);
-		if(!fullRefreshRequested)
-		{
-			bIsActive.store(workBody->isActive(), std::memory_order_relaxed);
-
-			transform.setPosition(workBody->getPosition());
-			transform.setOrientation(workBody->getOrientation());
-		}
-
-		return fullRefreshRequested;
+		state.position = workBody->getPosition();
+		state.orientation = workBody->getOrientation();
 	}
 
 	void AbstractBody::setTransform(const Transform<float> &transform)
@@ -155,14 +233,45 @@ namespace urchin
 			this->transform = transform;
 		}
 
+		this->transformVersion.fetch_add(1);
 		this->setNeedFullRefresh(true);
 		this->isManuallyMoved = true;
 	}
 
+	/**
+	 * @return Transform of the last published snapshot or the transform defined by the user when it has not been
+	 * taken into account by the physics thread yet
+	 */
 	Transform<float> AbstractBody::getTransform() const
 	{
 		std::lock_guard<std::mutex> lock(bodyMutex);
 
+		BodyState state;
+		if(transformVersion.load()==publishedTransformVersion.load() && readState(state))
+		{
+			return Transform<float>(state.position, state.orientation, transform.getScale());
+		}
+
+		return transform;
+	}
+
+	/**
+	 * @param interpolationFactor Factor between 0 (previous published state) and 1 (last published state)
+	 * @return Transform interpolated between the two last published states or the transform defined by the user when it
+	 * has not been taken into account by the physics thread yet
+	 */
+	Transform<float> AbstractBody::getInterpolatedTransform(float interpolationFactor) const
+	{
+		std::lock_guard<std::mutex> lock(bodyMutex);
+
+		BodyState state;
+		if(transformVersion.load()==publishedTransformVersion.load() && readState(state))
+		{
+			Point3<float> position = state.previousPosition.translate(state.previousPosition.vector(state.position) * interpolationFactor);
+			Quaternion<float> orientation = state.previousOrientation.slerp(state.orientation, interpolationFactor);
+			return Transform<float>(position, orientation, transform.getScale());
+		}
+
 		return transform;
 	}
 
@@ -230,6 +339,7 @@ namespace urchin
 		std::lock_guard<std::mutex> lock(bodyMutex);
 
 		this->restitution = restitution;
+		this->setNeedUpdate(true);
 	}
 
 	/**
@@ -250,6 +360,7 @@ namespace urchin
 		std::lock_guard<std::mutex> lock(bodyMutex);
 
 		this->friction = friction;
+		this->setNeedUpdate(true);
 	}
 
 	/**
@@ -270,6 +381,7 @@ namespace urchin
 		std::lock_guard<std::mutex> lock(bodyMutex);
 
 		this->rollingFriction = rollingFriction;
+		this->setNeedUpdate(true);
 	}
 
 	/**
@@ -302,6 +414,45 @@ namespace urchin
 		std::lock_guard<std::mutex> lock(bodyMutex);
 
 		this->ccdMotionThreshold = ccdMotionThreshold;
+		this->setNeedUpdate(true);
+	}
+
+	/**
+	 * Pairs between two bodies are created only when each body belongs to a group of the mask of the other body. The pairs
+	 * of the body are recomputed at the next physics update.
+	 * @param collisionGroup Groups of the body (one bit by group). Default: AbstractWorkBody::DEFAULT_COLLISION_GROUP.
+	 */
+	void AbstractBody::setCollisionGroup(std::uint32_t collisionGroup)
+	{
+		std::lock_guard<std::mutex> lock(bodyMutex);
+
+		this->collisionGroup = collisionGroup;
+		this->setNeedFullRefresh(true);
+	}
+
+	std::uint32_t AbstractBody::getCollisionGroup() const
+	{
+		std::lock_guard<std::mutex> lock(bodyMutex);
+
+		return collisionGroup;
+	}
+
+	/**
+	 * @param collisionMask Groups of bodies colliding with the body (one bit by group). Default: AbstractWorkBody::ALL_COLLISION_GROUPS.
+	 */
+	void AbstractBody::setCollisionMask(std::uint32_t collisionMask)
+	{
+		std::lock_guard<std::mutex> lock(bodyMutex);
+
+		this->collisionMask = collisionMask;
+		this->setNeedFullRefresh(true);
+	}
+
+	std::uint32_t AbstractBody::getCollisionMask() const
+	{
+		std::lock_guard<std::mutex> lock(bodyMutex);
+
+		return collisionMask;
 	}
 
 	/**
@@ -5,9 +5,11 @@
 #include <memory>
 #include <atomic>
 #include <mutex>
+#include <cstdint>
 #include "UrchinCommon.h"
 
 #include "body/work/AbstractWorkBody.h"
+#include "body/BodyStateSnapshot.h"
 #include "shape/CollisionShape3D.h"
 
 namespace urchin
@@ -29,15 +31,25 @@ namespace urchin
 			void setNeedFullRefresh(bool);
 			bool needFullRefresh() const;
 
+			void setNeedUpdate(bool);
+			bool needUpdate() const;
+
+			void setStateSnapshot(const BodyStateSnapshot *);
+			void setStateIndex(unsigned int);
+			unsigned int getStateIndex() const;
+			void captureTransformVersion();
+			void publishState();
+
 			virtual AbstractWorkBody *createWorkBody() const = 0;
 			void setWorkBody(AbstractWorkBody *);
 			AbstractWorkBody *getWorkBody() const;
 
 			virtual void updateTo(AbstractWorkBody *);
-			virtual bool applyFrom(const AbstractWorkBody *);
+			virtual void applyFrom(const AbstractWorkBody *, BodyState &);
 
 			void setTransform(const Transform<float> &);
 			Transform<float> getTransform() const;
+			Transform<float> getInterpolatedTransform(float) const;
 			bool isManuallyMovedAndResetFlag();
 
 			void setShape(const std::shared_ptr<const CollisionShape3D> &);
@@ -57,6 +69,11 @@ namespace urchin
 			float getCcdMotionThreshold() const;
 			void setCcdMotionThreshold(float);
 
+			void setCollisionGroup(std::uint32_t);
+			std::uint32_t getCollisionGroup() const;
+			void setCollisionMask(std::uint32_t);
+			std::uint32_t getCollisionMask() const;
+
 			bool isStatic() const;
 			bool isActive() const;
 
@@ -66,6 +83,7 @@ namespace urchin
 			Vector3<float> computeScaledShapeLocalInertia(float) const;
 
 			void setIsStatic(bool);
+			bool readState(BodyState &) const;
 
 			//mutex for attributes modifiable from external
 			mutable std::mutex bodyMutex;
@@ -76,10 +94,19 @@ namespace urchin
 			std::atomic_bool bIsNew;
 			std::atomic_bool bIsDeleted;
 			std::atomic_bool bNeedFullRefresh;
+			std::atomic_bool bNeedUpdate;
 			AbstractWorkBody *workBody;
 
+			//state snapshot data
+			const BodyStateSnapshot *stateSnapshot;
+			unsigned int stateIndex; //physics thread only
+			unsigned int workTransformVersion; //physics thread only
+			std::atomic_uint publishedStateIndex;
+			std::atomic_uint publishedTransformVersion;
+
 			//body representation data
 			Transform<float> transform;
+			std::atomic_uint transformVersion;
 			bool isManuallyMoved;
 
 			//body description data
@@ -90,6 +117,8 @@ namespace urchin
 			float friction;
 			float rollingFriction;
 			float ccdMotionThreshold;
+			std::uint32_t collisionGroup;
+			std::uint32_t collisionMask;
 
 			//state flags
 			std::atomic_bool bIsStatic;
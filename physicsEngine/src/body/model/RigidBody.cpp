@@ -92,37 +92,42 @@ namespace urchin
 		}
 	}
 
-	bool RigidBody::applyFrom(const AbstractWorkBody *workBody)
+	void RigidBody::applyFrom(const AbstractWorkBody *workBody, BodyState &state)
 	{
-		std::lock_guard<std::mutex> lock(bodyMutex);
-
-		bool fullRefreshRequested = AbstractBody::applyFrom(workBody);
-        const WorkRigidBody *workRigidBody = WorkRigidBody::upCast(workBody);
+		AbstractBody::applyFrom(workBody, state);
 
-		if(workRigidBody && !fullRefreshRequested)
+		const WorkRigidBody *workRigidBody = WorkRigidBody::upCast(workBody);
+		if(workRigidBody)
 		{
-            mass = workRigidBody->getMass();
-            refreshMassProperties();
-
-			linearVelocity = workRigidBody->getLinearVelocity();
-			angularVelocity = workRigidBody->getAngularVelocity();
+			state.linearVelocity = workRigidBody->getLinearVelocity();
+			state.angularVelocity = workRigidBody->getAngularVelocity();
 		}
-
-		return fullRefreshRequested;
 	}
 
+	/**
+	 * @return Linear velocity of the last published snapshot
+	 */
 	Vector3<float> RigidBody::getLinearVelocity() const
 	{
-		std::lock_guard<std::mutex> lock(bodyMutex);
-
-		return linearVelocity;
+		BodyState state;
+		if(readState(state))
+		{
+			return state.linearVelocity;
+		}
+		return Vector3<float>(0.0f, 0.0f, 0.0f);
 	}
 
+	/**
+	 * @return Angular velocity of the last published snapshot
+	 */
 	Vector3<float> RigidBody::getAngularVelocity() const
 	{
-		std::lock_guard<std::mutex> lock(bodyMutex);
-
-		return angularVelocity;
+		BodyState state;
+		if(readState(state))
+		{
+			return state.angularVelocity;
+		}
+		return Vector3<float>(0.0f, 0.0f, 0.0f);
 	}
 
 	Vector3<float> RigidBody::getTotalMomentum() const
@@ -137,6 +142,7 @@ namespace urchin
 		std::lock_guard<std::mutex> lock(bodyMutex);
 
 		totalMomentum += momentum;
+		this->setNeedUpdate(true);
 	}
 
 	void RigidBody::applyMomentum(const Vector3<float> &momentum, const Point3<float> &pos)
@@ -148,6 +154,7 @@ namespace urchin
 
 		//apply torque
 		totalTorqueMomentum += pos.toVector().crossProduct(momentum);
+		this->setNeedUpdate(true);
 	}
 
 	Vector3<float> RigidBody::getTotalTorqueMomentum() const
@@ -162,6 +169,7 @@ namespace urchin
 		std::lock_guard<std::mutex> lock(bodyMutex);
 
 		totalTorqueMomentum += torqueMomentum;
+		this->setNeedUpdate(true);
 	}
 
 	void RigidBody::setMass(float mass)
@@ -208,6 +216,7 @@ namespace urchin
 
 		this->linearDamping = linearDamping;
 		this->angularDamping = angularDamping;
+		this->setNeedUpdate(true);
 	}
 
 	float RigidBody::getLinearDamping() const
@@ -232,6 +241,7 @@ namespace urchin
 		std::lock_guard<std::mutex> lock(bodyMutex);
 
 		this->linearFactor = linearFactor;
+		this->setNeedUpdate(true);
 	}
 
 	/**
@@ -252,6 +262,7 @@ namespace urchin
 		std::lock_guard<std::mutex> lock(bodyMutex);
 
 		this->angularFactor = angularFactor;
+		this->setNeedUpdate(true);
 	}
 
 	/**
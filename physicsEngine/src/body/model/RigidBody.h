@@ -21,7 +21,7 @@ namespace urchin
 			AbstractWorkBody *createWorkBody() const override;
 
 			void updateTo(AbstractWorkBody *) override;
-			bool applyFrom(const AbstractWorkBody *) override;
+			void applyFrom(const AbstractWorkBody *, BodyState &) override;
 
 			Vector3<float> getLinearVelocity() const;
 			Vector3<float> getAngularVelocity() const;
@@ -53,9 +53,6 @@ namespace urchin
 			void refreshLocalInertia();
 
 			//rigid body representation data
-			Vector3<float> linearVelocity;
-			Vector3<float> angularVelocity;
-
 			Vector3<float> totalMomentum;
 			Vector3<float> totalTorqueMomentum;
 
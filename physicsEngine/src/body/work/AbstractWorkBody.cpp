@@ -2,11 +2,15 @@
 
 #include "body/work/AbstractWorkBody.h"
 #include "collision/broadphase/PairContainer.h"
+#include "body/ActiveBodies.h"
+#include "body/StaticStateChanges.h"
 
 namespace urchin
 {
 
 	//static
+	const std::uint32_t AbstractWorkBody::DEFAULT_COLLISION_GROUP = 1;
+	const std::uint32_t AbstractWorkBody::ALL_COLLISION_GROUPS = 0xFFFFFFFF;
 	uint_fast32_t AbstractWorkBody::nextObjectId = 0;
 	bool AbstractWorkBody::bDisableAllBodies = false;
 
@@ -18,14 +22,27 @@ namespace urchin
 			friction(0.0f),
 			rollingFriction(0.0f),
 			ccdMotionThreshold(0.0f),
+			collisionGroup(DEFAULT_COLLISION_GROUP),
+			collisionMask(ALL_COLLISION_GROUPS),
 			bIsStatic(true),
+			staticStateChanges(nullptr),
 			bIsActive(false),
+			activeBodies(nullptr),
+			activeBodyIndex(ActiveBodies::NO_ACTIVE_INDEX),
 			islandElementId(0),
 			objectId(nextObjectId++)
 	{
 
 	}
 
+	AbstractWorkBody::~AbstractWorkBody()
+	{
+		if(activeBodies && activeBodyIndex!=ActiveBodies::NO_ACTIVE_INDEX)
+		{
+			activeBodies->removeBody(this);
+		}
+	}
+
 	const PhysicsTransform &AbstractWorkBody::getPhysicsTransform() const
 	{
 		return physicsTransform;
@@ -126,6 +143,40 @@ namespace urchin
 		this->ccdMotionThreshold = ccdMotionThreshold;
 	}
 
+	/**
+	 * @param collisionGroup Groups of the body (one bit by group)
+	 */
+	void AbstractWorkBody::setCollisionGroup(std::uint32_t collisionGroup)
+	{
+		this->collisionGroup = collisionGroup;
+	}
+
+	std::uint32_t AbstractWorkBody::getCollisionGroup() const
+	{
+		return collisionGroup;
+	}
+
+	/**
+	 * @param collisionMask Groups of bodies colliding with the body (one bit by group)
+	 */
+	void AbstractWorkBody::setCollisionMask(std::uint32_t collisionMask)
+	{
+		this->collisionMask = collisionMask;
+	}
+
+	std::uint32_t AbstractWorkBody::getCollisionMask() const
+	{
+		return collisionMask;
+	}
+
+	/**
+	 * @return True when each body belongs to a group of the mask of the other body
+	 */
+	bool AbstractWorkBody::canCollideWith(const AbstractWorkBody *otherBody) const
+	{
+		return (collisionGroup & otherBody->getCollisionMask())!=0 && (otherBody->getCollisionGroup() & collisionMask)!=0;
+	}
+
 	PairContainer *AbstractWorkBody::getPairContainer() const
 	{
 		return nullptr;
@@ -149,9 +200,21 @@ namespace urchin
 	 */
 	void AbstractWorkBody::setIsStatic(bool bIsStatic)
 	{
+		if(staticStateChanges && this->bIsStatic!=bIsStatic)
+		{
+			staticStateChanges->addBody(this);
+		}
 		this->bIsStatic = bIsStatic;
 	}
 
+	/**
+	 * @param staticStateChanges List of bodies filled by the body when its static state changes or null
+	 */
+	void AbstractWorkBody::setStaticStateChanges(StaticStateChanges *staticStateChanges)
+	{
+		this->staticStateChanges = staticStateChanges;
+	}
+
 	/**
 	 * @return True when body is active (body has velocity and/or one of body in same island is active)
 	 */
@@ -167,9 +230,43 @@ namespace urchin
 	{
 	    assert(!(bIsActive && bIsStatic)); //an active body cannot be static
 
+		if(activeBodies && this->bIsActive!=bIsActive)
+		{
+			if(bIsActive)
+			{
+				activeBodies->addBody(this);
+			}else
+			{
+				activeBodies->removeBody(this);
+			}
+		}
 		this->bIsActive = bIsActive;
 	}
 
+	/**
+	 * @param activeBodies List of active bodies maintained by the body when its active state changes
+	 */
+	void AbstractWorkBody::setActiveBodies(ActiveBodies *activeBodies)
+	{
+		assert(this->activeBodies==nullptr);
+
+		this->activeBodies = activeBodies;
+		if(bIsActive)
+		{
+			activeBodies->addBody(this);
+		}
+	}
+
+	void AbstractWorkBody::setActiveBodyIndex(unsigned int activeBodyIndex)
+	{
+		this->activeBodyIndex = activeBodyIndex;
+	}
+
+	unsigned int AbstractWorkBody::getActiveBodyIndex() const
+	{
+		return activeBodyIndex;
+	}
+
 	void AbstractWorkBody::setIslandElementId(unsigned int islandElementId)
 	{
 		this->islandElementId = islandElementId;
@@ -14,6 +14,8 @@ namespace urchin
 {
 
 	class PairContainer;
+	class ActiveBodies;
+	class StaticStateChanges;
 
 	/**
 	* A work body is copy of the body. This copy is useful when working on concurrent environment in order to avoid
@@ -22,8 +24,11 @@ namespace urchin
 	class AbstractWorkBody : public IslandElement
 	{
 		public:
+			static const std::uint32_t DEFAULT_COLLISION_GROUP;
+			static const std::uint32_t ALL_COLLISION_GROUPS;
+
 			AbstractWorkBody(std::string , const PhysicsTransform &, std::shared_ptr<const CollisionShape3D> );
-			~AbstractWorkBody() override = default;
+			~AbstractWorkBody() override;
 
 			const PhysicsTransform &getPhysicsTransform() const;
 
@@ -45,15 +50,26 @@ namespace urchin
 			float getCcdMotionThreshold() const;
 			void setCcdMotionThreshold(float);
 
+			void setCollisionGroup(std::uint32_t);
+			std::uint32_t getCollisionGroup() const;
+			void setCollisionMask(std::uint32_t);
+			std::uint32_t getCollisionMask() const;
+			bool canCollideWith(const AbstractWorkBody *) const;
+
             virtual PairContainer *getPairContainer() const;
 
 			static void disableAllBodies(bool);
 			bool isStatic() const;
             virtual void setIsStatic(bool);
+			void setStaticStateChanges(StaticStateChanges *);
 			bool isActive() const override;
 			void setIsActive(bool);
 			virtual bool isGhostBody() const = 0;
 
+			void setActiveBodies(ActiveBodies *);
+			void setActiveBodyIndex(unsigned int);
+			unsigned int getActiveBodyIndex() const;
+
 			void setIslandElementId(unsigned int) override;
 			unsigned int getIslandElementId() const override;
 
@@ -68,11 +84,16 @@ namespace urchin
 			float friction;
 			float rollingFriction;
 			float ccdMotionThreshold;
+			std::uint32_t collisionGroup;
+			std::uint32_t collisionMask;
 
 			//state flags
 			static bool bDisableAllBodies;
 			bool bIsStatic;
+			StaticStateChanges *staticStateChanges;
 			bool bIsActive;
+			ActiveBodies *activeBodies;
+			unsigned int activeBodyIndex;
 
 			//island
 			unsigned int islandElementId;
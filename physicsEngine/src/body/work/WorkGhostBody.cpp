@@ -35,6 +35,11 @@ namespace urchin
 		return pairContainer;
 	}
 
+	const SyncVectorPairContainer *WorkGhostBody::getSyncPairContainer() const
+	{
+		return pairContainer;
+	}
+
 	bool WorkGhostBody::isGhostBody() const
 	{
 		return true;
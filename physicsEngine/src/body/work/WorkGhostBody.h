@@ -8,6 +8,8 @@
 namespace urchin
 {
 
+	class SyncVectorPairContainer;
+
 	/**
 	* A ghost body don't act with the physics world but it's able to known which bodies are in collision with it.
 	*/
@@ -21,11 +23,12 @@ namespace urchin
 			static const WorkGhostBody *upCast(const AbstractWorkBody *);
 
 			PairContainer *getPairContainer() const override;
+			const SyncVectorPairContainer *getSyncPairContainer() const;
 
 			bool isGhostBody() const override;
 
 		private:
-			PairContainer *pairContainer;
+			SyncVectorPairContainer *pairContainer;
 
 	};
 
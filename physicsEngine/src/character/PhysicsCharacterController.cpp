@@ -5,6 +5,7 @@
 #include "PhysicsCharacterController.h"
 #include "collision/ManifoldContactPoint.h"
 #include "PhysicsWorld.h"
+#include "object/TemporalObject.h"
 
 #define MAX_TIME_IN_AIR_CONSIDERED_AS_ON_GROUND 0.15f
 
@@ -16,6 +17,7 @@ namespace urchin
 		percentageControlInAir(ConfigService::instance()->getFloatValue("character.percentageControlInAir")),
         maxDepthToRecover(ConfigService::instance()->getFloatValue("character.maxDepthToRecover")),
         maxVerticalSpeed(ConfigService::instance()->getFloatValue("character.maxVerticalSpeed")),
+        skinWidth(ConfigService::instance()->getFloatValue("character.skinWidth")),
         physicsCharacter(physicsCharacter),
         physicsWorld(physicsWorld),
 		ghostBody(new WorkGhostBody(physicsCharacter->getName(), physicsCharacter->getTransform(), physicsCharacter->getShape())),
@@ -27,7 +29,8 @@ namespace urchin
 		hitRoof(false),
 		timeInTheAir(0.0f),
 		jumping(false),
-		slopeInPercentage(0.0f)
+		slopeInPercentage(0.0f),
+		batchContactValues(resetSignificantContactValues())
 	{
 	    if(!physicsWorld)
         {
@@ -75,12 +78,17 @@ namespace urchin
 		ScopeProfiler profiler("physics", "charactCtrlExec");
 
 		//setup values
-		setup(dt);
+		setup(dt, physicsWorld->getGravity());
 
 		//recover from penetration
 		recoverFromPenetration(dt);
 
-		//compute values
+		//compute values and apply them on character
+		applyMove();
+	}
+
+	void PhysicsCharacterController::applyMove()
+	{
 		slopeInPercentage = 0.0f;
 		if(isOnGround)
 		{
@@ -96,7 +104,10 @@ namespace urchin
         physicsCharacter->updateTransform(ghostBody->getPhysicsTransform());
 	}
 
-	void PhysicsCharacterController::setup(float dt)
+	/**
+	 * @param gravity Gravity expressed in units/s^2
+	 */
+	void PhysicsCharacterController::setup(float dt, const Vector3<float> &gravity)
 	{
 		//save values
 		previousBodyPosition = ghostBody->getPosition();
@@ -136,7 +147,7 @@ namespace urchin
 		//compute gravity velocity
 		if(!isOnGround || numberOfHit > 1)
 		{
-			verticalSpeed -= (-physicsWorld->getGravity().Y) * dt;
+			verticalSpeed -= (-gravity.Y) * dt;
 			if(verticalSpeed < -maxVerticalSpeed)
 			{
 				verticalSpeed = -maxVerticalSpeed;
@@ -191,6 +202,115 @@ namespace urchin
 		computeSignificantContactValues(significantContactValues, dt);
 	}
 
+	/**
+	 * Move the ghost body between two positions. When an obstacle is hit, the character stops on it and slides along it with the remaining move.
+	 * Other characters are not considered as obstacles: penetrations between characters are recovered thanks to the contacts.
+	 */
+	void PhysicsCharacterController::sweepAndSlide(const Point3<float> &from, const Point3<float> &to)
+	{
+		const CollisionShape3D *characterShape = ghostBody->getShape();
+		if(!characterShape->isConvex())
+		{ //sweep test only supported on convex shape
+			ghostBody->setPosition(to);
+			return;
+		}
+
+		Point3<float> position = from;
+		Vector3<float> remainingMove = from.vector(to);
+		for(unsigned int slideIndex=0; slideIndex<SWEEP_SLIDE_ITERATIONS; ++slideIndex)
+		{
+			if(remainingMove.squareLength() < std::numeric_limits<float>::epsilon())
+			{
+				break;
+			}
+
+			PhysicsTransform fromTransform(position, ghostBody->getOrientation());
+			PhysicsTransform toTransform(position.translate(remainingMove), ghostBody->getOrientation());
+
+			sweepBodies.clear();
+			for(auto body : physicsWorld->getCollisionWorld()->getBroadPhaseManager()->bodyTest(ghostBody, fromTransform, toTransform))
+			{
+				if(!body->isGhostBody())
+				{
+					sweepBodies.push_back(body);
+				}
+			}
+
+			float timeToHit = 1.0f;
+			Vector3<float> obstacleNormal;
+			if(!sweepBodies.empty())
+			{
+				TemporalObject temporalObject(characterShape, fromTransform, toTransform);
+				ccd_set sweepResults = physicsWorld->getCollisionWorld()->getNarrowPhaseManager()->continuousCollisionTest(temporalObject, sweepBodies, false);
+				for(const auto &sweepResult : sweepResults)
+				{ //initial penetrations (time to hit at zero) are ignored: they are recovered thanks to the contacts
+					if(sweepResult->getTimeToHit() > 0.0f && sweepResult->getNormalFromObject2().dotProduct(remainingMove) < 0.0f)
+					{
+						timeToHit = sweepResult->getTimeToHit();
+						obstacleNormal = sweepResult->getNormalFromObject2();
+						break;
+					}
+				}
+			}
+
+			position = position.translate(remainingMove * timeToHit);
+			if(timeToHit==1.0f)
+			{
+				break;
+			}
+
+			remainingMove *= (1.0f - timeToHit);
+			remainingMove -= obstacleNormal * obstacleNormal.dotProduct(remainingMove);
+		}
+
+		ghostBody->setPosition(position);
+	}
+
+	/**
+	 * Compute the move recovering the character from penetrations thanks to the contacts at its current position: character is moved away
+	 * from the obstacles up to the skin width. Thus, the next sweep test doesn't start in contact. The ghost body is not moved: contacts of
+	 * other characters can be computed concurrently.
+	 */
+	void PhysicsCharacterController::computeRecoverFromContacts()
+	{
+		batchContactValues = resetSignificantContactValues();
+		recoverVector.setNull();
+
+		manifoldResults.clear();
+		physicsWorld->getCollisionWorld()->getNarrowPhaseManager()->processGhostBodyFromPhysicsThread(ghostBody, manifoldResults);
+
+		for(const auto &manifoldResult : manifoldResults)
+		{
+			float sign = manifoldResult.getBody1()==ghostBody ? -1.0 : 1.0;
+			for(unsigned int i=0; i<manifoldResult.getNumContactPoints(); ++i)
+			{
+				const ManifoldContactPoint &manifoldContactPoint = manifoldResult.getManifoldContactPoint(i);
+				float depth = manifoldContactPoint.getDepth();
+				Vector3<float> normal = manifoldContactPoint.getNormalFromObject2() * sign;
+
+				//character is kept at skin width of the obstacles: all contacts are significant
+				saveSignificantContactValues(batchContactValues, normal);
+
+				if(depth < skinWidth)
+				{ //recover only the depth not already recovered by the previous contacts
+					Vector3<float> recoverDirection = -normal;
+					float depthToRecover = (skinWidth - depth) - recoverVector.dotProduct(recoverDirection);
+					if(depthToRecover > 0.0f)
+					{
+						recoverVector += recoverDirection * depthToRecover;
+					}
+				}
+			}
+		}
+	}
+
+	void PhysicsCharacterController::applyRecoverFromContacts(float dt)
+	{
+		ghostBody->setPosition(ghostBody->getPosition().translate(recoverVector));
+
+		computeSignificantContactValues(batchContactValues, dt);
+	}
+
 	SignificantContactValues PhysicsCharacterController::resetSignificantContactValues()
 	{
 		SignificantContactValues significantContactValues;
@@ -11,6 +11,7 @@
 #include "collision/ManifoldResult.h"
 
 #define RECOVER_PENETRATION_SUB_STEPS 4 //number of steps to recover character from penetration
+#define SWEEP_SLIDE_ITERATIONS 3 //number of slides on obstacles for a character move of batched update
 #define MIN_WALK_SPEED_PERCENTAGE 0.75f
 #define MAX_WALK_SPEED_PERCENTAGE 1.25f
 
@@ -33,6 +34,8 @@ namespace urchin
 	*/
 	class PhysicsCharacterController
 	{
+		friend class PhysicsCharacterControllerBatch;
+
 		public:
 			PhysicsCharacterController(const std::shared_ptr<PhysicsCharacter> &, PhysicsWorld *);
 			~PhysicsCharacterController();
@@ -43,7 +46,8 @@ namespace urchin
 			void update(float);
 
 		private:
-			void setup(float);
+			void setup(float, const Vector3<float> &);
+			void applyMove();
 
 			Vector3<float> getVelocity() const;
 			bool needJumpAndResetFlag();
@@ -55,11 +59,16 @@ namespace urchin
 
 			float computeSlope();
 
+			void sweepAndSlide(const Point3<float> &, const Point3<float> &);
+			void computeRecoverFromContacts();
+			void applyRecoverFromContacts(float);
+
 			const float recoverFactors[RECOVER_PENETRATION_SUB_STEPS] = {0.4, 0.7, 0.9, 1.0};
 			const float timeKeepMoveInAir;
             const float percentageControlInAir;
 			const float maxDepthToRecover;
 			const float maxVerticalSpeed;
+			const float skinWidth;
 
             std::shared_ptr<PhysicsCharacter> physicsCharacter;
 			PhysicsWorld *physicsWorld;
@@ -80,6 +89,11 @@ namespace urchin
 			float timeInTheAir; //time (sec.) character is not on the ground
 			bool jumping; //character is jumping
 			float slopeInPercentage; //slope in percentage (a positive value means that character climb)
+
+			//buffers of batched update (see PhysicsCharacterControllerBatch)
+			std::vector<AbstractWorkBody *> sweepBodies;
+			Vector3<float> recoverVector;
+			SignificantContactValues batchContactValues;
 	};
 
 }
@@ -0,0 +1,118 @@
+#include <algorithm>
+
+#include "character/PhysicsCharacterControllerBatch.h"
+
+namespace urchin
+{
+
+	//static
+	const unsigned int PhysicsCharacterControllerBatch::MIN_CHARACTERS_BY_THREAD = 8;
+
+	PhysicsCharacterControllerBatch::PhysicsCharacterControllerBatch() :
+			PhysicsCharacterControllerBatch(ConfigService::instance()->getUnsignedIntValue("character.numberOfThreads"))
+	{
+
+	}
+
+	/**
+	 * @param numberOfThreads Number of threads updating the characters (1: characters updated by physics thread only)
+	 */
+	PhysicsCharacterControllerBatch::PhysicsCharacterControllerBatch(unsigned int numberOfThreads) :
+			threadPool(new ThreadPool(numberOfThreads))
+	{
+
+	}
+
+	PhysicsCharacterControllerBatch::~PhysicsCharacterControllerBatch()
+	{
+		delete threadPool;
+	}
+
+	void PhysicsCharacterControllerBatch::addCharacterController(const std::shared_ptr<PhysicsCharacterController> &characterController)
+	{
+		std::lock_guard<std::mutex> lock(mutex);
+
+		characterControllers.push_back(characterController);
+	}
+
+	void PhysicsCharacterControllerBatch::removeCharacterController(const std::shared_ptr<PhysicsCharacterController> &characterController)
+	{
+		std::lock_guard<std::mutex> lock(mutex);
+
+		auto itFind = std::find(characterControllers.begin(), characterControllers.end(), characterController);
+		if(itFind!=characterControllers.end())
+		{
+			characterControllers.erase(itFind);
+		}
+	}
+
+	void PhysicsCharacterControllerBatch::initialize(PhysicsWorld *)
+	{
+		//nothing to do
+	}
+
+	void PhysicsCharacterControllerBatch::setup(float, const Vector3<float> &)
+	{
+		//nothing to do
+	}
+
+	/**
+	 * @param dt Delta of time between two simulation steps
+	 * @param gravity Gravity expressed in units/s^2
+	 */
+	void PhysicsCharacterControllerBatch::execute(float dt, const Vector3<float> &gravity)
+	{
+		ScopeProfiler profiler("physics", "charactBatchExec");
+
+		copiedCharacterControllers.clear();
+		{
+			std::lock_guard<std::mutex> lock(mutex);
+			copiedCharacterControllers = characterControllers;
+		}
+
+		//1. move each character: ghost bodies of the other characters are not read
+		processCharacterControllers([dt, &gravity](PhysicsCharacterController *characterController) {
+			characterController->setup(dt, gravity);
+			characterController->sweepAndSlide(characterController->previousBodyPosition, characterController->ghostBody->getPosition());
+		});
+
+		//2. compute recover of each character: ghost bodies are read but not moved
+		processCharacterControllers([](PhysicsCharacterController *characterController) {
+			characterController->computeRecoverFromContacts();
+		});
+
+		//3. apply recover and new transform on each character
+		for(const auto &characterController : copiedCharacterControllers)
+		{
+			characterController->applyRecoverFromContacts(dt);
+			characterController->applyMove();
+		}
+	}
+
+	void PhysicsCharacterControllerBatch::processCharacterControllers(const std::function<void(PhysicsCharacterController *)> &characterControllerProcess)
+	{
+		std::size_t numberOfCharacters = copiedCharacterControllers.size();
+		auto numberOfTasks = static_cast<unsigned int>(std::min(static_cast<std::size_t>(threadPool->getNumberOfThreads()),
+				(numberOfCharacters + MIN_CHARACTERS_BY_THREAD - 1) / MIN_CHARACTERS_BY_THREAD));
+
+		if(numberOfTasks <= 1)
+		{
+			for(const auto &characterController : copiedCharacterControllers)
+			{
+				characterControllerProcess(characterController.get());
+			}
+			return;
+		}
+
+		//each thread processes a contiguous range of characters
+		threadPool->parallelFor(numberOfTasks, [&](unsigned int taskIndex){
+			std::size_t beginIndex = (numberOfCharacters * taskIndex) / numberOfTasks;
+			std::size_t endIndex = (numberOfCharacters * (taskIndex + 1)) / numberOfTasks;
+			for(std::size_t i=beginIndex; i<endIndex; ++i)
+			{
+				characterControllerProcess(copiedCharacterControllers[i].get());
+			}
+		});
+	}
+
+}
@@ -0,0 +1,50 @@
+#ifndef URCHINENGINE_PHYSICSCHARACTERCONTROLLERBATCH_H
+#define URCHINENGINE_PHYSICSCHARACTERCONTROLLERBATCH_H
+
+#include <memory>
+#include <functional>
+#include <mutex>
+#include <vector>
+#include "UrchinCommon.h"
+
+#include "character/PhysicsCharacterController.h"
+#include "processable/Processable.h"
+
+namespace urchin
+{
+
+	/**
+	* Update all the character controllers of a physics world in one batch, in the physics thread after the collision world process.
+	* Characters are moved with a sweep and slide test, then recovered from penetrations thanks to the contacts of their ghost body.
+	* Each step is processed concurrently on the characters. A character controller added in a batch must not be updated by
+	* PhysicsCharacterController::update().
+	*/
+	class PhysicsCharacterControllerBatch : public Processable
+	{
+		public:
+			PhysicsCharacterControllerBatch();
+			explicit PhysicsCharacterControllerBatch(unsigned int);
+			~PhysicsCharacterControllerBatch() override;
+
+			void addCharacterController(const std::shared_ptr<PhysicsCharacterController> &);
+			void removeCharacterController(const std::shared_ptr<PhysicsCharacterController> &);
+
+			void initialize(PhysicsWorld *) override;
+
+			void setup(float, const Vector3<float> &) override;
+			void execute(float, const Vector3<float> &) override;
+
+		private:
+			void processCharacterControllers(const std::function<void(PhysicsCharacterController *)> &);
+
+			static const unsigned int MIN_CHARACTERS_BY_THREAD;
+			ThreadPool *const threadPool;
+
+			std::mutex mutex;
+			std::vector<std::shared_ptr<PhysicsCharacterController>> characterControllers;
+			std::vector<std::shared_ptr<PhysicsCharacterController>> copiedCharacterControllers;
+	};
+
+}
+
+#endif
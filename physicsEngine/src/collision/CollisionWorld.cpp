@@ -1,17 +1,43 @@
 #include <vector>
+#include <cstdint>
+#include <stdexcept>
+#include <string>
 
 #include "collision/CollisionWorld.h"
 #include "collision/OverlappingPair.h"
+#include "statistics/ScopeThreadStatistics.h"
 
 namespace urchin
 {
 
 	CollisionWorld::CollisionWorld(BodyManager *bodyManager) :
+			CollisionWorld(bodyManager, true)
+	{
+
+	}
+
+	/**
+	 * @param useWorkerThreads Indicates whether the collision world can use its own worker threads. Worker threads should
+	 * not be used when several collision worlds are already processed in parallel.
+	 */
+	CollisionWorld::CollisionWorld(BodyManager *bodyManager, bool useWorkerThreads) :
+			CollisionWorld(bodyManager,
+					useWorkerThreads ? ConfigService::instance()->getUnsignedIntValue("narrowPhase.numberOfThreads") : 1,
+					useWorkerThreads ? ConfigService::instance()->getUnsignedIntValue("constraintSolver.numberOfThreads") : 1)
+	{
+
+	}
+
+	/**
+	 * @param numberOfNarrowPhaseThreads Number of threads processing the overlapping pairs (see 'narrowPhase.numberOfThreads')
+	 * @param numberOfConstraintSolverThreads Number of threads solving the islands (see 'constraintSolver.numberOfThreads')
+	 */
+	CollisionWorld::CollisionWorld(BodyManager *bodyManager, unsigned int numberOfNarrowPhaseThreads, unsigned int numberOfConstraintSolverThreads) :
 			bodyManager(bodyManager),
 			broadPhaseManager(new BroadPhaseManager(bodyManager)),
-			narrowPhaseManager(new NarrowPhaseManager(bodyManager, broadPhaseManager)),
+			narrowPhaseManager(new NarrowPhaseManager(bodyManager, broadPhaseManager, numberOfNarrowPhaseThreads)),
 			integrateVelocityManager(new IntegrateVelocityManager(bodyManager)),
-			constraintSolverManager(new ConstraintSolverManager()),
+			constraintSolverManager(new ConstraintSolverManager(numberOfConstraintSolverThreads)),
 			islandManager(new IslandManager(bodyManager)),
 			integrateTransformManager(new IntegrateTransformManager(bodyManager, broadPhaseManager, narrowPhaseManager))
 	{
@@ -46,6 +72,8 @@ namespace urchin
 	void CollisionWorld::process(float dt, const Vector3<float> &gravity)
 	{
 		ScopeProfiler profiler("physics", "colWorldProc");
+		statistics.reset();
+		ScopeThreadStatistics scopeThreadStatistics(&statistics);
 
 		//initialize work bodies from bodies
 		bodyManager->setupWorkBodies();
@@ -70,6 +98,26 @@ namespace urchin
 
 		//apply work bodies to bodies
 		bodyManager->applyWorkBodies();
+
+		completeStatistics(overlappingPairs);
+	}
+
+	/**
+	 * Counters of the narrow phase algorithms are recorded during the process. Other counters are read at the end of the process.
+	 */
+	void CollisionWorld::completeStatistics(const std::vector<OverlappingPair *> &overlappingPairs)
+	{
+		statistics.bodies = static_cast<unsigned int>(bodyManager->getWorkBodies().size());
+		for(const auto &workBody : bodyManager->getActiveWorkBodies())
+		{
+			if(workBody->isActive())
+			{
+				statistics.awakeBodies++;
+			}
+		}
+		statistics.overlappingPairs = static_cast<unsigned int>(overlappingPairs.size());
+		statistics.contactsSolved = constraintSolverManager->getNumberOfConstraints();
+		statistics.algorithmPool = narrowPhaseManager->getAlgorithmPoolStatistics();
 	}
 
 	const std::vector<ManifoldResult> &CollisionWorld::getLastUpdatedManifoldResults()
@@ -77,4 +125,190 @@ namespace urchin
 		return manifoldResults;
 	}
 
+	/**
+	 * @return Counters of the last process
+	 */
+	const PhysicsStatistics &CollisionWorld::getStatistics() const
+	{
+		return statistics;
+	}
+
+	/**
+	 * Captures the state of the bodies and the persistent contact points in the snapshot. Must be called while the
+	 * collision world is not processed.
+	 */
+	void CollisionWorld::captureSnapshot(PhysicsWorldSnapshot &snapshot)
+	{
+		ScopeProfiler profiler("physics", "captureSnapshot");
+
+		snapshot.clear();
+		bodyManager->captureBodies(snapshot);
+
+		refreshSnapshotBodyIndices();
+		const std::vector<OverlappingPair *> &overlappingPairs = broadPhaseManager->getOverlappingPairs();
+		std::uint32_t manifoldsCount = 0;
+		for(const auto &overlappingPair : overlappingPairs)
+		{
+			if(isSnapshotManifold(overlappingPair))
+			{
+				manifoldsCount++;
+			}
+		}
+
+		snapshot.writeUnsignedInt(manifoldsCount);
+		for(const auto &overlappingPair : overlappingPairs)
+		{
+			if(isSnapshotManifold(overlappingPair))
+			{
+				const ManifoldResult &manifoldResult = overlappingPair->getCollisionAlgorithm()->getConstManifoldResult();
+				snapshot.writeUnsignedInt(snapshotBodyIndices.at(manifoldResult.getBody1()));
+				snapshot.writeUnsignedInt(snapshotBodyIndices.at(manifoldResult.getBody2()));
+				snapshot.writeUnsignedInt(manifoldResult.getNumContactPoints());
+				for(unsigned int i=0; i<manifoldResult.getNumContactPoints(); ++i)
+				{
+					writeContactPoint(snapshot, manifoldResult.getManifoldContactPoint(i));
+				}
+			}
+		}
+	}
+
+	/**
+	 * Restores in place the state of the bodies and the persistent contact points from the snapshot. Bodies are kept in
+	 * the broad phase but reinserted with their restored transform: their pairs and collision algorithms are recreated
+	 * in the order of the bodies. Thus, the resimulation from a snapshot doesn't depend on the state preceding the
+	 * restoration. The snapshot is fully checked before any modification: an invalid snapshot leaves the world untouched.
+	 * Must be called while the collision world is not processed.
+	 */
+	void CollisionWorld::restoreSnapshot(const PhysicsWorldSnapshot &snapshot)
+	{
+		ScopeProfiler profiler("physics", "restoreSnapshot");
+
+		//check the whole snapshot and read manifolds location before any modification of the world
+		std::size_t offset = 0;
+		bodyManager->checkSnapshotBodies(snapshot, offset);
+		auto bodiesCount = static_cast<std::uint32_t>(bodyManager->getBodies().size());
+		snapshotManifoldOffsets.clear();
+		std::uint32_t manifoldsCount = snapshot.readUnsignedInt(offset);
+		for(std::uint32_t i=0; i<manifoldsCount; ++i)
+		{
+			std::size_t manifoldOffset = offset;
+			std::uint32_t bodyIndex1 = snapshot.readUnsignedInt(offset);
+			std::uint32_t bodyIndex2 = snapshot.readUnsignedInt(offset);
+			std::uint32_t contactPointsCount = snapshot.readUnsignedInt(offset);
+			if(bodyIndex1 >= bodiesCount || bodyIndex2 >= bodiesCount || contactPointsCount > MAX_PERSISTENT_POINTS)
+			{
+				throw std::invalid_argument("Invalid manifold in snapshot between bodies " + std::to_string(bodyIndex1) + " and " + std::to_string(bodyIndex2) + ".");
+			}
+			snapshotManifoldOffsets[computeSnapshotManifoldId(bodyIndex1, bodyIndex2)] = manifoldOffset;
+
+			for(std::uint32_t j=0; j<contactPointsCount; ++j)
+			{
+				readContactPoint(snapshot, offset, false);
+			}
+		}
+
+		//restore bodies
+		std::size_t bodiesOffset = 0;
+		bodyManager->restoreBodies(snapshot, bodiesOffset);
+		broadPhaseManager->reinsertBodies(bodyManager->getWorkBodies());
+		refreshSnapshotBodyIndices();
+
+		//restore manifolds of pairs
+		const std::vector<AbstractBody *> &bodies = bodyManager->getBodies();
+		for(const auto &overlappingPair : broadPhaseManager->getOverlappingPairs())
+		{
+			auto itBody1 = snapshotBodyIndices.find(overlappingPair->getBody1());
+			auto itBody2 = snapshotBodyIndices.find(overlappingPair->getBody2());
+			if(itBody1==snapshotBodyIndices.end() || itBody2==snapshotBodyIndices.end())
+			{
+				continue;
+			}
+
+			auto itManifold = snapshotManifoldOffsets.find(computeSnapshotManifoldId(itBody1->second, itBody2->second));
+			if(itManifold!=snapshotManifoldOffsets.end())
+			{
+				CollisionAlgorithm *collisionAlgorithm = narrowPhaseManager->retrieveCollisionAlgorithm(overlappingPair);
+
+				std::size_t manifoldOffset = itManifold->second;
+				std::uint32_t bodyIndex1 = snapshot.readUnsignedInt(manifoldOffset);
+				snapshot.readUnsignedInt(manifoldOffset);
+				bool bodiesSwapped = bodies[bodyIndex1]->getWorkBody()!=collisionAlgorithm->getConstManifoldResult().getBody1();
+
+				std::uint32_t contactPointsCount = snapshot.readUnsignedInt(manifoldOffset);
+				for(std::uint32_t j=0; j<contactPointsCount; ++j)
+				{
+					collisionAlgorithm->restoreContactPoint(readContactPoint(snapshot, manifoldOffset, bodiesSwapped));
+				}
+			}
+		}
+
+		manifoldResults.clear();
+		bodyManager->applyWorkBodies();
+	}
+
+	void CollisionWorld::refreshSnapshotBodyIndices()
+	{
+		const std::vector<AbstractBody *> &bodies = bodyManager->getBodies();
+
+		snapshotBodyIndices.clear();
+		snapshotBodyIndices.reserve(bodies.size());
+		for(std::size_t i=0; i<bodies.size(); ++i)
+		{
+			snapshotBodyIndices[bodies[i]->getWorkBody()] = static_cast<std::uint32_t>(i);
+		}
+	}
+
+	/**
+	 * @return True when the pair has contact points between two bodies of the body manager
+	 */
+	bool CollisionWorld::isSnapshotManifold(const OverlappingPair *overlappingPair) const
+	{
+		CollisionAlgorithm *collisionAlgorithm = overlappingPair->getCollisionAlgorithm();
+		return collisionAlgorithm && collisionAlgorithm->getConstManifoldResult().getNumContactPoints()!=0
+				&& snapshotBodyIndices.find(overlappingPair->getBody1())!=snapshotBodyIndices.end()
+				&& snapshotBodyIndices.find(overlappingPair->getBody2())!=snapshotBodyIndices.end();
+	}
+
+	uint_fast64_t CollisionWorld::computeSnapshotManifoldId(std::uint32_t bodyIndex1, std::uint32_t bodyIndex2)
+	{
+		return bodyIndex1 < bodyIndex2
+				? (static_cast<uint_fast64_t>(bodyIndex1) << 32u) | bodyIndex2
+				: (static_cast<uint_fast64_t>(bodyIndex2) << 32u) | bodyIndex1;
+	}
+
+	void CollisionWorld::writeContactPoint(PhysicsWorldSnapshot &snapshot, const ManifoldContactPoint &contactPoint)
+	{
+		snapshot.writeVector(contactPoint.getNormalFromObject2());
+		snapshot.writePoint(contactPoint.getPointOnObject1());
+		snapshot.writePoint(contactPoint.getPointOnObject2());
+		snapshot.writePoint(contactPoint.getLocalPointOnObject1());
+		snapshot.writePoint(contactPoint.getLocalPointOnObject2());
+		snapshot.writeFloat(contactPoint.getDepth());
+		snapshot.writeBool(contactPoint.isPredictive());
+		snapshot.writeFloat(contactPoint.getAccumulatedSolvingData().accNormalImpulse);
+		snapshot.writeFloat(contactPoint.getAccumulatedSolvingData().accTangentImpulse);
+	}
+
+	/**
+	 * @param bodiesSwapped Indicates whether the contact point must be expressed from the point of view of the other body
+	 */
+	ManifoldContactPoint CollisionWorld::readContactPoint(const PhysicsWorldSnapshot &snapshot, std::size_t &offset, bool bodiesSwapped)
+	{
+		Vector3<float> normalFromObject2 = snapshot.readVector(offset);
+		Point3<float> pointOnObject1 = snapshot.readPoint(offset);
+		Point3<float> pointOnObject2 = snapshot.readPoint(offset);
+		Point3<float> localPointOnObject1 = snapshot.readPoint(offset);
+		Point3<float> localPointOnObject2 = snapshot.readPoint(offset);
+		float depth = snapshot.readFloat(offset);
+		bool isPredictive = snapshot.readBool(offset);
+
+		ManifoldContactPoint contactPoint = bodiesSwapped
+				? ManifoldContactPoint(-normalFromObject2, pointOnObject2, pointOnObject1, localPointOnObject2, localPointOnObject1, depth, isPredictive)
+				: ManifoldContactPoint(normalFromObject2, pointOnObject1, pointOnObject2, localPointOnObject1, localPointOnObject2, depth, isPredictive);
+		contactPoint.getAccumulatedSolvingData().accNormalImpulse = snapshot.readFloat(offset);
+		contactPoint.getAccumulatedSolvingData().accTangentImpulse = snapshot.readFloat(offset);
+
+		return contactPoint;
+	}
+
 }
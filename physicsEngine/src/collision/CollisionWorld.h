@@ -1,6 +1,8 @@
 #ifndef URCHINENGINE_COLLISIONWORLD_H
 #define URCHINENGINE_COLLISIONWORLD_H
 
+#include <unordered_map>
+#include <cstdint>
 #include "UrchinCommon.h"
 
 #include "body/BodyManager.h"
@@ -11,6 +13,8 @@
 #include "collision/constraintsolver/ConstraintSolverManager.h"
 #include "collision/island/IslandManager.h"
 #include "collision/integration/IntegrateTransformManager.h"
+#include "snapshot/PhysicsWorldSnapshot.h"
+#include "statistics/PhysicsStatistics.h"
 
 namespace urchin
 {
@@ -22,6 +26,8 @@ namespace urchin
 	{
 		public:
 			explicit CollisionWorld(BodyManager *);
+			CollisionWorld(BodyManager *, bool);
+			CollisionWorld(BodyManager *, unsigned int, unsigned int);
 			~CollisionWorld() override;
 
 			enum NotificationType
@@ -35,8 +41,20 @@ namespace urchin
 			void process(float, const Vector3<float> &);
 
 			const std::vector<ManifoldResult> &getLastUpdatedManifoldResults();
+			const PhysicsStatistics &getStatistics() const;
+
+			void captureSnapshot(PhysicsWorldSnapshot &);
+			void restoreSnapshot(const PhysicsWorldSnapshot &);
 
 		private:
+			void completeStatistics(const std::vector<OverlappingPair *> &);
+
+			void refreshSnapshotBodyIndices();
+			bool isSnapshotManifold(const OverlappingPair *) const;
+			static uint_fast64_t computeSnapshotManifoldId(std::uint32_t, std::uint32_t);
+			static void writeContactPoint(PhysicsWorldSnapshot &, const ManifoldContactPoint &);
+			static ManifoldContactPoint readContactPoint(const PhysicsWorldSnapshot &, std::size_t &, bool);
+
 			BodyManager *bodyManager;
 
 			BroadPhaseManager *broadPhaseManager;
@@ -47,6 +65,11 @@ namespace urchin
 			IntegrateTransformManager *integrateTransformManager;
 
 			std::vector<ManifoldResult> manifoldResults;
+			PhysicsStatistics statistics;
+
+			//snapshot data
+			std::unordered_map<const AbstractWorkBody *, std::uint32_t> snapshotBodyIndices;
+			std::unordered_map<uint_fast64_t, std::size_t> snapshotManifoldOffsets;
 	};
 
 }
@@ -119,4 +119,9 @@ namespace urchin
 	{
 		return accumulatedSolvingData;
 	}
+
+	const AccumulatedSolvingData &ManifoldContactPoint::getAccumulatedSolvingData() const
+	{
+		return accumulatedSolvingData;
+	}
 }
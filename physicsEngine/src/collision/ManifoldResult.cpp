@@ -107,6 +107,16 @@ namespace urchin
 				localPointOnObject1, localPointOnObject2, depth, isPredictive);
 	}
 
+	/**
+	 * Adds the contact point without merging it with the existing contact points (e.g.: contact point restored from a snapshot)
+	 */
+	void ManifoldResult::restoreContactPoint(const ManifoldContactPoint &contactPoint)
+	{
+		assert(nbContactPoint < MAX_PERSISTENT_POINTS);
+
+		contactPoints[nbContactPoint++] = contactPoint;
+	}
+
 	void ManifoldResult::refreshContactPoints()
 	{
 		for(unsigned int i=0; i<nbContactPoint; ++i)
@@ -32,6 +32,7 @@ namespace urchin
 
 			void addContactPoint(const Vector3<float> &, const Point3<float> &, float, bool);
 			void addContactPoint(const Vector3<float> &, const Point3<float> &, const Point3<float> &, const Point3<float> &, const Point3<float> &, float, bool);
+			void restoreContactPoint(const ManifoldContactPoint &);
 			void refreshContactPoints();
 
 		private:
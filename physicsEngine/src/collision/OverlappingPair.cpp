@@ -71,14 +71,14 @@ namespace urchin
 		return bodiesId;
 	}
 
-	void OverlappingPair::setCollisionAlgorithm(std::shared_ptr<CollisionAlgorithm> collisionAlgorithm)
+	void OverlappingPair::setCollisionAlgorithm(IntrusivePtr<CollisionAlgorithm> collisionAlgorithm)
 	{
 		this->collisionAlgorithm = std::move(collisionAlgorithm);
 	}
 
-	std::shared_ptr<CollisionAlgorithm> OverlappingPair::getCollisionAlgorithm() const
+	CollisionAlgorithm *OverlappingPair::getCollisionAlgorithm() const
 	{
-		return collisionAlgorithm;
+		return collisionAlgorithm.get();
 	}
 
 }
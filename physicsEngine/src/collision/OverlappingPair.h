@@ -5,6 +5,7 @@
 
 #include "body/work/AbstractWorkBody.h"
 #include "collision/narrowphase/algorithm/CollisionAlgorithm.h"
+#include "utils/pool/IntrusivePtr.h"
 
 namespace urchin
 {
@@ -26,15 +27,15 @@ namespace urchin
 			static uint_fast64_t computeBodiesId(const AbstractWorkBody *, const AbstractWorkBody *);
 			uint_fast64_t getBodiesId() const;
 
-			void setCollisionAlgorithm(std::shared_ptr<CollisionAlgorithm>);
-			std::shared_ptr<CollisionAlgorithm> getCollisionAlgorithm() const;
+			void setCollisionAlgorithm(IntrusivePtr<CollisionAlgorithm>);
+			CollisionAlgorithm *getCollisionAlgorithm() const;
 
 		private:
 			AbstractWorkBody *body1;
 			AbstractWorkBody *body2;
 			uint_fast64_t bodiesId;
 
-			std::shared_ptr<CollisionAlgorithm> collisionAlgorithm;
+			IntrusivePtr<CollisionAlgorithm> collisionAlgorithm;
 	};
 
 }
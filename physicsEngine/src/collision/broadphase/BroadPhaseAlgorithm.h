@@ -2,11 +2,13 @@
 #define URCHINENGINE_BROADPHASEALGORITHM_H
 
 #include <vector>
+#include <memory>
 #include "UrchinCommon.h"
 
 #include "body/work/AbstractWorkBody.h"
 #include "collision/OverlappingPair.h"
 #include "collision/broadphase/PairContainer.h"
+#include "collision/broadphase/CollisionFilter.h"
 
 namespace urchin
 {
@@ -18,12 +20,15 @@ namespace urchin
 
 			virtual void addBody(AbstractWorkBody *, PairContainer *) = 0;
 			virtual void removeBody(AbstractWorkBody *) = 0;
-			virtual void updateBodies() = 0;
+			virtual void updateBodies(const std::vector<AbstractWorkBody *> &) = 0;
+			virtual void reinsertBodies(const std::vector<AbstractWorkBody *> &) = 0;
+			virtual void setCollisionFilter(const std::shared_ptr<const CollisionFilter> &) = 0;
 
 			virtual const std::vector<OverlappingPair *> &getOverlappingPairs() const = 0;
 
 			virtual std::vector<AbstractWorkBody *> rayTest(const Ray<float> &) const = 0;
 			virtual std::vector<AbstractWorkBody *> bodyTest(AbstractWorkBody *, const PhysicsTransform &, const PhysicsTransform &) const = 0;
+			virtual void batchRayTest(const std::vector<Ray<float>> &, const std::vector<float> &, std::vector<std::vector<AbstractWorkBody *>> &) const = 0;
 	};
 
 }
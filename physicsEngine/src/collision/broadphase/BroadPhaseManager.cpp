@@ -4,7 +4,8 @@
 namespace urchin
 {
 
-	BroadPhaseManager::BroadPhaseManager(BodyManager *bodyManager)
+	BroadPhaseManager::BroadPhaseManager(BodyManager *bodyManager) :
+			bodyManager(bodyManager)
 	{
 		broadPhaseAlgorithm = new AABBTreeAlgorithm();
 
@@ -68,6 +69,7 @@ namespace urchin
 
         for(auto &bodyToAdd : bodiesToAdd)
         {
+            bodyManager->trackActiveState(bodyToAdd);
             addBody(bodyToAdd);
         }
         bodiesToAdd.clear();
@@ -86,18 +88,60 @@ namespace urchin
 
 		synchronizeBodies();
 
-		broadPhaseAlgorithm->updateBodies();
+		broadPhaseAlgorithm->updateBodies(bodyManager->getActiveWorkBodies());
 		return broadPhaseAlgorithm->getOverlappingPairs();
 	}
 
+	/**
+	 * @return Pairs of bodies computed by the last broad phase process
+	 */
+	const std::vector<OverlappingPair *> &BroadPhaseManager::getOverlappingPairs() const
+	{
+		return broadPhaseAlgorithm->getOverlappingPairs();
+	}
+
+	/**
+	 * Reinserts the bodies in the broad phase with their current transform (e.g.: bodies restored from a snapshot). The
+	 * bodies stay in the broad phase: the pair containers are kept and no notification is sent. Pairs of the bodies are
+	 * recreated in the order of the bodies.
+	 */
+	void BroadPhaseManager::reinsertBodies(const std::vector<AbstractWorkBody *> &bodies)
+	{
+		broadPhaseAlgorithm->reinsertBodies(bodies);
+	}
+
+	/**
+	 * @param collisionFilter Custom filter of the pairs created from now on or null to only filter the pairs with the
+	 * collision groups and masks of the bodies
+	 */
+	void BroadPhaseManager::setCollisionFilter(const std::shared_ptr<const CollisionFilter> &collisionFilter)
+	{
+		broadPhaseAlgorithm->setCollisionFilter(collisionFilter);
+	}
+
 	std::vector<AbstractWorkBody *> BroadPhaseManager::rayTest(const Ray<float> &ray) const
 	{
 		return broadPhaseAlgorithm->rayTest(ray);
 	}
 
+	/**
+	 * @return Bodies AABBox hit by the body moving from a transform to another. Bodies which cannot collide with the body
+	 * (collision groups and masks, collision filter) are excluded.
+	 */
 	std::vector<AbstractWorkBody *> BroadPhaseManager::bodyTest(AbstractWorkBody *body, const PhysicsTransform &from, const PhysicsTransform &to) const
 	{
 		return broadPhaseAlgorithm->bodyTest(body, from, to);
 	}
 
+	/**
+	 * Process several ray tests in one pass on the broad phase structure
+	 * @param enlargeSizes Enlargement of the bodies AABBox for each ray: allow to test a shape moving along the ray. Value 0 for a classical ray test.
+	 * @param bodiesAABBoxHitRays [out] Bodies AABBox hit for each ray
+	 */
+	void BroadPhaseManager::batchRayTest(const std::vector<Ray<float>> &rays, const std::vector<float> &enlargeSizes,
+			std::vector<std::vector<AbstractWorkBody *>> &bodiesAABBoxHitRays) const
+	{
+		broadPhaseAlgorithm->batchRayTest(rays, enlargeSizes, bodiesAABBoxHitRays);
+	}
+
 }
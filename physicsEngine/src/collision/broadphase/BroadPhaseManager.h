@@ -2,10 +2,12 @@
 #define URCHINENGINE_BROADPHASEMANAGER_H
 
 #include <vector>
+#include <memory>
 #include "UrchinCommon.h"
 
 #include "collision/broadphase/BroadPhaseAlgorithm.h"
 #include "collision/broadphase/PairContainer.h"
+#include "collision/broadphase/CollisionFilter.h"
 #include "collision/OverlappingPair.h"
 #include "body/work/AbstractWorkBody.h"
 #include "body/BodyManager.h"
@@ -28,15 +30,20 @@ namespace urchin
 			void removeBodyAsync(AbstractWorkBody *);
 
 			const std::vector<OverlappingPair *> &computeOverlappingPairs();
+			const std::vector<OverlappingPair *> &getOverlappingPairs() const;
+			void reinsertBodies(const std::vector<AbstractWorkBody *> &);
+			void setCollisionFilter(const std::shared_ptr<const CollisionFilter> &);
 
 			std::vector<AbstractWorkBody *> rayTest(const Ray<float> &) const;
 			std::vector<AbstractWorkBody *> bodyTest(AbstractWorkBody *, const PhysicsTransform &, const PhysicsTransform &) const;
+			void batchRayTest(const std::vector<Ray<float>> &, const std::vector<float> &, std::vector<std::vector<AbstractWorkBody *>> &) const;
 
 		private:
             void addBody(AbstractWorkBody *);
 			void removeBody(AbstractWorkBody *);
 			void synchronizeBodies();
 
+			BodyManager *bodyManager;
 			BroadPhaseAlgorithm *broadPhaseAlgorithm;
 
 			std::mutex mutex;
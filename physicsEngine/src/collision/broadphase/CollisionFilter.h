@@ -0,0 +1,26 @@
+#ifndef URCHINENGINE_COLLISIONFILTER_H
+#define URCHINENGINE_COLLISIONFILTER_H
+
+#include "body/work/AbstractWorkBody.h"
+
+namespace urchin
+{
+
+	/**
+	* Custom filter of the pairs of bodies, evaluated by the broad phase after the collision groups and masks of the bodies.
+	* A filtered pair is never created: no collision algorithm and no contact between both bodies. The filter is called from
+	* the physics thread when a pair is about to be created: it must be fast and its answer must not change over time.
+	* It is also called by the body tests of the broad phase (e.g. character controllers updated in batch): needCollision
+	* can be called from several threads at once and must therefore be thread-safe.
+	*/
+	class CollisionFilter
+	{
+		public:
+			virtual ~CollisionFilter() = default;
+
+			virtual bool needCollision(const AbstractWorkBody *, const AbstractWorkBody *) const = 0;
+	};
+
+}
+
+#endif
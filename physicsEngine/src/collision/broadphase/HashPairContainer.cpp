@@ -0,0 +1,175 @@
+#include <limits>
+#include <algorithm>
+
+#include "HashPairContainer.h"
+
+namespace urchin
+{
+
+	//static
+	const unsigned int HashPairContainer::EMPTY_SLOT = std::numeric_limits<unsigned int>::max();
+	const unsigned int HashPairContainer::INITIAL_SLOTS_SIZE = 64;
+
+	HashPairContainer::HashPairContainer() :
+			slots(INITIAL_SLOTS_SIZE, PairSlot{0, EMPTY_SLOT})
+	{
+
+	}
+
+	HashPairContainer::~HashPairContainer()
+	{
+		for(auto &overlappingPair : overlappingPairs)
+		{
+			delete overlappingPair;
+		}
+	}
+
+	void HashPairContainer::addOverlappingPair(AbstractWorkBody *body1, AbstractWorkBody *body2)
+	{
+		uint_fast64_t bodiesId = OverlappingPair::computeBodiesId(body1, body2);
+		if(slots[findSlot(bodiesId)].pairIndex!=EMPTY_SLOT)
+		{ //pair already exists
+			return;
+		}
+
+		if((overlappingPairs.size() + 1) * 2 > slots.size())
+		{ //keep load factor below 0.5
+			resizeSlots(slots.size() * 2);
+		}
+
+		auto *overlappingPair = new OverlappingPair(body1, body2, bodiesId);
+		insertSlot(bodiesId, static_cast<unsigned int>(overlappingPairs.size()));
+		overlappingPairs.push_back(overlappingPair);
+		bodiesPairs[body1].push_back(overlappingPair);
+		bodiesPairs[body2].push_back(overlappingPair);
+	}
+
+	void HashPairContainer::removeOverlappingPair(AbstractWorkBody *body1, AbstractWorkBody *body2)
+	{
+		std::size_t slotIndex = findSlot(OverlappingPair::computeBodiesId(body1, body2));
+		if(slots[slotIndex].pairIndex!=EMPTY_SLOT)
+		{
+			OverlappingPair *overlappingPair = overlappingPairs[slots[slotIndex].pairIndex];
+			removeBodyPair(overlappingPair->getBody1(), overlappingPair);
+			removeBodyPair(overlappingPair->getBody2(), overlappingPair);
+			removePair(slotIndex);
+		}
+	}
+
+	void HashPairContainer::removeOverlappingPairs(AbstractWorkBody *body)
+	{
+		auto itFind = bodiesPairs.find(body);
+		if(itFind==bodiesPairs.end())
+		{
+			return;
+		}
+
+		std::vector<OverlappingPair *> bodyPairs = std::move(itFind->second);
+		bodiesPairs.erase(itFind);
+
+		for(const auto *overlappingPair : bodyPairs)
+		{
+			AbstractWorkBody *otherBody = (overlappingPair->getBody1()==body) ? overlappingPair->getBody2() : overlappingPair->getBody1();
+			removeBodyPair(otherBody, overlappingPair);
+			removePair(findSlot(overlappingPair->getBodiesId()));
+		}
+	}
+
+	const std::vector<OverlappingPair *> &HashPairContainer::getOverlappingPairs() const
+	{
+		return overlappingPairs;
+	}
+
+	std::vector<OverlappingPair> HashPairContainer::retrieveCopyOverlappingPairs() const
+	{
+		throw std::runtime_error("Not implemented: use 'getOverlappingPairs' method");
+	}
+
+	std::size_t HashPairContainer::computeSlotIndex(uint_fast64_t bodiesId) const
+	{
+		uint_fast64_t hash = bodiesId * 0x9E3779B97F4A7C15ull; //Fibonacci hashing
+		return static_cast<std::size_t>(hash >> 32u) & (slots.size() - 1);
+	}
+
+	/**
+	 * @return Slot of the bodies id or empty slot where the bodies id can be inserted
+	 */
+	std::size_t HashPairContainer::findSlot(uint_fast64_t bodiesId) const
+	{
+		std::size_t slotIndex = computeSlotIndex(bodiesId);
+		while(slots[slotIndex].pairIndex!=EMPTY_SLOT && slots[slotIndex].bodiesId!=bodiesId)
+		{ //linear probing
+			slotIndex = (slotIndex + 1) & (slots.size() - 1);
+		}
+		return slotIndex;
+	}
+
+	void HashPairContainer::insertSlot(uint_fast64_t bodiesId, unsigned int pairIndex)
+	{
+		std::size_t slotIndex = findSlot(bodiesId);
+		slots[slotIndex].bodiesId = bodiesId;
+		slots[slotIndex].pairIndex = pairIndex;
+	}
+
+	/**
+	 * Removes the slot and shifts back the next slots of the probing sequence: no tombstone is required
+	 */
+	void HashPairContainer::removeSlot(std::size_t slotIndex)
+	{
+		std::size_t mask = slots.size() - 1;
+		std::size_t nextSlotIndex = (slotIndex + 1) & mask;
+		while(slots[nextSlotIndex].pairIndex!=EMPTY_SLOT)
+		{
+			std::size_t idealSlotIndex = computeSlotIndex(slots[nextSlotIndex].bodiesId);
+			if(((nextSlotIndex - idealSlotIndex) & mask) >= ((nextSlotIndex - slotIndex) & mask))
+			{ //next slot can be moved in the removed slot without breaking its probing sequence
+				slots[slotIndex] = slots[nextSlotIndex];
+				slotIndex = nextSlotIndex;
+			}
+			nextSlotIndex = (nextSlotIndex + 1) & mask;
+		}
+		slots[slotIndex].pairIndex = EMPTY_SLOT;
+	}
+
+	void HashPairContainer::resizeSlots(std::size_t slotsSize)
+	{
+		slots.assign(slotsSize, PairSlot{0, EMPTY_SLOT});
+		for(std::size_t i=0; i<overlappingPairs.size(); ++i)
+		{
+			insertSlot(overlappingPairs[i]->getBodiesId(), static_cast<unsigned int>(i));
+		}
+	}
+
+	/**
+	 * Removes the pair from the dense vector: last pair is moved at the place of the removed pair
+	 */
+	void HashPairContainer::removePair(std::size_t slotIndex)
+	{
+		unsigned int pairIndex = slots[slotIndex].pairIndex;
+		delete overlappingPairs[pairIndex];
+		removeSlot(slotIndex);
+
+		auto lastPairIndex = static_cast<unsigned int>(overlappingPairs.size() - 1);
+		if(pairIndex!=lastPairIndex)
+		{
+			overlappingPairs[pairIndex] = overlappingPairs[lastPairIndex];
+			slots[findSlot(overlappingPairs[pairIndex]->getBodiesId())].pairIndex = pairIndex;
+		}
+		overlappingPairs.pop_back();
+	}
+
+	void HashPairContainer::removeBodyPair(AbstractWorkBody *body, const OverlappingPair *overlappingPair)
+	{
+		auto itFind = bodiesPairs.find(body);
+		if(itFind!=bodiesPairs.end())
+		{
+			std::vector<OverlappingPair *> &bodyPairs = itFind->second;
+			VectorEraser::erase(bodyPairs, std::find(bodyPairs.begin(), bodyPairs.end(), overlappingPair));
+			if(bodyPairs.empty())
+			{
+				bodiesPairs.erase(itFind);
+			}
+		}
+	}
+
+}
@@ -0,0 +1,56 @@
+#ifndef URCHINENGINE_HASHPAIRCONTAINER_H
+#define URCHINENGINE_HASHPAIRCONTAINER_H
+
+#include <vector>
+#include <unordered_map>
+
+#include "collision/OverlappingPair.h"
+#include "PairContainer.h"
+
+namespace urchin
+{
+
+	/**
+	* Overlapping pair manager using an open addressing hash table on the bodies id. Pairs are stored in a dense vector
+	* for fast iteration and each body keeps the list of its pairs: add and remove operations don't depend on the total
+	* number of pairs.
+	*/
+	class HashPairContainer : public PairContainer
+	{
+		public:
+			HashPairContainer();
+			~HashPairContainer() override;
+
+			void addOverlappingPair(AbstractWorkBody *, AbstractWorkBody *) override;
+			void removeOverlappingPair(AbstractWorkBody *, AbstractWorkBody *) override;
+			void removeOverlappingPairs(AbstractWorkBody *) override;
+
+			const std::vector<OverlappingPair *> &getOverlappingPairs() const override;
+			std::vector<OverlappingPair> retrieveCopyOverlappingPairs() const override;
+
+		private:
+			struct PairSlot
+			{
+				uint_fast64_t bodiesId;
+				unsigned int pairIndex;
+			};
+			static const unsigned int EMPTY_SLOT;
+			static const unsigned int INITIAL_SLOTS_SIZE;
+
+			std::size_t computeSlotIndex(uint_fast64_t) const;
+			std::size_t findSlot(uint_fast64_t) const;
+			void insertSlot(uint_fast64_t, unsigned int);
+			void removeSlot(std::size_t);
+			void resizeSlots(std::size_t);
+
+			void removePair(std::size_t);
+			void removeBodyPair(AbstractWorkBody *, const OverlappingPair *);
+
+			std::vector<OverlappingPair *> overlappingPairs;
+			std::vector<PairSlot> slots;
+			std::unordered_map<AbstractWorkBody *, std::vector<OverlappingPair *>> bodiesPairs;
+	};
+
+}
+
+#endif
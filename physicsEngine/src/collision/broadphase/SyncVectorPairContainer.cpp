@@ -46,4 +46,12 @@ namespace urchin
         return copiedOverlappingPairs;
     }
 
+    /**
+     * Pairs are only added/removed by the physics thread: the physics thread can read them without copy when the broad phase is not processed.
+     */
+    const std::vector<OverlappingPair *> &SyncVectorPairContainer::getOverlappingPairsFromPhysicsThread() const
+    {
+        return VectorPairContainer::getOverlappingPairs();
+    }
+
 }
@@ -22,6 +22,7 @@ namespace urchin
 
             const std::vector<OverlappingPair *> &getOverlappingPairs() const override;
             std::vector<OverlappingPair> retrieveCopyOverlappingPairs() const override;
+            const std::vector<OverlappingPair *> &getOverlappingPairsFromPhysicsThread() const;
 
         private:
             mutable std::mutex pairMutex;
@@ -25,9 +25,19 @@ namespace urchin
 		tree->removeBody(body);
 	}
 
-	void AABBTreeAlgorithm::updateBodies()
+	void AABBTreeAlgorithm::updateBodies(const std::vector<AbstractWorkBody *> &activeBodies)
 	{
-		tree->updateBodies();
+		tree->updateBodies(activeBodies);
+	}
+
+	void AABBTreeAlgorithm::reinsertBodies(const std::vector<AbstractWorkBody *> &bodies)
+	{
+		tree->reinsertBodies(bodies);
+	}
+
+	void AABBTreeAlgorithm::setCollisionFilter(const std::shared_ptr<const CollisionFilter> &collisionFilter)
+	{
+		tree->setCollisionFilter(collisionFilter);
 	}
 
 	const std::vector<OverlappingPair *> &AABBTreeAlgorithm::getOverlappingPairs() const
@@ -58,4 +68,10 @@ namespace urchin
 		return bodiesAABBoxHitBody;
 	}
 
+	void AABBTreeAlgorithm::batchRayTest(const std::vector<Ray<float>> &rays, const std::vector<float> &enlargeSizes,
+			std::vector<std::vector<AbstractWorkBody *>> &bodiesAABBoxHitRays) const
+	{
+		tree->batchRayQuery(rays, enlargeSizes, bodiesAABBoxHitRays);
+	}
+
 }
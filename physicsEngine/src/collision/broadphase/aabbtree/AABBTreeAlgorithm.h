@@ -19,12 +19,15 @@ namespace urchin
 
 			void addBody(AbstractWorkBody *, PairContainer *) override;
 			void removeBody(AbstractWorkBody *) override;
-			void updateBodies() override;
+			void updateBodies(const std::vector<AbstractWorkBody *> &) override;
+			void reinsertBodies(const std::vector<AbstractWorkBody *> &) override;
+			void setCollisionFilter(const std::shared_ptr<const CollisionFilter> &) override;
 
 			const std::vector<OverlappingPair *> &getOverlappingPairs() const override;
 
 			std::vector<AbstractWorkBody *> rayTest(const Ray<float> &) const override;
 			std::vector<AbstractWorkBody *> bodyTest(AbstractWorkBody *, const PhysicsTransform &, const PhysicsTransform &) const override;
+			void batchRayTest(const std::vector<Ray<float>> &, const std::vector<float> &, std::vector<std::vector<AbstractWorkBody *>> &) const override;
 
 		private:
             BodyAABBTree *tree;
@@ -5,7 +5,8 @@ namespace urchin
 
 	BodyAABBNodeData::BodyAABBNodeData(AbstractWorkBody *body, PairContainer *alternativePairContainer) :
 		AABBNodeData(body),
-		alternativePairContainer(alternativePairContainer)
+		alternativePairContainer(alternativePairContainer),
+		staticBodyIndex(0)
 	{
 
 	}
@@ -58,4 +59,14 @@ namespace urchin
 		return ownerPairContainers;
 	}
 
+	void BodyAABBNodeData::setStaticBodyIndex(std::size_t staticBodyIndex)
+	{
+		this->staticBodyIndex = staticBodyIndex;
+	}
+
+	std::size_t BodyAABBNodeData::getStaticBodyIndex() const
+	{
+		return staticBodyIndex;
+	}
+
 }
@@ -28,8 +28,12 @@ namespace urchin
             void removeOwnerPairContainer(PairContainer *);
 			std::set<PairContainer *> getOwnerPairContainers() const;
 
+			void setStaticBodyIndex(std::size_t);
+			std::size_t getStaticBodyIndex() const;
+
 		private:
 			PairContainer *alternativePairContainer;
+			std::size_t staticBodyIndex; //index in the static bodies of the tree
 			std::set<PairContainer *> ownerPairContainers;
 	};
 
@@ -1,13 +1,15 @@
 #include <limits>
+#include <algorithm>
 
 #include "BodyAABBTree.h"
-#include "collision/broadphase/VectorPairContainer.h"
+#include "collision/broadphase/HashPairContainer.h"
 
 namespace urchin
 {
     BodyAABBTree::BodyAABBTree() :
             AABBTree<AbstractWorkBody *>(ConfigService::instance()->getFloatValue("broadPhase.aabbTreeFatMargin")),
-            defaultPairContainer(new VectorPairContainer()),
+            staticTree(new AABBTree<AbstractWorkBody *>(0.0f)), //static bodies don't move: fat margin is useless
+            defaultPairContainer(new HashPairContainer()),
             inInitializationPhase(true),
             minYBoundary(std::numeric_limits<float>::max())
     {
@@ -16,33 +18,203 @@ namespace urchin
 
     BodyAABBTree::~BodyAABBTree()
     {
+        delete staticTree;
         delete defaultPairContainer;
     }
 
+    AABBNodeData<AbstractWorkBody *> *BodyAABBTree::getNodeData(AbstractWorkBody *body) const
+    {
+        if(isStaticTreeBody(body))
+        {
+            return staticTree->getNodeData(body);
+        }
+        return AABBTree::getNodeData(body);
+    }
+
     void BodyAABBTree::addBody(AbstractWorkBody *body, PairContainer *alternativePairContainer)
     {
-        auto *nodeData = new BodyAABBNodeData(body, alternativePairContainer);
-        AABBTree::addObject(nodeData);
+        addBodyNodeData(new BodyAABBNodeData(body, alternativePairContainer));
     }
 
-    void BodyAABBTree::postAddObjectCallback(AABBNode<AbstractWorkBody *> *newNode)
+    void BodyAABBTree::postAddObjectCallback(AABBNodeData<AbstractWorkBody *> *newNodeData)
     {
-        computeOverlappingPairsFor(newNode);
+        auto *newBodyNodeData = dynamic_cast<BodyAABBNodeData *>(newNodeData);
+        const AABBox<float> &newNodeFatAABBox = AABBTree::getNode(newNodeData->getNodeId()).getAABBox();
+        computeOverlappingPairsFor(newNodeFatAABBox, newBodyNodeData, *this);
+        computeOverlappingPairsFor(newNodeFatAABBox, newBodyNodeData, *staticTree);
     }
 
     void BodyAABBTree::removeBody(AbstractWorkBody *body)
     {
-        auto *nodeData = AABBTree::getNodeData(body);
-        AABBTree::removeObject(nodeData);
+        body->setStaticStateChanges(nullptr);
+        staticStateChanges.removeBody(body);
+
+        if(isStaticTreeBody(body))
+        {
+            removeStaticBody(body);
+        }else
+        {
+            AABBTree::removeObject(body);
+        }
     }
 
-    void BodyAABBTree::preRemoveObjectCallback(AABBNode<AbstractWorkBody *> *nodeToDelete)
+    void BodyAABBTree::preRemoveObjectCallback(AABBNodeData<AbstractWorkBody *> *nodeDataToDelete)
     {
-        auto *bodyNodeToDelete = dynamic_cast<BodyAABBNodeData *>(nodeToDelete->getNodeData());
-        removeOverlappingPairs(bodyNodeToDelete);
+        auto *bodyNodeDataToDelete = dynamic_cast<BodyAABBNodeData *>(nodeDataToDelete);
+        removeOverlappingPairs(bodyNodeDataToDelete);
     }
 
     void BodyAABBTree::updateBodies()
+    {
+        prepareBodiesUpdate();
+        AABBTree::updateObjects();
+    }
+
+    /**
+     * Updates only the given bodies instead of all the bodies of the tree
+     * @param activeBodies Active bodies: inactive bodies don't move and don't need to be updated
+     */
+    void BodyAABBTree::updateBodies(const std::vector<AbstractWorkBody *> &activeBodies)
+    {
+        prepareBodiesUpdate();
+        AABBTree::updateObjects(activeBodies);
+    }
+
+    void BodyAABBTree::preUpdateObjectCallback(AABBNodeData<AbstractWorkBody *> *nodeDataToUpdate)
+    {
+        controlBoundaries(nodeDataToUpdate);
+    }
+
+    /**
+     * Removes all the given dynamic bodies from the tree before adding them again in the given order. The fat boxes,
+     * the tree structure and the pairs of these bodies don't depend anymore on their previous moves.
+     */
+    void BodyAABBTree::reinsertBodies(const std::vector<AbstractWorkBody *> &bodies)
+    {
+        prepareBodiesUpdate();
+
+        reinsertedNodesData.clear();
+        for(auto body : bodies)
+        {
+            if(AABBTree::containsObject(body))
+            {
+                reinsertedNodesData.push_back(AABBTree::getNodeData(body)->clone());
+                AABBTree::removeObject(body);
+            }
+        }
+
+        for(auto nodeData : reinsertedNodesData)
+        {
+            AABBTree::addObject(nodeData);
+        }
+    }
+
+    /**
+     * @param collisionFilter Custom filter of the pairs or null. Existing pairs are kept: filter applies to the pairs created from now on.
+     */
+    void BodyAABBTree::setCollisionFilter(const std::shared_ptr<const CollisionFilter> &collisionFilter)
+    {
+        this->collisionFilter = collisionFilter;
+    }
+
+    const std::vector<OverlappingPair *> &BodyAABBTree::getOverlappingPairs() const
+    {
+        return defaultPairContainer->getOverlappingPairs();
+    }
+
+    /**
+     * @param bodiesAABBoxHit [out] Bodies AABBox (of both trees) hit by the aabbox
+     */
+    void BodyAABBTree::aabboxQuery(const AABBox<float> &aabbox, std::vector<AbstractWorkBody *> &bodiesAABBoxHit) const
+    {
+        AABBTree::aabboxQuery(aabbox, bodiesAABBoxHit);
+        staticTree->aabboxQuery(aabbox, bodiesAABBoxHit);
+    }
+
+    /**
+     * @param bodiesAABBoxHitRay [out] Bodies AABBox (of both trees) hit by the ray
+     */
+    void BodyAABBTree::rayQuery(const Ray<float> &ray, std::vector<AbstractWorkBody *> &bodiesAABBoxHitRay) const
+    {
+        AABBTree::rayQuery(ray, bodiesAABBoxHitRay);
+        staticTree->rayQuery(ray, bodiesAABBoxHitRay);
+    }
+
+    /**
+     * @param bodyToExclude Body moving along the ray: it is excluded from the result as well as the bodies which cannot collide with it
+     * @param bodiesAABBoxHitEnlargedRay [out] Bodies AABBox (of both trees) hit by the enlarged ray
+     */
+    void BodyAABBTree::enlargedRayQuery(const Ray<float> &ray, float enlargeNodeBoxHalfSize, AbstractWorkBody *bodyToExclude,
+            std::vector<AbstractWorkBody *> &bodiesAABBoxHitEnlargedRay) const
+    {
+        std::size_t firstBodyIndex = bodiesAABBoxHitEnlargedRay.size();
+        AABBTree::enlargedRayQuery(ray, enlargeNodeBoxHalfSize, bodyToExclude, bodiesAABBoxHitEnlargedRay);
+        staticTree->enlargedRayQuery(ray, enlargeNodeBoxHalfSize, bodyToExclude, bodiesAABBoxHitEnlargedRay);
+
+        if(bodyToExclude)
+        { //enlarged ray represents the move of the body to exclude: bodies which cannot collide with it are removed
+            bodiesAABBoxHitEnlargedRay.erase(std::remove_if(bodiesAABBoxHitEnlargedRay.begin() + static_cast<long>(firstBodyIndex), bodiesAABBoxHitEnlargedRay.end(),
+                    [&](const AbstractWorkBody *body){ return !needCollision(bodyToExclude, body); }), bodiesAABBoxHitEnlargedRay.end());
+        }
+    }
+
+    /**
+     * @param bodiesAABBoxHitRays [out] Bodies AABBox (of both trees) hit by each ray
+     */
+    void BodyAABBTree::batchRayQuery(const std::vector<Ray<float>> &rays, const std::vector<float> &enlargeNodeBoxHalfSizes,
+            std::vector<std::vector<AbstractWorkBody *>> &bodiesAABBoxHitRays) const
+    {
+        AABBTree::batchRayQuery(rays, enlargeNodeBoxHalfSizes, bodiesAABBoxHitRays);
+        staticTree->batchRayQuery(rays, enlargeNodeBoxHalfSizes, bodiesAABBoxHitRays);
+    }
+
+    bool BodyAABBTree::isStaticTreeBody(AbstractWorkBody *body) const
+    {
+        return !AABBTree::containsObject(body);
+    }
+
+    void BodyAABBTree::addBodyNodeData(BodyAABBNodeData *nodeData)
+    {
+        nodeData->getNodeObject()->setStaticStateChanges(&staticStateChanges);
+
+        if(nodeData->getNodeObject()->isStatic())
+        {
+            addStaticBodyNodeData(nodeData);
+        }else
+        {
+            AABBTree::addObject(nodeData);
+        }
+    }
+
+    void BodyAABBTree::addStaticBodyNodeData(BodyAABBNodeData *nodeData)
+    {
+        staticTree->addObject(nodeData);
+        nodeData->setStaticBodyIndex(staticBodies.size());
+        staticBodies.push_back(nodeData->getNodeObject());
+
+        //static body can only overlap dynamic bodies
+        computeOverlappingPairsFor(nodeData->retrieveObjectAABBox(), nodeData, *this);
+    }
+
+    void BodyAABBTree::removeStaticBody(AbstractWorkBody *body)
+    {
+        auto *nodeData = dynamic_cast<BodyAABBNodeData *>(staticTree->getNodeData(body));
+        removeOverlappingPairs(nodeData);
+
+        //swap-remove: the last static body takes the place of the removed body
+        std::size_t staticBodyIndex = nodeData->getStaticBodyIndex();
+        AbstractWorkBody *lastStaticBody = staticBodies.back();
+        staticBodies[staticBodyIndex] = lastStaticBody;
+        dynamic_cast<BodyAABBNodeData *>(staticTree->getNodeData(lastStaticBody))->setStaticBodyIndex(staticBodyIndex);
+        staticBodies.pop_back();
+
+        staticTree->removeObject(body);
+    }
+
+    /**
+     * Move the bodies which become static (e.g.: mass updated to zero) in static tree and vice versa
+     */
+    void BodyAABBTree::prepareBodiesUpdate()
     {
         if(inInitializationPhase)
         {
@@ -50,37 +222,73 @@ namespace urchin
             inInitializationPhase = false;
         }
 
-        AABBTree::updateObjects();
+        refreshBodiesTree();
     }
 
-    void BodyAABBTree::preUpdateObjectCallback(AABBNode<AbstractWorkBody *> *nodeToUpdate)
+    void BodyAABBTree::refreshBodiesTree()
     {
-        controlBoundaries(nodeToUpdate);
+        if(staticStateChanges.getBodies().empty())
+        {
+            return;
+        }
+
+        bodiesToMove = staticStateChanges.getBodies();
+        staticStateChanges.clear();
+
+        for(auto bodyToMove : bodiesToMove)
+        {
+            if(bodyToMove->isStatic() == isStaticTreeBody(bodyToMove))
+            { //body already in the right tree (e.g.: static state changed twice)
+                continue;
+            }
+            moveBodyToOtherTree(bodyToMove);
+        }
     }
 
-    const std::vector<OverlappingPair *> &BodyAABBTree::getOverlappingPairs() const
+    void BodyAABBTree::moveBodyToOtherTree(AbstractWorkBody *body)
     {
-        return defaultPairContainer->getOverlappingPairs();
+        auto *clonedNodeData = dynamic_cast<BodyAABBNodeData *>(getNodeData(body)->clone());
+        removeBody(body);
+        addBodyNodeData(clonedNodeData);
     }
 
-    void BodyAABBTree::computeOverlappingPairsFor(AABBNode<AbstractWorkBody *> *leafNode)
+    /**
+     * @return True when a pair must be created between both bodies: collision groups and masks of the bodies match and
+     * the custom collision filter (if any) accepts the pair
+     */
+    bool BodyAABBTree::needCollision(const AbstractWorkBody *body1, const AbstractWorkBody *body2) const
     {
-        browseNodes.clear();
-        browseNodes.push_back(AABBTree::getRootNode());
+        if(!body1->canCollideWith(body2))
+        {
+            return false;
+        }
+        return !collisionFilter || collisionFilter->needCollision(body1, body2);
+    }
+
+    /**
+     * Create overlapping pairs between the node data and the leaves of the tree colliding with the AABBox
+     */
+    void BodyAABBTree::computeOverlappingPairsFor(const AABBox<float> &aabbox, BodyAABBNodeData *nodeData, const AABBTree<AbstractWorkBody *> &tree)
+    {
+        AABBTreeBrowseStack<unsigned int> browseNodes;
+        if(tree.getRootNode() != AABBNode<AbstractWorkBody *>::NULL_NODE)
+        {
+            browseNodes.push(tree.getRootNode());
+        }
 
-        for(std::size_t i=0; i<browseNodes.size(); ++i)
+        while(!browseNodes.isEmpty())
         { //tree traversal: pre-order (iterative)
-            const AABBNode<AbstractWorkBody *> *currentNode = browseNodes[i];
+            const AABBNode<AbstractWorkBody *> &currentNode = tree.getNode(browseNodes.pop());
 
-            if(leafNode!=currentNode && leafNode->getAABBox().collideWithAABBox(currentNode->getAABBox()))
+            if(nodeData!=currentNode.getNodeData() && aabbox.collideWithAABBox(currentNode.getAABBox()))
             {
-                if (currentNode->isLeaf())
+                if (currentNode.isLeaf())
                 {
-                    createOverlappingPair(dynamic_cast<BodyAABBNodeData *>(leafNode->getNodeData()), dynamic_cast<BodyAABBNodeData *>(currentNode->getNodeData()));
+                    createOverlappingPair(nodeData, dynamic_cast<BodyAABBNodeData *>(currentNode.getNodeData()));
                 }else
                 {
-                    browseNodes.push_back(currentNode->getRightChild());
-                    browseNodes.push_back(currentNode->getLeftChild());
+                    browseNodes.push(currentNode.getRightChild());
+                    browseNodes.push(currentNode.getLeftChild());
                 }
             }
         }
@@ -88,6 +296,11 @@ namespace urchin
 
     void BodyAABBTree::createOverlappingPair(BodyAABBNodeData *nodeData1, BodyAABBNodeData *nodeData2)
     {
+        if(!needCollision(nodeData1->getNodeObject(), nodeData2->getNodeObject()))
+        {
+            return;
+        }
+
         if(!nodeData1->hasAlternativePairContainer() && !nodeData2->hasAlternativePairContainer())
         {
             defaultPairContainer->addOverlappingPair(nodeData1->getNodeObject(), nodeData2->getNodeObject());
@@ -132,7 +345,7 @@ namespace urchin
         for (const auto &overlappingPair : overlappingPairs)
         {
             AbstractWorkBody *otherPairBody = overlappingPair.getBody1() == body ? overlappingPair.getBody2() : overlappingPair.getBody1();
-            auto *otherNodeData = dynamic_cast<BodyAABBNodeData *>(BodyAABBTree::getNodeData(otherPairBody));
+            auto *otherNodeData = dynamic_cast<BodyAABBNodeData *>(getNodeData(otherPairBody));
 
             otherNodeData->removeOwnerPairContainer(alternativePairContainer);
         }
@@ -141,24 +354,30 @@ namespace urchin
     void BodyAABBTree::computeWorldBoundary()
     {
         float maxYBoundary = -std::numeric_limits<float>::max();
-        for(auto &objectNode : objectsNode)
+        for(auto &objectNodeData : objectsNodeData)
         {
-            const AABBox<float> &nodeAABBox = objectNode.second->getAABBox();
+            const AABBox<float> &nodeAABBox = AABBTree::getNode(objectNodeData.second->getNodeId()).getAABBox();
             minYBoundary = std::min(nodeAABBox.getMin().Y, minYBoundary);
             maxYBoundary = std::max(nodeAABBox.getMax().Y, maxYBoundary);
         }
+        for(auto staticBody : staticBodies)
+        {
+            AABBox<float> staticBodyAABBox = staticTree->getNodeData(staticBody)->retrieveObjectAABBox();
+            minYBoundary = std::min(staticBodyAABBox.getMin().Y, minYBoundary);
+            maxYBoundary = std::max(staticBodyAABBox.getMax().Y, maxYBoundary);
+        }
 
         float worldHeight = maxYBoundary - minYBoundary;
         minYBoundary -= worldHeight * BOUNDARIES_MARGIN_PERCENTAGE;
     }
 
-    void BodyAABBTree::controlBoundaries(AABBNode<AbstractWorkBody *> *leafNode)
+    void BodyAABBTree::controlBoundaries(AABBNodeData<AbstractWorkBody *> *leafNodeData)
     {
-        const AABBox<float> &bodyAABBox = leafNode->getNodeData()->retrieveObjectAABBox();
+        const AABBox<float> &bodyAABBox = leafNodeData->retrieveObjectAABBox();
 
         if(bodyAABBox.getMax().Y < minYBoundary)
         {
-            AbstractWorkBody *body = leafNode->getNodeData()->getNodeObject();
+            AbstractWorkBody *body = leafNodeData->getNodeObject();
 
             std::stringstream logStream;
             logStream<<"Body "<<body->getId()<<" is below the limit of "<<std::to_string(minYBoundary)<<": "<<body->getPosition();
@@ -1,44 +1,78 @@
 #ifndef URCHINENGINE_BODYAABBTREE_H
 #define URCHINENGINE_BODYAABBTREE_H
 
+#include <memory>
 #include "UrchinCommon.h"
 
 #include "body/work/AbstractWorkBody.h"
+#include "body/StaticStateChanges.h"
 #include "collision/OverlappingPair.h"
 #include "collision/broadphase/PairContainer.h"
 #include "collision/broadphase/BroadPhaseAlgorithm.h"
+#include "collision/broadphase/CollisionFilter.h"
 #include "collision/broadphase/aabbtree/BodyAABBNodeData.h"
 
 namespace urchin
 {
 
+    /**
+    * Tree of dynamic bodies. Static bodies are stored in a separate tree which is never refit and only queried by the dynamic bodies:
+    * pairs between two static bodies are never created. Bodies notify the tree when their static state changes: only these bodies
+    * are moved from one tree to the other.
+    */
     class BodyAABBTree : public AABBTree<AbstractWorkBody *>
     {
         public:
             BodyAABBTree();
             ~BodyAABBTree() override;
 
+            AABBNodeData<AbstractWorkBody *> *getNodeData(AbstractWorkBody *) const;
+
             void addBody(AbstractWorkBody *, PairContainer *);
-            void postAddObjectCallback(AABBNode<AbstractWorkBody *> *) override;
+            void postAddObjectCallback(AABBNodeData<AbstractWorkBody *> *) override;
 
             void removeBody(AbstractWorkBody *);
-            void preRemoveObjectCallback(AABBNode<AbstractWorkBody *> *) override;
+            void preRemoveObjectCallback(AABBNodeData<AbstractWorkBody *> *) override;
 
             void updateBodies();
-            void preUpdateObjectCallback(AABBNode<AbstractWorkBody *> *) override;
+            void updateBodies(const std::vector<AbstractWorkBody *> &);
+            void preUpdateObjectCallback(AABBNodeData<AbstractWorkBody *> *) override;
+            void reinsertBodies(const std::vector<AbstractWorkBody *> &);
+            void setCollisionFilter(const std::shared_ptr<const CollisionFilter> &);
 
             const std::vector<OverlappingPair *> &getOverlappingPairs() const;
 
+            void aabboxQuery(const AABBox<float> &, std::vector<AbstractWorkBody *> &) const;
+            void rayQuery(const Ray<float> &, std::vector<AbstractWorkBody *> &) const;
+            void enlargedRayQuery(const Ray<float> &, float, AbstractWorkBody *, std::vector<AbstractWorkBody *> &) const;
+            void batchRayQuery(const std::vector<Ray<float>> &, const std::vector<float> &, std::vector<std::vector<AbstractWorkBody *>> &) const;
+
         private:
-            void computeOverlappingPairsFor(AABBNode<AbstractWorkBody *> *);
+            bool isStaticTreeBody(AbstractWorkBody *) const;
+            void addBodyNodeData(BodyAABBNodeData *);
+            void addStaticBodyNodeData(BodyAABBNodeData *);
+            void removeStaticBody(AbstractWorkBody *);
+            void prepareBodiesUpdate();
+            void refreshBodiesTree();
+            void moveBodyToOtherTree(AbstractWorkBody *);
+
+            bool needCollision(const AbstractWorkBody *, const AbstractWorkBody *) const;
+            void computeOverlappingPairsFor(const AABBox<float> &, BodyAABBNodeData *, const AABBTree<AbstractWorkBody *> &);
             void createOverlappingPair(BodyAABBNodeData *, BodyAABBNodeData *);
             void removeOverlappingPairs(const BodyAABBNodeData *);
             void removeAlternativePairContainerReferences(const AbstractWorkBody *, PairContainer *);
 
             void computeWorldBoundary();
-            void controlBoundaries(AABBNode<AbstractWorkBody *> *);
+            void controlBoundaries(AABBNodeData<AbstractWorkBody *> *);
+
+            AABBTree<AbstractWorkBody *> *staticTree;
+            std::vector<AbstractWorkBody *> staticBodies;
+            StaticStateChanges staticStateChanges;
+            std::vector<AbstractWorkBody *> bodiesToMove;
+            std::vector<AABBNodeData<AbstractWorkBody *> *> reinsertedNodesData;
 
             PairContainer *defaultPairContainer;
+            std::shared_ptr<const CollisionFilter> collisionFilter;
 
             bool inInitializationPhase;
             float minYBoundary;
@@ -1,9 +1,18 @@
+#include <limits>
+
 #include "collision/constraintsolver/ConstraintSolverManager.h"
 
 namespace urchin
 {
 
-	ConstraintSolverManager::ConstraintSolverManager() :
+	//static
+	const unsigned int ConstraintSolverManager::MIN_CONSTRAINTS_BY_THREAD = 32;
+
+	/**
+	 * @param numberOfThreads Number of threads solving the islands (1: islands solved by physics thread only)
+	 */
+	ConstraintSolverManager::ConstraintSolverManager(unsigned int numberOfThreads) :
+			threadPool(new ThreadPool(numberOfThreads)),
 			constraintSolverIteration(ConfigService::instance()->getUnsignedIntValue("constraintSolver.constraintSolverIteration")),
 			biasFactor(ConfigService::instance()->getFloatValue("constraintSolver.biasFactor")),
 			useWarmStarting(ConfigService::instance()->getBoolValue("constraintSolver.useWarmStarting")),
@@ -21,10 +30,13 @@ namespace urchin
 		}
 
 		delete constraintSolvingPool;
+		delete threadPool;
 	}
 
 	/**
-	 * Solve constraints
+	 * Solve constraints. Constraints of independent islands are solved concurrently: each island is solved by one thread.
+	 * Inside an island, contacts which don't share any non-static body are solved simultaneously with SIMD instructions.
+	 * The result doesn't depend on the number of threads.
 	 * @param dt Delta of time (sec.) between two simulation steps
 	 * @param manifoldResults Constraints to solve
 	 */
@@ -34,12 +46,24 @@ namespace urchin
 
 		//setup step to solve constraints
 		setupConstraints(manifoldResults, dt);
+		groupConstraintsByIsland();
+		fillConstraintSolvingBuffer();
 
 		//iterative constraint solver
-		for(unsigned int i=0; i<constraintSolverIteration; ++i)
-		{
-			solveConstraints();
-		}
+		unsigned int numberOfIslandsBatches = islandsBatchStart.size() - 1;
+		threadPool->parallelFor(numberOfIslandsBatches, [&](unsigned int islandsBatchIndex) {
+			solveBatchesConstraints(islandsBatchContactBatchStart[islandsBatchIndex], islandsBatchContactBatchStart[islandsBatchIndex + 1]);
+		});
+
+		constraintSolvingBuffer.applyResults();
+	}
+
+	/**
+	 * @return Number of contact points solved by the last call to solveConstraints
+	 */
+	unsigned int ConstraintSolverManager::getNumberOfConstraints() const
+	{
+		return static_cast<unsigned int>(constraintsSolving.size());
 	}
 
 	void ConstraintSolverManager::setupConstraints(std::vector<ManifoldResult> &manifoldResults, float dt)
@@ -88,18 +112,180 @@ namespace urchin
 		}
 	}
 
-	void ConstraintSolverManager::solveConstraints()
+	/**
+	 * Group the constraints by island (set of non-static bodies in contact) and group the islands into batches of
+	 * similar size. Only the bodies of the constraints are part of the islands: sleeping bodies and bodies without
+	 * contact are ignored. Islands are ordered by their first constraint and constraints of an island keep their
+	 * original order.
+	 */
+	void ConstraintSolverManager::groupConstraintsByIsland()
 	{
-		//solve tangent constraint first because non-penetration is more important than friction
+		//build islands
+		islandContainer.reset();
 		for (auto &constraintSolving : constraintsSolving)
 		{
-			solveTangentConstraint(constraintSolving);
+			if(!constraintSolving->getBody1()->isStatic())
+			{
+				islandContainer.addElement(constraintSolving->getBody1());
+			}
+			if(!constraintSolving->getBody2()->isStatic())
+			{
+				islandContainer.addElement(constraintSolving->getBody2());
+			}
 		}
 
-		//solve normal constraint
 		for (auto &constraintSolving : constraintsSolving)
 		{
-			solveNormalConstraint(constraintSolving);
+			if(!constraintSolving->getBody1()->isStatic() && !constraintSolving->getBody2()->isStatic())
+			{
+				islandContainer.mergeIsland(constraintSolving->getBody1(), constraintSolving->getBody2());
+			}
+		}
+
+		//assign an island index to each element
+		const std::vector<IslandElementLink> &islandElementsLink = islandContainer.retrieveIslandElements();
+		elementsIslandIndex.assign(islandElementsLink.size(), std::numeric_limits<unsigned int>::max());
+		unsigned int numberOfIslands = 0;
+		for(std::size_t i=0; i<islandElementsLink.size(); ++i)
+		{
+			unsigned int islandRootId = islandElementsLink[i].islandIdRef;
+			if(elementsIslandIndex[islandRootId] == std::numeric_limits<unsigned int>::max())
+			{
+				elementsIslandIndex[islandRootId] = numberOfIslands++;
+			}
+			elementsIslandIndex[i] = elementsIslandIndex[islandRootId];
+		}
+
+		//dispatch constraints in islands
+		for (auto &islandConstraintsSolving : islandsConstraintsSolving)
+		{
+			islandConstraintsSolving.clear();
+		}
+		islandsConstraintsSolving.resize(numberOfIslands);
+		for (auto &constraintSolving : constraintsSolving)
+		{
+			WorkRigidBody *nonStaticBody = constraintSolving->getBody1()->isStatic() ? constraintSolving->getBody2() : constraintSolving->getBody1();
+			if(!nonStaticBody->isStatic())
+			{
+				islandsConstraintsSolving[elementsIslandIndex[nonStaticBody->getIslandElementId()]].push_back(constraintSolving);
+			}
+		}
+
+		//group islands into batches
+		islandsBatchStart.clear();
+		islandsBatchStart.push_back(0);
+		unsigned int numberOfConstraintsInBatch = 0;
+		for(unsigned int islandIndex=0; islandIndex<numberOfIslands; ++islandIndex)
+		{
+			numberOfConstraintsInBatch += islandsConstraintsSolving[islandIndex].size();
+			if(numberOfConstraintsInBatch >= MIN_CONSTRAINTS_BY_THREAD || islandIndex == numberOfIslands - 1)
+			{
+				islandsBatchStart.push_back(islandIndex + 1);
+				numberOfConstraintsInBatch = 0;
+			}
+		}
+	}
+
+	/**
+	 * Fill the buffer of constraints with the constraints grouped by islands. Contacts are placed in batches of
+	 * ConstraintSolvingBuffer::BATCH_SIZE contacts in such a way that:
+	 *  - contacts of a batch don't share any non-static body,
+	 *  - contacts sharing a body are solved in the same order as in their island.
+	 * Therefore, the result is the same as solving the contacts of each island one by one.
+	 */
+	void ConstraintSolverManager::fillConstraintSolvingBuffer()
+	{
+		constraintSolvingBuffer.setupBodies(islandContainer.getSize());
+		bodiesNextContactBatch.assign(islandContainer.getSize(), 0);
+		contactBatchesSize.clear();
+		constraintsBufferIndex.clear();
+
+		//assign a position in buffer to each constraint
+		islandsBatchContactBatchStart.clear();
+		islandsBatchContactBatchStart.push_back(0);
+		for(std::size_t islandsBatchIndex=0; islandsBatchIndex<islandsBatchStart.size()-1; ++islandsBatchIndex)
+		{
+			unsigned int firstNonFullContactBatch = contactBatchesSize.size();
+			for(unsigned int islandIndex=islandsBatchStart[islandsBatchIndex]; islandIndex<islandsBatchStart[islandsBatchIndex+1]; ++islandIndex)
+			{
+				for (auto &constraintSolving : islandsConstraintsSolving[islandIndex])
+				{
+					unsigned int body1Index = retrieveBodyIndex(constraintSolving->getBody1());
+					unsigned int body2Index = retrieveBodyIndex(constraintSolving->getBody2());
+					unsigned int body1NextContactBatch = constraintSolving->getBody1()->isStatic() ? 0 : bodiesNextContactBatch[body1Index];
+					unsigned int body2NextContactBatch = constraintSolving->getBody2()->isStatic() ? 0 : bodiesNextContactBatch[body2Index];
+
+					unsigned int contactBatch = std::max(firstNonFullContactBatch, std::max(body1NextContactBatch, body2NextContactBatch));
+					while(contactBatch < contactBatchesSize.size() && contactBatchesSize[contactBatch] == ConstraintSolvingBuffer::BATCH_SIZE)
+					{
+						contactBatch++;
+					}
+					if(contactBatch == contactBatchesSize.size())
+					{
+						contactBatchesSize.push_back(0);
+					}
+
+					constraintsBufferIndex.emplace_back(std::make_pair(contactBatch * ConstraintSolvingBuffer::BATCH_SIZE + contactBatchesSize[contactBatch]++, constraintSolving));
+					if(!constraintSolving->getBody1()->isStatic())
+					{
+						bodiesNextContactBatch[body1Index] = contactBatch + 1;
+					}
+					if(!constraintSolving->getBody2()->isStatic())
+					{
+						bodiesNextContactBatch[body2Index] = contactBatch + 1;
+					}
+
+					while(firstNonFullContactBatch < contactBatchesSize.size() && contactBatchesSize[firstNonFullContactBatch] == ConstraintSolvingBuffer::BATCH_SIZE)
+					{
+						firstNonFullContactBatch++;
+					}
+				}
+			}
+			islandsBatchContactBatchStart.push_back(contactBatchesSize.size());
+		}
+
+		//fill the buffer
+		constraintSolvingBuffer.setupContacts(contactBatchesSize.size());
+		for (auto &constraintBufferIndex : constraintsBufferIndex)
+		{
+			ConstraintSolving *constraintSolving = constraintBufferIndex.second;
+			unsigned int body1Index = retrieveBodyIndex(constraintSolving->getBody1());
+			unsigned int body2Index = retrieveBodyIndex(constraintSolving->getBody2());
+
+			if(body1Index != constraintSolvingBuffer.getStaticBodyIndex() && !constraintSolvingBuffer.isBodyLoaded(body1Index))
+			{
+				constraintSolvingBuffer.loadBody(body1Index, constraintSolving->getBody1());
+			}
+			if(body2Index != constraintSolvingBuffer.getStaticBodyIndex() && !constraintSolvingBuffer.isBodyLoaded(body2Index))
+			{
+				constraintSolvingBuffer.loadBody(body2Index, constraintSolving->getBody2());
+			}
+
+			constraintSolvingBuffer.setContact(constraintBufferIndex.first, body1Index, body2Index, constraintSolving);
+		}
+	}
+
+	unsigned int ConstraintSolverManager::retrieveBodyIndex(const WorkRigidBody *body) const
+	{
+		if(body->isStatic())
+		{
+			return constraintSolvingBuffer.getStaticBodyIndex();
+		}
+		return body->getIslandElementId();
+	}
+
+	/**
+	 * Solve the constraints of contact batches in range [beginContactBatch, endContactBatch[
+	 */
+	void ConstraintSolverManager::solveBatchesConstraints(unsigned int beginContactBatch, unsigned int endContactBatch)
+	{
+		for(unsigned int i=0; i<constraintSolverIteration; ++i)
+		{
+			//solve tangent constraint first because non-penetration is more important than friction
+			constraintSolvingBuffer.solveTangentConstraints(beginContactBatch, endContactBatch);
+
+			//solve normal constraint
+			constraintSolvingBuffer.solveNormalConstraints(beginContactBatch, endContactBatch);
 		}
 	}
 
@@ -170,57 +356,21 @@ namespace urchin
 	}
 
 	/**
-	 * Solve normal constraint. Normal constraint is related to non-penetration
-	 */
-	void ConstraintSolverManager::solveNormalConstraint(ConstraintSolving *constraintSolving)
-	{
-		const CommonSolvingData &commonSolvingData = constraintSolving->getCommonData();
-		const ImpulseSolvingData &impulseSolvingData = constraintSolving->getImpulseData();
-		AccumulatedSolvingData &accumulatedSolvingData = constraintSolving->getAccumulatedData();
-
-		float normalRelativeVelocity = computeRelativeVelocity(commonSolvingData).dotProduct(commonSolvingData.contactNormal);
-
-		float normalImpulseNumerator = (-normalRelativeVelocity) + impulseSolvingData.bias;
-		float normalImpulse = normalImpulseNumerator / impulseSolvingData.normalImpulseDenominator;
-
-		float oldAccNormalImpulse = accumulatedSolvingData.accNormalImpulse;
-		accumulatedSolvingData.accNormalImpulse = std::min(oldAccNormalImpulse + normalImpulse, 0.0f);
-		normalImpulse = accumulatedSolvingData.accNormalImpulse - oldAccNormalImpulse;
-
-		const Vector3<float> normalImpulseVector = normalImpulse * commonSolvingData.contactNormal;
-		applyImpulse(constraintSolving->getBody1(), constraintSolving->getBody2(), commonSolvingData, normalImpulseVector);
-	}
-
-	/**
-	 * Solve tangent constraint. Tangent constraint is related to friction
+	 * Apply impulse on bodies. Static bodies are not updated: they are shared between islands.
 	 */
-	void ConstraintSolverManager::solveTangentConstraint(ConstraintSolving *constraintSolving)
-	{
-		const CommonSolvingData &commonSolvingData = constraintSolving->getCommonData();
-		const ImpulseSolvingData &impulseSolvingData = constraintSolving->getImpulseData();
-		AccumulatedSolvingData &accumulatedSolvingData = constraintSolving->getAccumulatedData();
-
-		float tangentRelativeVelocity = computeRelativeVelocity(commonSolvingData).dotProduct(commonSolvingData.contactTangent);
-
-		float tangentImpulseNumerator = -tangentRelativeVelocity;
-		float tangentImpulse = tangentImpulseNumerator / impulseSolvingData.tangentImpulseDenominator;
-		float maxFriction = -(impulseSolvingData.friction * accumulatedSolvingData.accNormalImpulse);
-
-		float oldAccTangentImpulse = accumulatedSolvingData.accTangentImpulse;
-		accumulatedSolvingData.accTangentImpulse = MathAlgorithm::clamp(oldAccTangentImpulse + tangentImpulse, -maxFriction, maxFriction);
-		tangentImpulse = accumulatedSolvingData.accTangentImpulse - oldAccTangentImpulse;
-
-		const Vector3<float> tangentImpulseVector = tangentImpulse * commonSolvingData.contactTangent;
-		applyImpulse(constraintSolving->getBody1(), constraintSolving->getBody2(), commonSolvingData, tangentImpulseVector);
-	}
-
 	void ConstraintSolverManager::applyImpulse(WorkRigidBody *body1, WorkRigidBody *body2, const CommonSolvingData &commonData, const Vector3<float> &impulseVector)
 	{
-		body1->setLinearVelocity(body1->getLinearVelocity() - (impulseVector * body1->getInvMass() * body1->getLinearFactor()));
-		body1->setAngularVelocity(body1->getAngularVelocity() - (commonData.invInertia1 * commonData.r1.crossProduct(impulseVector * body1->getLinearFactor()) * body1->getAngularFactor()));
+		if(!body1->isStatic())
+		{
+			body1->setLinearVelocity(body1->getLinearVelocity() - (impulseVector * body1->getInvMass() * body1->getLinearFactor()));
+			body1->setAngularVelocity(body1->getAngularVelocity() - (commonData.invInertia1 * commonData.r1.crossProduct(impulseVector * body1->getLinearFactor()) * body1->getAngularFactor()));
+		}
 
-		body2->setLinearVelocity(body2->getLinearVelocity() + (impulseVector * body2->getInvMass() * body2->getLinearFactor()));
-		body2->setAngularVelocity(body2->getAngularVelocity() + (commonData.invInertia2 * commonData.r2.crossProduct(impulseVector * body2->getLinearFactor()) * body2->getAngularFactor()));
+		if(!body2->isStatic())
+		{
+			body2->setLinearVelocity(body2->getLinearVelocity() + (impulseVector * body2->getInvMass() * body2->getLinearFactor()));
+			body2->setAngularVelocity(body2->getAngularVelocity() + (commonData.invInertia2 * commonData.r2.crossProduct(impulseVector * body2->getLinearFactor()) * body2->getAngularFactor()));
+		}
 	}
 
 	/**
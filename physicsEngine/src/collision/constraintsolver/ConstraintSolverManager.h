@@ -6,10 +6,11 @@
 #include "UrchinCommon.h"
 
 #include "collision/constraintsolver/ConstraintSolving.h"
+#include "collision/constraintsolver/ConstraintSolvingBuffer.h"
 #include "collision/constraintsolver/solvingdata/CommonSolvingData.h"
 #include "collision/constraintsolver/solvingdata/ImpulseSolvingData.h"
-#include "body/BodyManager.h"
 #include "collision/ManifoldResult.h"
+#include "collision/island/IslandContainer.h"
 #include "utils/pool/FixedSizePool.h"
 #include "body/work/WorkRigidBody.h"
 
@@ -19,30 +20,46 @@ namespace urchin
 	class ConstraintSolverManager
 	{
 		public:
-			ConstraintSolverManager();
+			explicit ConstraintSolverManager(unsigned int);
 			~ConstraintSolverManager();
 
 			void solveConstraints(float, std::vector<ManifoldResult> &);
+			unsigned int getNumberOfConstraints() const;
 
 		private:
 			void setupConstraints(std::vector<ManifoldResult> &, float);
-			void solveConstraints();
+			void groupConstraintsByIsland();
+			void fillConstraintSolvingBuffer();
+			unsigned int retrieveBodyIndex(const WorkRigidBody *) const;
+			void solveBatchesConstraints(unsigned int, unsigned int);
 
 			CommonSolvingData fillCommonSolvingData(const ManifoldResult &, const ManifoldContactPoint &);
 			ImpulseSolvingData fillImpulseSolvingData(const CommonSolvingData &, float) const;
 
-			void solveNormalConstraint(ConstraintSolving *);
-			void solveTangentConstraint(ConstraintSolving *);
-
 			void applyImpulse(WorkRigidBody *, WorkRigidBody *, const CommonSolvingData &, const Vector3<float> &);
 			Vector3<float> computeRelativeVelocity(const CommonSolvingData &) const;
 			Vector3<float> computeTangent(const CommonSolvingData &, const Vector3<float> &) const;
 
 			void logCommonData(const std::string &, const CommonSolvingData &) const;
 
+			static const unsigned int MIN_CONSTRAINTS_BY_THREAD;
+
+			ThreadPool *const threadPool;
+
 			std::vector<ConstraintSolving *> constraintsSolving;
 			FixedSizePool<ConstraintSolving> *constraintSolvingPool;
 
+			IslandContainer islandContainer;
+			std::vector<unsigned int> elementsIslandIndex;
+			std::vector<std::vector<ConstraintSolving *>> islandsConstraintsSolving;
+			std::vector<unsigned int> islandsBatchStart;
+
+			ConstraintSolvingBuffer constraintSolvingBuffer;
+			std::vector<unsigned int> bodiesNextContactBatch;
+			std::vector<unsigned int> contactBatchesSize;
+			std::vector<std::pair<unsigned int, ConstraintSolving *>> constraintsBufferIndex;
+			std::vector<unsigned int> islandsBatchContactBatchStart;
+
 			const unsigned int constraintSolverIteration;
 			const float biasFactor;
 			const bool useWarmStarting;
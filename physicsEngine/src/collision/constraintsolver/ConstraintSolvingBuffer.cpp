@@ -0,0 +1,394 @@
+#include <cassert>
+#ifdef __SSE__
+	#include <xmmintrin.h>
+#endif
+
+#include "collision/constraintsolver/ConstraintSolvingBuffer.h"
+
+namespace urchin
+{
+
+	#ifdef __SSE__
+		namespace
+		{
+			struct BodiesVelocity
+			{
+				__m128 linearX, linearY, linearZ;
+				__m128 angularX, angularY, angularZ;
+			};
+
+			inline __m128 load(const std::vector<float> &values, unsigned int offset)
+			{
+				return _mm_loadu_ps(&values[offset]);
+			}
+
+			inline __m128 gather(const std::vector<float> &values, const unsigned int *indices)
+			{
+				return _mm_setr_ps(values[indices[0]], values[indices[1]], values[indices[2]], values[indices[3]]);
+			}
+
+			inline void scatter(std::vector<float> &values, const unsigned int *indices, __m128 lanes, unsigned int staticBodyIndex)
+			{
+				alignas(16) float lanesValue[4];
+				_mm_store_ps(lanesValue, lanes);
+				for(unsigned int lane=0; lane<4; ++lane)
+				{
+					if(indices[lane]!=staticBodyIndex)
+					{
+						values[indices[lane]] = lanesValue[lane];
+					}
+				}
+			}
+
+			inline __m128 dotProduct(__m128 x1, __m128 y1, __m128 z1, __m128 x2, __m128 y2, __m128 z2)
+			{
+				return _mm_add_ps(_mm_add_ps(_mm_mul_ps(x1, x2), _mm_mul_ps(y1, y2)), _mm_mul_ps(z1, z2));
+			}
+		}
+	#endif
+
+	//static
+	const unsigned int ConstraintSolvingBuffer::BATCH_SIZE = 4;
+
+	void ConstraintSolvingBuffer::VectorArray::resize(std::size_t size, float value)
+	{
+		X.assign(size, value);
+		Y.assign(size, value);
+		Z.assign(size, value);
+	}
+
+	void ConstraintSolvingBuffer::VectorArray::set(std::size_t index, const Vector3<float> &vector)
+	{
+		X[index] = vector.X;
+		Y[index] = vector.Y;
+		Z[index] = vector.Z;
+	}
+
+	ConstraintSolvingBuffer::ConstraintSolvingBuffer()
+	{
+		setupBodies(0);
+	}
+
+	/**
+	 * Prepare buffer for the bodies. An additional body at index getStaticBodyIndex() represents all static bodies.
+	 * @param numberOfBodies Number of non-static bodies
+	 */
+	void ConstraintSolvingBuffer::setupBodies(unsigned int numberOfBodies)
+	{
+		bodies.assign(numberOfBodies + 1, nullptr);
+		linearVelocity.resize(numberOfBodies + 1, 0.0f);
+		angularVelocity.resize(numberOfBodies + 1, 0.0f);
+	}
+
+	unsigned int ConstraintSolvingBuffer::getStaticBodyIndex() const
+	{
+		return bodies.size() - 1;
+	}
+
+	bool ConstraintSolvingBuffer::isBodyLoaded(unsigned int bodyIndex) const
+	{
+		return bodies[bodyIndex] != nullptr;
+	}
+
+	void ConstraintSolvingBuffer::loadBody(unsigned int bodyIndex, WorkRigidBody *body)
+	{
+		assert(bodyIndex!=getStaticBodyIndex());
+
+		bodies[bodyIndex] = body;
+		linearVelocity.set(bodyIndex, body->getLinearVelocity());
+		angularVelocity.set(bodyIndex, body->getAngularVelocity());
+	}
+
+	/**
+	 * Prepare buffer for the contacts. All contacts are initialized as empty contacts: empty contacts don't have any
+	 * effect on the bodies and can be used to fill incomplete batches.
+	 */
+	void ConstraintSolvingBuffer::setupContacts(unsigned int numberOfBatches)
+	{
+		std::size_t numberOfContacts = numberOfBatches * BATCH_SIZE;
+
+		body1Index.assign(numberOfContacts, getStaticBodyIndex());
+		body2Index.assign(numberOfContacts, getStaticBodyIndex());
+		accumulatedData.assign(numberOfContacts, nullptr);
+
+		for(auto *vectorArray : {&normal, &tangent, &r1CrossNormal, &r2CrossNormal, &r1CrossTangent, &r2CrossTangent,
+				&body1LinearNormal, &body1AngularNormal, &body2LinearNormal, &body2AngularNormal,
+				&body1LinearTangent, &body1AngularTangent, &body2LinearTangent, &body2AngularTangent})
+		{
+			vectorArray->resize(numberOfContacts, 0.0f);
+		}
+
+		for(auto *floatArray : {&invNormalImpulseDenominator, &invTangentImpulseDenominator, &bias, &friction, &accNormalImpulse, &accTangentImpulse})
+		{
+			floatArray->assign(numberOfContacts, 0.0f);
+		}
+	}
+
+	/**
+	 * @param contactIndex Index of contact in buffer. Contacts of a batch (contactIndex / BATCH_SIZE) cannot share a non-static body.
+	 * @param body1Index Index of body 1 in buffer or getStaticBodyIndex() when body 1 is static
+	 * @param body2Index Index of body 2 in buffer or getStaticBodyIndex() when body 2 is static
+	 */
+	void ConstraintSolvingBuffer::setContact(unsigned int contactIndex, unsigned int body1Index, unsigned int body2Index, ConstraintSolving *constraintSolving)
+	{
+		const CommonSolvingData &commonData = constraintSolving->getCommonData();
+		const ImpulseSolvingData &impulseData = constraintSolving->getImpulseData();
+		WorkRigidBody *body1 = constraintSolving->getBody1();
+		WorkRigidBody *body2 = constraintSolving->getBody2();
+
+		this->body1Index[contactIndex] = body1Index;
+		this->body2Index[contactIndex] = body2Index;
+		accumulatedData[contactIndex] = &constraintSolving->getAccumulatedData();
+
+		normal.set(contactIndex, commonData.contactNormal);
+		tangent.set(contactIndex, commonData.contactTangent);
+		r1CrossNormal.set(contactIndex, commonData.r1.crossProduct(commonData.contactNormal));
+		r2CrossNormal.set(contactIndex, commonData.r2.crossProduct(commonData.contactNormal));
+		r1CrossTangent.set(contactIndex, commonData.r1.crossProduct(commonData.contactTangent));
+		r2CrossTangent.set(contactIndex, commonData.r2.crossProduct(commonData.contactTangent));
+
+		if(!body1->isStatic())
+		{
+			body1LinearNormal.set(contactIndex, commonData.contactNormal * body1->getInvMass() * body1->getLinearFactor());
+			body1AngularNormal.set(contactIndex, commonData.invInertia1 * commonData.r1.crossProduct(commonData.contactNormal * body1->getLinearFactor()) * body1->getAngularFactor());
+			body1LinearTangent.set(contactIndex, commonData.contactTangent * body1->getInvMass() * body1->getLinearFactor());
+			body1AngularTangent.set(contactIndex, commonData.invInertia1 * commonData.r1.crossProduct(commonData.contactTangent * body1->getLinearFactor()) * body1->getAngularFactor());
+		}
+
+		if(!body2->isStatic())
+		{
+			body2LinearNormal.set(contactIndex, commonData.contactNormal * body2->getInvMass() * body2->getLinearFactor());
+			body2AngularNormal.set(contactIndex, commonData.invInertia2 * commonData.r2.crossProduct(commonData.contactNormal * body2->getLinearFactor()) * body2->getAngularFactor());
+			body2LinearTangent.set(contactIndex, commonData.contactTangent * body2->getInvMass() * body2->getLinearFactor());
+			body2AngularTangent.set(contactIndex, commonData.invInertia2 * commonData.r2.crossProduct(commonData.contactTangent * body2->getLinearFactor()) * body2->getAngularFactor());
+		}
+
+		invNormalImpulseDenominator[contactIndex] = 1.0f / impulseData.normalImpulseDenominator;
+		invTangentImpulseDenominator[contactIndex] = 1.0f / impulseData.tangentImpulseDenominator;
+		bias[contactIndex] = impulseData.bias;
+		friction[contactIndex] = impulseData.friction;
+		accNormalImpulse[contactIndex] = accumulatedData[contactIndex]->accNormalImpulse;
+		accTangentImpulse[contactIndex] = accumulatedData[contactIndex]->accTangentImpulse;
+	}
+
+	/**
+	 * Solve tangent constraints of batches in range [beginBatchIndex, endBatchIndex[. Tangent constraint is related to friction.
+	 */
+	void ConstraintSolvingBuffer::solveTangentConstraints(unsigned int beginBatchIndex, unsigned int endBatchIndex)
+	{
+		for(unsigned int batchIndex=beginBatchIndex; batchIndex<endBatchIndex; ++batchIndex)
+		{
+			#ifdef __SSE__
+				solveTangentConstraintsBatch(batchIndex);
+			#else
+				for(unsigned int contactIndex=batchIndex*BATCH_SIZE; contactIndex<(batchIndex+1)*BATCH_SIZE; ++contactIndex)
+				{
+					solveTangentConstraint(contactIndex);
+				}
+			#endif
+		}
+	}
+
+	/**
+	 * Solve normal constraints of batches in range [beginBatchIndex, endBatchIndex[. Normal constraint is related to non-penetration.
+	 */
+	void ConstraintSolvingBuffer::solveNormalConstraints(unsigned int beginBatchIndex, unsigned int endBatchIndex)
+	{
+		for(unsigned int batchIndex=beginBatchIndex; batchIndex<endBatchIndex; ++batchIndex)
+		{
+			#ifdef __SSE__
+				solveNormalConstraintsBatch(batchIndex);
+			#else
+				for(unsigned int contactIndex=batchIndex*BATCH_SIZE; contactIndex<(batchIndex+1)*BATCH_SIZE; ++contactIndex)
+				{
+					solveNormalConstraint(contactIndex);
+				}
+			#endif
+		}
+	}
+
+	/**
+	 * Apply velocities on bodies and store accumulated impulses for warm starting of next step
+	 */
+	void ConstraintSolvingBuffer::applyResults()
+	{
+		for(std::size_t bodyIndex=0; bodyIndex<bodies.size(); ++bodyIndex)
+		{
+			if(bodies[bodyIndex])
+			{
+				bodies[bodyIndex]->setLinearVelocity(Vector3<float>(linearVelocity.X[bodyIndex], linearVelocity.Y[bodyIndex], linearVelocity.Z[bodyIndex]));
+				bodies[bodyIndex]->setAngularVelocity(Vector3<float>(angularVelocity.X[bodyIndex], angularVelocity.Y[bodyIndex], angularVelocity.Z[bodyIndex]));
+			}
+		}
+
+		for(std::size_t contactIndex=0; contactIndex<accumulatedData.size(); ++contactIndex)
+		{
+			if(accumulatedData[contactIndex])
+			{
+				accumulatedData[contactIndex]->accNormalImpulse = accNormalImpulse[contactIndex];
+				accumulatedData[contactIndex]->accTangentImpulse = accTangentImpulse[contactIndex];
+			}
+		}
+	}
+
+	void ConstraintSolvingBuffer::solveTangentConstraint(unsigned int contactIndex)
+	{
+		float tangentRelativeVelocity = computeRelativeVelocity(contactIndex, tangent, r1CrossTangent, r2CrossTangent);
+
+		float tangentImpulse = -tangentRelativeVelocity * invTangentImpulseDenominator[contactIndex];
+		float maxFriction = -(friction[contactIndex] * accNormalImpulse[contactIndex]);
+
+		float oldAccTangentImpulse = accTangentImpulse[contactIndex];
+		accTangentImpulse[contactIndex] = MathAlgorithm::clamp(oldAccTangentImpulse + tangentImpulse, -maxFriction, maxFriction);
+		tangentImpulse = accTangentImpulse[contactIndex] - oldAccTangentImpulse;
+
+		applyImpulse(contactIndex, tangentImpulse, body1LinearTangent, body1AngularTangent, body2LinearTangent, body2AngularTangent);
+	}
+
+	void ConstraintSolvingBuffer::solveNormalConstraint(unsigned int contactIndex)
+	{
+		float normalRelativeVelocity = computeRelativeVelocity(contactIndex, normal, r1CrossNormal, r2CrossNormal);
+
+		float normalImpulse = (-normalRelativeVelocity + bias[contactIndex]) * invNormalImpulseDenominator[contactIndex];
+
+		float oldAccNormalImpulse = accNormalImpulse[contactIndex];
+		accNormalImpulse[contactIndex] = std::min(oldAccNormalImpulse + normalImpulse, 0.0f);
+		normalImpulse = accNormalImpulse[contactIndex] - oldAccNormalImpulse;
+
+		applyImpulse(contactIndex, normalImpulse, body1LinearNormal, body1AngularNormal, body2LinearNormal, body2AngularNormal);
+	}
+
+	/**
+	 * @return Relative velocity at the contact point along the direction
+	 */
+	float ConstraintSolvingBuffer::computeRelativeVelocity(unsigned int contactIndex, const VectorArray &direction,
+			const VectorArray &r1CrossDirection, const VectorArray &r2CrossDirection) const
+	{
+		unsigned int index1 = body1Index[contactIndex];
+		unsigned int index2 = body2Index[contactIndex];
+
+		float linearRelativeVelocity = (linearVelocity.X[index2] - linearVelocity.X[index1]) * direction.X[contactIndex]
+				+ (linearVelocity.Y[index2] - linearVelocity.Y[index1]) * direction.Y[contactIndex]
+				+ (linearVelocity.Z[index2] - linearVelocity.Z[index1]) * direction.Z[contactIndex];
+		float angularVelocity2 = angularVelocity.X[index2] * r2CrossDirection.X[contactIndex] + angularVelocity.Y[index2] * r2CrossDirection.Y[contactIndex]
+				+ angularVelocity.Z[index2] * r2CrossDirection.Z[contactIndex];
+		float angularVelocity1 = angularVelocity.X[index1] * r1CrossDirection.X[contactIndex] + angularVelocity.Y[index1] * r1CrossDirection.Y[contactIndex]
+				+ angularVelocity.Z[index1] * r1CrossDirection.Z[contactIndex];
+
+		return linearRelativeVelocity + angularVelocity2 - angularVelocity1;
+	}
+
+	void ConstraintSolvingBuffer::applyImpulse(unsigned int contactIndex, float impulse, const VectorArray &body1Linear, const VectorArray &body1Angular,
+			const VectorArray &body2Linear, const VectorArray &body2Angular)
+	{
+		unsigned int index1 = body1Index[contactIndex];
+		if(index1!=getStaticBodyIndex())
+		{
+			linearVelocity.X[index1] -= impulse * body1Linear.X[contactIndex];
+			linearVelocity.Y[index1] -= impulse * body1Linear.Y[contactIndex];
+			linearVelocity.Z[index1] -= impulse * body1Linear.Z[contactIndex];
+			angularVelocity.X[index1] -= impulse * body1Angular.X[contactIndex];
+			angularVelocity.Y[index1] -= impulse * body1Angular.Y[contactIndex];
+			angularVelocity.Z[index1] -= impulse * body1Angular.Z[contactIndex];
+		}
+
+		unsigned int index2 = body2Index[contactIndex];
+		if(index2!=getStaticBodyIndex())
+		{
+			linearVelocity.X[index2] += impulse * body2Linear.X[contactIndex];
+			linearVelocity.Y[index2] += impulse * body2Linear.Y[contactIndex];
+			linearVelocity.Z[index2] += impulse * body2Linear.Z[contactIndex];
+			angularVelocity.X[index2] += impulse * body2Angular.X[contactIndex];
+			angularVelocity.Y[index2] += impulse * body2Angular.Y[contactIndex];
+			angularVelocity.Z[index2] += impulse * body2Angular.Z[contactIndex];
+		}
+	}
+
+	#ifdef __SSE__
+		/**
+		 * SIMD version of solveTangentConstraint() for the contacts of a batch
+		 */
+		void ConstraintSolvingBuffer::solveTangentConstraintsBatch(unsigned int batchIndex)
+		{
+			unsigned int offset = batchIndex * BATCH_SIZE;
+			const unsigned int *indices1 = &body1Index[offset];
+			const unsigned int *indices2 = &body2Index[offset];
+
+			BodiesVelocity velocity1 = {gather(linearVelocity.X, indices1), gather(linearVelocity.Y, indices1), gather(linearVelocity.Z, indices1),
+					gather(angularVelocity.X, indices1), gather(angularVelocity.Y, indices1), gather(angularVelocity.Z, indices1)};
+			BodiesVelocity velocity2 = {gather(linearVelocity.X, indices2), gather(linearVelocity.Y, indices2), gather(linearVelocity.Z, indices2),
+					gather(angularVelocity.X, indices2), gather(angularVelocity.Y, indices2), gather(angularVelocity.Z, indices2)};
+
+			__m128 tangentRelativeVelocity = _mm_sub_ps(_mm_add_ps(
+					dotProduct(_mm_sub_ps(velocity2.linearX, velocity1.linearX), _mm_sub_ps(velocity2.linearY, velocity1.linearY), _mm_sub_ps(velocity2.linearZ, velocity1.linearZ),
+							load(tangent.X, offset), load(tangent.Y, offset), load(tangent.Z, offset)),
+					dotProduct(velocity2.angularX, velocity2.angularY, velocity2.angularZ, load(r2CrossTangent.X, offset), load(r2CrossTangent.Y, offset), load(r2CrossTangent.Z, offset))),
+					dotProduct(velocity1.angularX, velocity1.angularY, velocity1.angularZ, load(r1CrossTangent.X, offset), load(r1CrossTangent.Y, offset), load(r1CrossTangent.Z, offset)));
+
+			__m128 tangentImpulse = _mm_mul_ps(_mm_sub_ps(_mm_setzero_ps(), tangentRelativeVelocity), load(invTangentImpulseDenominator, offset));
+			__m128 maxFriction = _mm_sub_ps(_mm_setzero_ps(), _mm_mul_ps(load(friction, offset), load(accNormalImpulse, offset)));
+
+			__m128 oldAccTangentImpulse = load(accTangentImpulse, offset);
+			__m128 newAccTangentImpulse = _mm_max_ps(_mm_sub_ps(_mm_setzero_ps(), maxFriction), _mm_min_ps(maxFriction, _mm_add_ps(oldAccTangentImpulse, tangentImpulse)));
+			_mm_storeu_ps(&accTangentImpulse[offset], newAccTangentImpulse);
+			tangentImpulse = _mm_sub_ps(newAccTangentImpulse, oldAccTangentImpulse);
+
+			scatter(linearVelocity.X, indices1, _mm_sub_ps(velocity1.linearX, _mm_mul_ps(tangentImpulse, load(body1LinearTangent.X, offset))), getStaticBodyIndex());
+			scatter(linearVelocity.Y, indices1, _mm_sub_ps(velocity1.linearY, _mm_mul_ps(tangentImpulse, load(body1LinearTangent.Y, offset))), getStaticBodyIndex());
+			scatter(linearVelocity.Z, indices1, _mm_sub_ps(velocity1.linearZ, _mm_mul_ps(tangentImpulse, load(body1LinearTangent.Z, offset))), getStaticBodyIndex());
+			scatter(angularVelocity.X, indices1, _mm_sub_ps(velocity1.angularX, _mm_mul_ps(tangentImpulse, load(body1AngularTangent.X, offset))), getStaticBodyIndex());
+			scatter(angularVelocity.Y, indices1, _mm_sub_ps(velocity1.angularY, _mm_mul_ps(tangentImpulse, load(body1AngularTangent.Y, offset))), getStaticBodyIndex());
+			scatter(angularVelocity.Z, indices1, _mm_sub_ps(velocity1.angularZ, _mm_mul_ps(tangentImpulse, load(body1AngularTangent.Z, offset))), getStaticBodyIndex());
+
+			scatter(linearVelocity.X, indices2, _mm_add_ps(velocity2.linearX, _mm_mul_ps(tangentImpulse, load(body2LinearTangent.X, offset))), getStaticBodyIndex());
+			scatter(linearVelocity.Y, indices2, _mm_add_ps(velocity2.linearY, _mm_mul_ps(tangentImpulse, load(body2LinearTangent.Y, offset))), getStaticBodyIndex());
+			scatter(linearVelocity.Z, indices2, _mm_add_ps(velocity2.linearZ, _mm_mul_ps(tangentImpulse, load(body2LinearTangent.Z, offset))), getStaticBodyIndex());
+			scatter(angularVelocity.X, indices2, _mm_add_ps(velocity2.angularX, _mm_mul_ps(tangentImpulse, load(body2AngularTangent.X, offset))), getStaticBodyIndex());
+			scatter(angularVelocity.Y, indices2, _mm_add_ps(velocity2.angularY, _mm_mul_ps(tangentImpulse, load(body2AngularTangent.Y, offset))), getStaticBodyIndex());
+			scatter(angularVelocity.Z, indices2, _mm_add_ps(velocity2.angularZ, _mm_mul_ps(tangentImpulse, load(body2AngularTangent.Z, offset))), getStaticBodyIndex());
+		}
+
+		/**
+		 * SIMD version of solveNormalConstraint() for the contacts of a batch
+		 */
+		void ConstraintSolvingBuffer::solveNormalConstraintsBatch(unsigned int batchIndex)
+		{
+			unsigned int offset = batchIndex * BATCH_SIZE;
+			const unsigned int *indices1 = &body1Index[offset];
+			const unsigned int *indices2 = &body2Index[offset];
+
+			BodiesVelocity velocity1 = {gather(linearVelocity.X, indices1), gather(linearVelocity.Y, indices1), gather(linearVelocity.Z, indices1),
+					gather(angularVelocity.X, indices1), gather(angularVelocity.Y, indices1), gather(angularVelocity.Z, indices1)};
+			BodiesVelocity velocity2 = {gather(linearVelocity.X, indices2), gather(linearVelocity.Y, indices2), gather(linearVelocity.Z, indices2),
+					gather(angularVelocity.X, indices2), gather(angularVelocity.Y, indices2), gather(angularVelocity.Z, indices2)};
+
+			__m128 normalRelativeVelocity = _mm_sub_ps(_mm_add_ps(
+					dotProduct(_mm_sub_ps(velocity2.linearX, velocity1.linearX), _mm_sub_ps(velocity2.linearY, velocity1.linearY), _mm_sub_ps(velocity2.linearZ, velocity1.linearZ),
+							load(normal.X, offset), load(normal.Y, offset), load(normal.Z, offset)),
+					dotProduct(velocity2.angularX, velocity2.angularY, velocity2.angularZ, load(r2CrossNormal.X, offset), load(r2CrossNormal.Y, offset), load(r2CrossNormal.Z, offset))),
+					dotProduct(velocity1.angularX, velocity1.angularY, velocity1.angularZ, load(r1CrossNormal.X, offset), load(r1CrossNormal.Y, offset), load(r1CrossNormal.Z, offset)));
+
+			__m128 normalImpulse = _mm_mul_ps(_mm_sub_ps(load(bias, offset), normalRelativeVelocity), load(invNormalImpulseDenominator, offset));
+
+			__m128 oldAccNormalImpulse = load(accNormalImpulse, offset);
+			__m128 newAccNormalImpulse = _mm_min_ps(_mm_add_ps(oldAccNormalImpulse, normalImpulse), _mm_setzero_ps());
+			_mm_storeu_ps(&accNormalImpulse[offset], newAccNormalImpulse);
+			normalImpulse = _mm_sub_ps(newAccNormalImpulse, oldAccNormalImpulse);
+
+			scatter(linearVelocity.X, indices1, _mm_sub_ps(velocity1.linearX, _mm_mul_ps(normalImpulse, load(body1LinearNormal.X, offset))), getStaticBodyIndex());
+			scatter(linearVelocity.Y, indices1, _mm_sub_ps(velocity1.linearY, _mm_mul_ps(normalImpulse, load(body1LinearNormal.Y, offset))), getStaticBodyIndex());
+			scatter(linearVelocity.Z, indices1, _mm_sub_ps(velocity1.linearZ, _mm_mul_ps(normalImpulse, load(body1LinearNormal.Z, offset))), getStaticBodyIndex());
+			scatter(angularVelocity.X, indices1, _mm_sub_ps(velocity1.angularX, _mm_mul_ps(normalImpulse, load(body1AngularNormal.X, offset))), getStaticBodyIndex());
+			scatter(angularVelocity.Y, indices1, _mm_sub_ps(velocity1.angularY, _mm_mul_ps(normalImpulse, load(body1AngularNormal.Y, offset))), getStaticBodyIndex());
+			scatter(angularVelocity.Z, indices1, _mm_sub_ps(velocity1.angularZ, _mm_mul_ps(normalImpulse, load(body1AngularNormal.Z, offset))), getStaticBodyIndex());
+
+			scatter(linearVelocity.X, indices2, _mm_add_ps(velocity2.linearX, _mm_mul_ps(normalImpulse, load(body2LinearNormal.X, offset))), getStaticBodyIndex());
+			scatter(linearVelocity.Y, indices2, _mm_add_ps(velocity2.linearY, _mm_mul_ps(normalImpulse, load(body2LinearNormal.Y, offset))), getStaticBodyIndex());
+			scatter(linearVelocity.Z, indices2, _mm_add_ps(velocity2.linearZ, _mm_mul_ps(normalImpulse, load(body2LinearNormal.Z, offset))), getStaticBodyIndex());
+			scatter(angularVelocity.X, indices2, _mm_add_ps(velocity2.angularX, _mm_mul_ps(normalImpulse, load(body2AngularNormal.X, offset))), getStaticBodyIndex());
+			scatter(angularVelocity.Y, indices2, _mm_add_ps(velocity2.angularY, _mm_mul_ps(normalImpulse, load(body2AngularNormal.Y, offset))), getStaticBodyIndex());
+			scatter(angularVelocity.Z, indices2, _mm_add_ps(velocity2.angularZ, _mm_mul_ps(normalImpulse, load(body2AngularNormal.Z, offset))), getStaticBodyIndex());
+		}
+	#endif
+
+}
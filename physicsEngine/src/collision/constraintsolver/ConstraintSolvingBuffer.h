@@ -0,0 +1,84 @@
+#ifndef URCHINENGINE_CONSTRAINTSOLVINGBUFFER_H
+#define URCHINENGINE_CONSTRAINTSOLVINGBUFFER_H
+
+#include <vector>
+#include "UrchinCommon.h"
+
+#include "collision/constraintsolver/ConstraintSolving.h"
+#include "body/work/WorkRigidBody.h"
+
+namespace urchin
+{
+
+	/**
+	* Structure of arrays containing the data of contacts and bodies to solve. Contacts are grouped into batches of
+	* BATCH_SIZE contacts: contacts of a batch don't share any non-static body and are solved simultaneously with SIMD
+	* instructions.
+	*/
+	class ConstraintSolvingBuffer
+	{
+		public:
+			static const unsigned int BATCH_SIZE;
+
+			ConstraintSolvingBuffer();
+
+			void setupBodies(unsigned int);
+			unsigned int getStaticBodyIndex() const;
+			bool isBodyLoaded(unsigned int) const;
+			void loadBody(unsigned int, WorkRigidBody *);
+
+			void setupContacts(unsigned int);
+			void setContact(unsigned int, unsigned int, unsigned int, ConstraintSolving *);
+
+			void solveTangentConstraints(unsigned int, unsigned int);
+			void solveNormalConstraints(unsigned int, unsigned int);
+
+			void applyResults();
+
+		private:
+			struct VectorArray
+			{
+				void resize(std::size_t, float);
+				void set(std::size_t, const Vector3<float> &);
+
+				std::vector<float> X, Y, Z;
+			};
+
+			void solveTangentConstraint(unsigned int);
+			void solveNormalConstraint(unsigned int);
+			float computeRelativeVelocity(unsigned int, const VectorArray &, const VectorArray &, const VectorArray &) const;
+			void applyImpulse(unsigned int, float, const VectorArray &, const VectorArray &, const VectorArray &, const VectorArray &);
+
+			#ifdef __SSE__
+				void solveTangentConstraintsBatch(unsigned int);
+				void solveNormalConstraintsBatch(unsigned int);
+			#endif
+
+			//bodies data
+			std::vector<WorkRigidBody *> bodies;
+			VectorArray linearVelocity;
+			VectorArray angularVelocity;
+
+			//contacts data
+			std::vector<unsigned int> body1Index;
+			std::vector<unsigned int> body2Index;
+			std::vector<AccumulatedSolvingData *> accumulatedData;
+
+			VectorArray normal;
+			VectorArray tangent;
+			VectorArray r1CrossNormal, r2CrossNormal; //allow to compute angular velocity along normal
+			VectorArray r1CrossTangent, r2CrossTangent; //allow to compute angular velocity along tangent
+			VectorArray body1LinearNormal, body1AngularNormal, body2LinearNormal, body2AngularNormal; //velocity changes for an unit normal impulse
+			VectorArray body1LinearTangent, body1AngularTangent, body2LinearTangent, body2AngularTangent; //velocity changes for an unit tangent impulse
+
+			std::vector<float> invNormalImpulseDenominator;
+			std::vector<float> invTangentImpulseDenominator;
+			std::vector<float> bias;
+			std::vector<float> friction;
+			std::vector<float> accNormalImpulse;
+			std::vector<float> accTangentImpulse;
+	};
+
+}
+
+#endif
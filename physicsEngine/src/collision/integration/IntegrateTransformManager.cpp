@@ -23,7 +23,9 @@ namespace urchin
 	 */
 	void IntegrateTransformManager::integrateTransform(float dt)
 	{
-		for (auto abstractBody : bodyManager->getWorkBodies())
+		ScopeProfiler profiler("physics", "integTransform");
+
+		for (auto abstractBody : bodyManager->getActiveWorkBodies())
 		{
 			WorkRigidBody *body = WorkRigidBody::upCast(abstractBody);
 			if(body && body->isActive())
@@ -55,7 +57,7 @@ namespace urchin
 		{
 			auto bodyEncompassedSphereShape = std::make_shared<CollisionSphereShape>(body->getShape()->getMinDistanceToCenter());
 			TemporalObject temporalObject(bodyEncompassedSphereShape.get(), from, to);
-			ccd_set ccdResults = narrowPhaseManager->continuousCollisionTest(temporalObject, bodiesAABBoxHitBody);
+			ccd_set ccdResults = narrowPhaseManager->continuousCollisionTest(temporalObject, bodiesAABBoxHitBody, true);
 
 			if(!ccdResults.empty())
 			{
@@ -17,12 +17,14 @@ namespace urchin
 	 */
 	void IntegrateVelocityManager::integrateVelocity(float dt, const std::vector<OverlappingPair *> &overlappingPairs, const Vector3<float> &gravity)
 	{
+		ScopeProfiler profiler("physics", "integVelocity");
+
 		//apply internal forces
 		applyGravityForce(gravity, dt);
 		applyRollingFrictionResistanceForce(dt, overlappingPairs);
 
 		//integrate velocities and apply damping
-		for (auto abstractBody : bodyManager->getWorkBodies())
+		for (auto abstractBody : bodyManager->getActiveWorkBodies())
 		{
 			WorkRigidBody *body = WorkRigidBody::upCast(abstractBody);
 			if(body && body->isActive())
@@ -47,7 +49,7 @@ namespace urchin
 	 */
 	void IntegrateVelocityManager::applyGravityForce(const Vector3<float> &gravity, float dt)
 	{
-		for (auto abstractBody : bodyManager->getWorkBodies())
+		for (auto abstractBody : bodyManager->getActiveWorkBodies())
 		{
 			WorkRigidBody *body = WorkRigidBody::upCast(abstractBody);
 			if(body && body->isActive())
@@ -13,28 +13,58 @@ namespace urchin
 	}
 
 	/**
-	 * Reset the container of island elements. Create islands of one element for each island elements asked.
+	 * Reset the container of island elements. The container keeps its capacity: no allocation once the container is warmed up.
 	 */
-	void IslandContainer::reset(const std::vector<IslandElement *> &islandElements)
+	void IslandContainer::reset()
 	{
-	    containerSorted = false;
+		containerSorted = false;
 
 		islandElementsLink.clear();
-		islandElementsLink.resize(islandElements.size());
+	}
 
-		for(std::size_t i=0; i<islandElements.size(); ++i)
+	/**
+	 * Reset the container of island elements. Create islands of one element for each island elements asked.
+	 */
+	void IslandContainer::reset(const std::vector<IslandElement *> &islandElements)
+	{
+		reset();
+
+		for(auto islandElement : islandElements)
 		{
-			islandElements[i]->setIslandElementId(i);
+			addElement(islandElement);
+		}
+	}
 
-			islandElementsLink[i].element = islandElements[i];
-			islandElementsLink[i].linkedToStaticElement = !islandElements[i]->isActive();
-			islandElementsLink[i].islandIdRef = i;
+	/**
+	 * Create an island of one element. Element already present in the container is ignored.
+	 */
+	void IslandContainer::addElement(IslandElement *islandElement)
+	{
+		assert(!containerSorted);
+
+		if(containsElement(islandElement))
+		{
+			return;
 		}
+
+		auto islandElementId = static_cast<unsigned int>(islandElementsLink.size());
+		islandElement->setIslandElementId(islandElementId);
+
+		islandElementsLink.emplace_back(IslandElementLink());
+		islandElementsLink.back().element = islandElement;
+		islandElementsLink.back().linkedToStaticElement = !islandElement->isActive();
+		islandElementsLink.back().islandIdRef = islandElementId;
+	}
+
+	bool IslandContainer::containsElement(const IslandElement *islandElement) const
+	{
+		unsigned int islandElementId = islandElement->getIslandElementId();
+		return islandElementId < islandElementsLink.size() && islandElementsLink[islandElementId].element==islandElement;
 	}
 
 	void IslandContainer::mergeIsland(IslandElement *element1, IslandElement *element2)
 	{
-	    assert(!containerSorted);
+		assert(!containerSorted);
 
 		unsigned int islandId1 = findIslandId(element1->getIslandElementId());
 		unsigned int islandId2 = findIslandId(element2->getIslandElementId());
@@ -45,6 +75,7 @@ namespace urchin
 		}
 
 		islandElementsLink[islandId1].islandIdRef = islandId2;
+		islandElementsLink[islandId2].linkedToStaticElement = islandElementsLink[islandId2].linkedToStaticElement || islandElementsLink[islandId1].linkedToStaticElement;
 	}
 
 	void IslandContainer::linkToStaticElement(IslandElement *element)
@@ -54,10 +85,11 @@ namespace urchin
 	}
 
 	/**
-	 * Sorts the islands by ID and returns them.
-	 * Once the islands sorted, the container is not usable anymore and need to be reset.
+	 * Returns the island elements where 'islandIdRef' is the index of the island root element. The root element of an
+	 * island is linked to a static element when one of the island elements is linked to a static element.
+	 * Once the islands retrieved, the container is not usable anymore and need to be reset.
 	 */
-	const std::vector<IslandElementLink> &IslandContainer::retrieveSortedIslandElements()
+	const std::vector<IslandElementLink> &IslandContainer::retrieveIslandElements()
 	{
 		//store directly island ID on islandIdRef instead of reference
 		for(std::size_t i=0; i<islandElementsLink.size(); ++i)
@@ -65,18 +97,34 @@ namespace urchin
 			islandElementsLink[i].islandIdRef = findIslandId(i);
 		}
 
-		std::sort(islandElementsLink.begin(), islandElementsLink.end(), IslandElementLinkSortPredicate());
-
 		containerSorted = true;
 
 		return islandElementsLink;
 	}
 
-	unsigned int IslandContainer::findIslandId(unsigned int elementRef) const
+	/**
+	 * Sorts the islands by ID and returns them.
+	 * Once the islands sorted, the container is not usable anymore and need to be reset.
+	 */
+	const std::vector<IslandElementLink> &IslandContainer::retrieveSortedIslandElements()
+	{
+		retrieveIslandElements();
+
+		std::sort(islandElementsLink.begin(), islandElementsLink.end(), IslandElementLinkSortPredicate());
+
+		return islandElementsLink;
+	}
+
+	/**
+	 * Find the island ID of the element. Path is halved during the search to keep the next searches short.
+	 */
+	unsigned int IslandContainer::findIslandId(unsigned int elementRef)
 	{
 		while(elementRef!=islandElementsLink[elementRef].islandIdRef)
 		{
-			elementRef = islandElementsLink[elementRef].islandIdRef;
+			unsigned int grandParentRef = islandElementsLink[islandElementsLink[elementRef].islandIdRef].islandIdRef;
+			islandElementsLink[elementRef].islandIdRef = grandParentRef;
+			elementRef = grandParentRef;
 		}
 
 		return elementRef;
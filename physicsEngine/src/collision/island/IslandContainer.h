@@ -18,15 +18,19 @@ namespace urchin
 		public:
 			IslandContainer();
 
+			void reset();
 			void reset(const std::vector<IslandElement *> &);
+			void addElement(IslandElement *);
+			bool containsElement(const IslandElement *) const;
 			void mergeIsland(IslandElement *, IslandElement *);
 			void linkToStaticElement(IslandElement *);
 
+			const std::vector<IslandElementLink> &retrieveIslandElements();
 			const std::vector<IslandElementLink> &retrieveSortedIslandElements();
 			unsigned int getSize() const;
 
 		private:
-			unsigned int findIslandId(unsigned int) const;
+			unsigned int findIslandId(unsigned int);
 
 			std::vector<IslandElementLink> islandElementsLink;
 
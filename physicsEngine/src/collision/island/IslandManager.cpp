@@ -17,75 +17,69 @@ namespace urchin
 	/**
 	 * Refresh body active state. If all bodies of an island can sleep, we set their status to inactive.
 	 * If one body of the island cannot sleep, we set their status to active.
-	 * @param overlappingPairs Overlapping pairs of broad phase used to determine the islands
+	 * Only the active bodies and the bodies in contact with them are processed: the other bodies are sleeping in
+	 * islands which stay unchanged until an active body touches them.
+	 * @param manifoldResults Manifold results of narrow phase used to determine the islands
 	 */
 	void IslandManager::refreshBodyActiveState(const std::vector<ManifoldResult> &manifoldResults)
 	{
 		ScopeProfiler profiler("physics", "refreshBodyStat");
 
 		buildIslands(manifoldResults);
-		const std::vector<IslandElementLink> &islandElementsLink = islandContainer.retrieveSortedIslandElements();
+		const std::vector<IslandElementLink> &islandElementsLink = islandContainer.retrieveIslandElements();
 
-		if(DEBUG_PRINT_ISLANDS)
-        {
-		    printIslands(islandElementsLink);
-        }
+		islandsMoving.assign(islandElementsLink.size(), false);
+		for(const auto &islandElementLink : islandElementsLink)
+		{ //an island is moving when one of its elements is moving
+			if(!islandsMoving[islandElementLink.islandIdRef])
+			{
+				islandsMoving[islandElementLink.islandIdRef] = isBodyMoving(static_cast<WorkRigidBody *>(islandElementLink.element));
+			}
+		}
 
-		unsigned int i=0;
-		while(islandElementsLink.size()>i)
-		{ //loop on islands
-			unsigned int startElementIndex = i;
-			unsigned int nbElements = computeNumberElements(islandElementsLink, startElementIndex);
-
-			bool islandLinkedToStaticElement = false;
-			bool islandBodiesCanSleep = true;
-			for(unsigned int j=0; j<nbElements; ++j)
-			{ //loop on elements of the island
-				auto *body = dynamic_cast<WorkRigidBody *>(islandElementsLink[startElementIndex+j].element);
-				if(isBodyMoving(body))
-				{
-					islandBodiesCanSleep = false;
-					break;
-				}
+		for(const auto &islandElementLink : islandElementsLink)
+		{
+			unsigned int islandId = islandElementLink.islandIdRef;
+			bool islandBodiesCanSleep = !islandsMoving[islandId]
+					&& islandElementsLink[islandId].linkedToStaticElement; //one element of the island must be in contact with a static element to sleep the island
 
-				islandLinkedToStaticElement = islandLinkedToStaticElement || islandElementsLink[startElementIndex+j].linkedToStaticElement;
-			}
-			islandBodiesCanSleep = islandBodiesCanSleep && islandLinkedToStaticElement; //one element of the island must be in contact with a static element to sleep the island
+			auto *body = static_cast<WorkRigidBody *>(islandElementLink.element);
+			bool bodyActiveState = !islandBodiesCanSleep;
+			if(body->isActive()!=bodyActiveState)
+			{
+				body->setIsActive(bodyActiveState);
 
-			for(unsigned int j=0; j<nbElements; ++j)
-			{ //loop on elements of the island
-				auto *body = dynamic_cast<WorkRigidBody *>(islandElementsLink[startElementIndex+j].element);
-				bool bodyActiveState = !islandBodiesCanSleep;
-				if(body->isActive()!=bodyActiveState)
+				if(bodyActiveState)
 				{
-					body->setIsActive(bodyActiveState);
-
-					if(bodyActiveState)
-					{
-						body->setLinearVelocity(Vector3<float>(0.0, 0.0, 0.0));
-						body->setAngularVelocity(Vector3<float>(0.0, 0.0, 0.0));
-					}
+					body->setLinearVelocity(Vector3<float>(0.0, 0.0, 0.0));
+					body->setAngularVelocity(Vector3<float>(0.0, 0.0, 0.0));
 				}
 			}
+		}
 
-			i += nbElements;
+		if(DEBUG_PRINT_ISLANDS)
+		{
+			printIslands(islandContainer.retrieveSortedIslandElements());
 		}
 	}
 
+	/**
+	 * Build islands of the active bodies and of the bodies in contact with them. Island elements are only rigid bodies:
+	 * ghost bodies are excluded and static bodies are only used to link an island to a static element.
+	 */
 	void IslandManager::buildIslands(const std::vector<ManifoldResult> &manifoldResults)
 	{
-		//1. create an island for each body
-		islandElements.clear();
-		for (auto body : bodyManager->getWorkBodies())
+		//1. create an island for each active body
+		islandContainer.reset();
+		for (auto body : bodyManager->getActiveWorkBodies())
 		{
-			if(!body->isStatic())
+			if(!body->isGhostBody())
 			{
-				islandElements.push_back(body);
+				islandContainer.addElement(body);
 			}
 		}
-		islandContainer.reset(islandElements);
 
-		//2. merge islands for bodies in contact
+		//2. merge islands for bodies in contact: inactive bodies in contact with an active body join the islands
 		for(const auto &manifoldResult : manifoldResults)
 		{
 			if(manifoldResult.getNumContactPoints() > 0)
@@ -95,12 +89,16 @@ namespace urchin
 
 				if(!body1->isStatic() && !body2->isStatic())
 				{
+					islandContainer.addElement(body1);
+					islandContainer.addElement(body2);
 					islandContainer.mergeIsland(body1, body2);
 				}else if(!body1->isStatic() && body2->isStatic())
 				{
+					islandContainer.addElement(body1);
 					islandContainer.linkToStaticElement(body1);
 				}else if(!body2->isStatic() && body1->isStatic())
 				{
+					islandContainer.addElement(body2);
 					islandContainer.linkToStaticElement(body2);
 				}
 			}
@@ -141,7 +139,7 @@ namespace urchin
 
             for(unsigned int j=0; j<nbElements; ++j)
             { //loop on elements of the island
-                auto *body = dynamic_cast<WorkRigidBody *>(islandElementsLink[startElementIndex+j].element);
+                auto *body = static_cast<WorkRigidBody *>(islandElementsLink[startElementIndex+j].element);
                 std::cout<<"  - Body: "<<body->getId()<<" (moving: "<<isBodyMoving(body)<<", active: "<<body->isActive()<<")"<<std::endl;
             }
 
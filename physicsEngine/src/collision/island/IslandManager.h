@@ -26,8 +26,8 @@ namespace urchin
             void printIslands(const std::vector<IslandElementLink> &);
 
 			const BodyManager *bodyManager;
-			std::vector<IslandElement *> islandElements;
 			IslandContainer islandContainer;
+			std::vector<bool> islandsMoving;
 
 			const float squaredLinearSleepingThreshold;
 			const float squaredAngularSleepingThreshold;
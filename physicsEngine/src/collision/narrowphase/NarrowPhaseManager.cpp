@@ -1,25 +1,46 @@
+#include <iterator>
+
 #include "collision/narrowphase/NarrowPhaseManager.h"
 #include "shape/CollisionShape3D.h"
 #include "shape/CollisionSphereShape.h"
 #include "shape/CollisionCompoundShape.h"
 #include "shape/CollisionConcaveShape.h"
 #include "body/work/WorkRigidBody.h"
+#include "collision/broadphase/SyncVectorPairContainer.h"
 #include "object/TemporalObject.h"
+#include "object/pool/CollisionConvexObjectPool.h"
+#include "collision/narrowphase/algorithm/utils/AlgorithmResultAllocator.h"
+#include "utils/property/EagerPropertyLoader.h"
+#include "statistics/ScopeThreadStatistics.h"
 
 namespace urchin
 {
 
-	NarrowPhaseManager::NarrowPhaseManager(const BodyManager *bodyManager, const BroadPhaseManager *broadPhaseManager) :
+	//static
+	const unsigned int NarrowPhaseManager::MIN_PAIRS_BY_THREAD = 16;
+
+	/**
+	 * @param numberOfThreads Number of threads processing the pairs (1: pairs processed by physics thread only)
+	 */
+	NarrowPhaseManager::NarrowPhaseManager(const BodyManager *bodyManager, const BroadPhaseManager *broadPhaseManager, unsigned int numberOfThreads) :
 			bodyManager(bodyManager),
 			broadPhaseManager(broadPhaseManager),
 			collisionAlgorithmSelector(new CollisionAlgorithmSelector()),
-			bodiesMutex(LockById::getInstance("narrowPhaseBodyIds"))
+			bodiesMutex(std::make_shared<LockById>("narrowPhaseBodyIds")),
+			threadPool(new ThreadPool(numberOfThreads))
 	{
+		threadsManifoldResults.resize(threadPool->getNumberOfThreads());
+		threadsStatistics.resize(threadPool->getNumberOfThreads());
 
+		//create singletons used by narrow phase threads before the threads use them: singleton creation is not thread safe
+		CollisionConvexObjectPool::instance();
+		AlgorithmResultAllocator::instance();
+		EagerPropertyLoader::instance();
 	}
 
 	NarrowPhaseManager::~NarrowPhaseManager()
 	{
+		delete threadPool;
 		delete collisionAlgorithmSelector;
 	}
 
@@ -51,13 +72,68 @@ namespace urchin
         }
 	}
 
+	/**
+	 * Process ghost body on its own overlapping pairs: collision algorithms are kept on the pairs between two calls. This method must be
+	 * called from the physics thread while the collision world is not processed. It can be called concurrently for different ghost bodies.
+	 * @param ghostBody Ghost body to process
+	 * @param manifoldResults [OUT] Collision constraints
+	 */
+	void NarrowPhaseManager::processGhostBodyFromPhysicsThread(WorkGhostBody *ghostBody, std::vector<ManifoldResult> &manifoldResults)
+	{
+		for(auto overlappingPair : ghostBody->getSyncPairContainer()->getOverlappingPairsFromPhysicsThread())
+		{
+			processOverlappingPair(overlappingPair, manifoldResults);
+		}
+	}
+
 	void NarrowPhaseManager::processOverlappingPairs(const std::vector<OverlappingPair *> &overlappingPairs, std::vector<ManifoldResult> &manifoldResults)
 	{
 		ScopeProfiler profiler("physics", "procOverlapPair");
 
-		for(const auto &overlappingPair : overlappingPairs)
+		std::size_t numberOfPairs = overlappingPairs.size();
+		auto numberOfTasks = static_cast<unsigned int>(std::min(static_cast<std::size_t>(threadPool->getNumberOfThreads()),
+				(numberOfPairs + MIN_PAIRS_BY_THREAD - 1) / MIN_PAIRS_BY_THREAD));
+
+		if(numberOfTasks <= 1)
+		{
+			processOverlappingPairsRange(overlappingPairs, 0, numberOfPairs, manifoldResults);
+			return;
+		}
+
+		//each thread processes a contiguous range of pairs and fills its own manifold results and statistics
+		PhysicsStatistics *statistics = ScopeThreadStatistics::current();
+		threadPool->parallelFor(numberOfTasks, [&](unsigned int taskIndex){
+			std::vector<ManifoldResult> &threadManifoldResults = threadsManifoldResults[taskIndex];
+			threadManifoldResults.clear();
+			threadsStatistics[taskIndex].reset();
+			ScopeThreadStatistics scopeThreadStatistics(statistics ? &threadsStatistics[taskIndex] : nullptr);
+
+			std::size_t beginIndex = (numberOfPairs * taskIndex) / numberOfTasks;
+			std::size_t endIndex = (numberOfPairs * (taskIndex + 1)) / numberOfTasks;
+			processOverlappingPairsRange(overlappingPairs, beginIndex, endIndex, threadManifoldResults);
+		});
+
+		//merge in ranges order: manifold results order is identical to a serial processing
+		for(unsigned int taskIndex=0; taskIndex<numberOfTasks; ++taskIndex)
+		{
+			for(const auto &threadManifoldResult : threadsManifoldResults[taskIndex])
+			{
+				manifoldResults.push_back(threadManifoldResult);
+			}
+
+			if(statistics)
+			{
+				statistics->merge(threadsStatistics[taskIndex]);
+			}
+		}
+	}
+
+	void NarrowPhaseManager::processOverlappingPairsRange(const std::vector<OverlappingPair *> &overlappingPairs, std::size_t beginIndex, std::size_t endIndex,
+			std::vector<ManifoldResult> &manifoldResults)
+	{
+		for(std::size_t i=beginIndex; i<endIndex; ++i)
 		{
-            processOverlappingPair(overlappingPair, manifoldResults);
+			processOverlappingPair(overlappingPairs[i], manifoldResults);
 		}
 	}
 
@@ -68,10 +144,20 @@ namespace urchin
 
         if(body1->isActive() || body2->isActive())
         {
-            ScopeLockById lockBody1(bodiesMutex, body1->getObjectId());
-            ScopeLockById lockBody2(bodiesMutex, body2->getObjectId());
+            //only concave shapes have thread unsafe caches. Locks are acquired in same order to avoid dead lock between threads.
+            AbstractWorkBody *firstBody = body1->getObjectId() < body2->getObjectId() ? body1 : body2;
+            AbstractWorkBody *secondBody = body1->getObjectId() < body2->getObjectId() ? body2 : body1;
+            std::optional<ScopeLockById> lockFirstBody, lockSecondBody;
+            if(firstBody->getShape()->isConcave())
+            {
+                lockFirstBody.emplace(bodiesMutex, firstBody->getObjectId());
+            }
+            if(secondBody->getShape()->isConcave())
+            {
+                lockSecondBody.emplace(bodiesMutex, secondBody->getObjectId());
+            }
 
-            std::shared_ptr<CollisionAlgorithm> collisionAlgorithm = retrieveCollisionAlgorithm(overlappingPair);
+            CollisionAlgorithm *collisionAlgorithm = retrieveCollisionAlgorithm(overlappingPair);
 
             CollisionObjectWrapper collisionObject1(*body1->getShape(), body1->getPhysicsTransform());
             CollisionObjectWrapper collisionObject2(*body2->getShape(), body2->getPhysicsTransform());
@@ -84,27 +170,31 @@ namespace urchin
         }
     }
 
-	std::shared_ptr<CollisionAlgorithm> NarrowPhaseManager::retrieveCollisionAlgorithm(OverlappingPair *overlappingPair)
+	CollisionAlgorithm *NarrowPhaseManager::retrieveCollisionAlgorithm(OverlappingPair *overlappingPair)
 	{
-		std::shared_ptr<CollisionAlgorithm> collisionAlgorithm = overlappingPair->getCollisionAlgorithm();
+		CollisionAlgorithm *collisionAlgorithm = overlappingPair->getCollisionAlgorithm();
 		if(!collisionAlgorithm)
 		{
 			AbstractWorkBody *body1 = overlappingPair->getBody1();
 			AbstractWorkBody *body2 = overlappingPair->getBody2();
 
-			collisionAlgorithm = collisionAlgorithmSelector->createCollisionAlgorithm(body1, body1->getShape(), body2, body2->getShape());
-
-			overlappingPair->setCollisionAlgorithm(collisionAlgorithm);
+			overlappingPair->setCollisionAlgorithm(collisionAlgorithmSelector->createCollisionAlgorithm(body1, body1->getShape(), body2, body2->getShape()));
+			collisionAlgorithm = overlappingPair->getCollisionAlgorithm();
 		}
 
 		return collisionAlgorithm;
 	}
 
+	PoolStatistics NarrowPhaseManager::getAlgorithmPoolStatistics() const
+	{
+		return collisionAlgorithmSelector->getAlgorithmPoolStatistics();
+	}
+
 	void NarrowPhaseManager::processPredictiveContacts(float dt, std::vector<ManifoldResult> &manifoldResults)
 	{
 		ScopeProfiler profiler("physics", "proPrediContact");
 
-		for (auto workBody : bodyManager->getWorkBodies())
+		for (auto workBody : bodyManager->getActiveWorkBodies())
 		{
 			WorkRigidBody *body = WorkRigidBody::upCast(workBody);
 			if(body && body->isActive())
@@ -140,12 +230,12 @@ namespace urchin
 				for(const auto &localizedShape : localizedShapes)
 				{
 					TemporalObject temporalObject(localizedShape->shape.get(), from * localizedShape->transform, to * localizedShape->transform);
-                    ccdResults.merge(continuousCollisionTest(temporalObject, bodiesAABBoxHitBody));
+                    ccdResults.merge(continuousCollisionTest(temporalObject, bodiesAABBoxHitBody, true));
 				}
 			}else if(bodyShape->isConvex())
 			{
 				TemporalObject temporalObject(body->getShape(), from, to);
-				ccdResults = continuousCollisionTest(temporalObject, bodiesAABBoxHitBody);
+				ccdResults = continuousCollisionTest(temporalObject, bodiesAABBoxHitBody, true);
 			}else
 			{
 				throw std::invalid_argument("Unknown shape type category: " + std::to_string(bodyShape->getShapeType()));
@@ -168,9 +258,15 @@ namespace urchin
 		}
 	}
 
-	ccd_set NarrowPhaseManager::continuousCollisionTest(const TemporalObject &temporalObject1, const std::vector<AbstractWorkBody *> &bodiesAABBoxHit) const
+	/**
+	 * @param closestHitOnly Only the closest hit is returned. Concave shapes hit by a ray only test their closest triangle.
+	 * @return Hits sorted by time of impact
+	 */
+	ccd_set NarrowPhaseManager::continuousCollisionTest(const TemporalObject &temporalObject1, const std::vector<AbstractWorkBody *> &bodiesAABBoxHit,
+			bool closestHitOnly) const
 	{
 		ccd_set continuousCollisionResults;
+		std::vector<std::size_t> triangleIndices; //call-local: method can be called concurrently by several threads
 
 		for(auto bodyAABBoxHit : bodiesAABBoxHit)
 		{
@@ -202,36 +298,41 @@ namespace urchin
                 AABBox<float> fromAABBoxLocalToObject1 = temporalObject1.getShape()->toAABBox(inverseTransformObject2 * temporalObject1.getFrom());
                 AABBox<float> toAABBoxLocalToObject1 = temporalObject1.getShape()->toAABBox(inverseTransformObject2 * temporalObject1.getTo());
 
+                triangleIndices.clear();
                 if(temporalObject1.isRay())
                 {
                     LineSegment3D<float> ray(fromAABBoxLocalToObject1.getMin(), toAABBoxLocalToObject1.getMin());
-                    const std::vector<CollisionTriangleShape> &triangles = concaveShape->findTrianglesHitByRay(ray);
-
-                    trianglesContinuousCollisionTest(triangles, temporalObject1, bodyAABBoxHit, continuousCollisionResults);
+                    concaveShape->findTriangleIndicesHitByRay(ray, closestHitOnly, triangleIndices);
                 }else
                 {
                     AABBox<float> temporalAABBoxLocalToObject1 = fromAABBoxLocalToObject1.merge(toAABBoxLocalToObject1);
-                    const std::vector<CollisionTriangleShape> &triangles = concaveShape->findTrianglesInAABBox(temporalAABBoxLocalToObject1);
-
-                    trianglesContinuousCollisionTest(triangles, temporalObject1, bodyAABBoxHit, continuousCollisionResults);
+                    concaveShape->findTriangleIndicesInAABBox(temporalAABBoxLocalToObject1, triangleIndices);
                 }
+
+                trianglesContinuousCollisionTest(*concaveShape, triangleIndices, temporalObject1, bodyAABBoxHit, continuousCollisionResults);
 			}else
 			{
                 throw std::invalid_argument("Unknown shape type category: " + std::to_string(bodyShape->getShapeType()));
 			}
 		}
 
+		if(closestHitOnly && continuousCollisionResults.size() > 1)
+		{
+			continuousCollisionResults.erase(std::next(continuousCollisionResults.begin()), continuousCollisionResults.end());
+		}
+
 		return continuousCollisionResults;
 	}
 
     /**
      * @param continuousCollisionResults [OUT] In case of collision detected: continuous collision result will be updated with collision details
      */
-	void NarrowPhaseManager::trianglesContinuousCollisionTest(const std::vector<CollisionTriangleShape> &triangles, const TemporalObject &temporalObject1,
-	        AbstractWorkBody *body2, ccd_set &continuousCollisionResults) const
+	void NarrowPhaseManager::trianglesContinuousCollisionTest(const CollisionConcaveShape &concaveShape, const std::vector<std::size_t> &triangleIndices,
+	        const TemporalObject &temporalObject1, AbstractWorkBody *body2, ccd_set &continuousCollisionResults) const
     {
-        for(const auto &triangle : triangles)
+        for(std::size_t triangleIndex : triangleIndices)
         {
+            CollisionTriangleShape triangle = concaveShape.createTriangleShape(triangleIndex);
             const PhysicsTransform &fromToObject2 = body2->getPhysicsTransform();
             TemporalObject temporalObject2(&triangle, fromToObject2, fromToObject2);
 
@@ -245,6 +346,12 @@ namespace urchin
 	void NarrowPhaseManager::continuousCollisionTest(const TemporalObject &temporalObject1, const TemporalObject &temporalObject2,
 			AbstractWorkBody *body2, ccd_set &continuousCollisionResults) const
 	{
+		PhysicsStatistics *statistics = ScopeThreadStatistics::current();
+		if(statistics)
+		{
+			statistics->ccdTests++;
+		}
+
 		std::unique_ptr<ContinuousCollisionResult<float>, AlgorithmResultDeleter> continuousCollisionResult = gjkContinuousCollisionAlgorithm
 				.calculateTimeOfImpact(temporalObject1, temporalObject2, body2);
 
@@ -261,7 +368,7 @@ namespace urchin
 		PhysicsTransform to = PhysicsTransform(ray.computeTo());
 		TemporalObject rayCastObject(&pointShape, from, to);
 
-		return continuousCollisionTest(rayCastObject, bodiesAABBoxHitRay);
+		return continuousCollisionTest(rayCastObject, bodiesAABBoxHitRay, false);
 	}
 
 }
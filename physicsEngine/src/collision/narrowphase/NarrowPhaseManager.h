@@ -4,6 +4,7 @@
 #include <memory>
 #include <vector>
 #include <mutex>
+#include <optional>
 #include "UrchinCommon.h"
 
 #include "collision/ManifoldResult.h"
@@ -18,29 +19,35 @@
 #include "body/work/WorkGhostBody.h"
 #include "object/TemporalObject.h"
 #include "shape/CollisionTriangleShape.h"
+#include "shape/CollisionConcaveShape.h"
+#include "statistics/PhysicsStatistics.h"
 
 namespace urchin
 {
 	class NarrowPhaseManager
 	{
 		public:
-			NarrowPhaseManager(const BodyManager *, const BroadPhaseManager *);
+			NarrowPhaseManager(const BodyManager *, const BroadPhaseManager *, unsigned int);
 			~NarrowPhaseManager();
 
 			void process(float, const std::vector<OverlappingPair *> &, std::vector<ManifoldResult> &);
 			void processGhostBody(WorkGhostBody *, std::vector<ManifoldResult> &);
+			void processGhostBodyFromPhysicsThread(WorkGhostBody *, std::vector<ManifoldResult> &);
 
-			ccd_set continuousCollisionTest(const TemporalObject &,  const std::vector<AbstractWorkBody *> &) const;
+			CollisionAlgorithm *retrieveCollisionAlgorithm(OverlappingPair *);
+			PoolStatistics getAlgorithmPoolStatistics() const;
+
+			ccd_set continuousCollisionTest(const TemporalObject &, const std::vector<AbstractWorkBody *> &, bool) const;
 			ccd_set rayTest(const Ray<float> &, const std::vector<AbstractWorkBody *> &) const;
 
 		private:
 			void processOverlappingPairs(const std::vector<OverlappingPair *> &, std::vector<ManifoldResult> &);
+			void processOverlappingPairsRange(const std::vector<OverlappingPair *> &, std::size_t, std::size_t, std::vector<ManifoldResult> &);
 			void processOverlappingPair(OverlappingPair *, std::vector<ManifoldResult> &);
-			std::shared_ptr<CollisionAlgorithm> retrieveCollisionAlgorithm(OverlappingPair *);
 
 			void processPredictiveContacts(float, std::vector<ManifoldResult> &);
 			void handleContinuousCollision(AbstractWorkBody *, const PhysicsTransform &, const PhysicsTransform &, std::vector<ManifoldResult> &);
-			void trianglesContinuousCollisionTest(const std::vector<CollisionTriangleShape> &, const TemporalObject &, AbstractWorkBody *, ccd_set &) const;
+			void trianglesContinuousCollisionTest(const CollisionConcaveShape &, const std::vector<std::size_t> &, const TemporalObject &, AbstractWorkBody *, ccd_set &) const;
 			void continuousCollisionTest(const TemporalObject &, const TemporalObject &, AbstractWorkBody *, ccd_set &) const;
 
 			const BodyManager *bodyManager;
@@ -50,6 +57,11 @@ namespace urchin
 			const GJKContinuousCollisionAlgorithm<double, float> gjkContinuousCollisionAlgorithm;
 
 			std::shared_ptr<LockById> bodiesMutex;
+
+			static const unsigned int MIN_PAIRS_BY_THREAD;
+			ThreadPool *const threadPool;
+			std::vector<std::vector<ManifoldResult>> threadsManifoldResults;
+			std::vector<PhysicsStatistics> threadsStatistics;
 	};
 
 }
@@ -0,0 +1,284 @@
+#include <limits>
+#include <cmath>
+
+#include "collision/narrowphase/algorithm/BoxBoxCollisionAlgorithm.h"
+#include "shape/CollisionBoxShape.h"
+
+#define PARALLEL_EDGES_EPSILON 0.0001f
+#define EDGE_RELATIVE_TOLERANCE 0.95f
+#define EDGE_ABSOLUTE_TOLERANCE 0.001f
+#define MAX_CLIPPED_POINTS 8
+
+namespace urchin
+{
+
+	BoxBoxCollisionAlgorithm::BoxBoxCollisionAlgorithm(bool objectSwapped, ManifoldResult &&result) :
+			CollisionAlgorithm(objectSwapped, std::move(result))
+	{
+
+	}
+
+	/**
+	 * Separating axis test on the 15 axes of the boxes (3 face axes per box and 9 cross products of edges). When the
+	 * axis of minimum penetration is a face axis, the incident face is clipped against the reference face: all contact
+	 * points are found in one process.
+	 */
+	void BoxBoxCollisionAlgorithm::doProcessCollisionAlgorithm(const CollisionObjectWrapper &object1, const CollisionObjectWrapper &object2)
+	{
+		ScopeProfiler profiler("physics", "algBoxBox");
+
+		const auto &box1 = dynamic_cast<const CollisionBoxShape &>(object1.getShape());
+		const auto &box2 = dynamic_cast<const CollisionBoxShape &>(object2.getShape());
+
+		OBBox<float> obbox1(box1.getHalfSizes(), object1.getShapeWorldTransform().getPosition(), object1.getShapeWorldTransform().getOrientation());
+		OBBox<float> obbox2(box2.getHalfSizes(), object2.getShapeWorldTransform().getPosition(), object2.getShapeWorldTransform().getOrientation());
+		Vector3<float> centerVector = obbox1.getCenterOfMass().vector(obbox2.getCenterOfMass());
+
+		//face axes
+		float bestFaceSeparation = -std::numeric_limits<float>::max();
+		unsigned int bestFaceAxisIndex = 0;
+		bool isBestFaceOnBox1 = true;
+		for(unsigned int boxIndex=0; boxIndex<2; ++boxIndex)
+		{
+			const OBBox<float> &faceBox = (boxIndex==0) ? obbox1 : obbox2;
+			for(unsigned int i=0; i<3; ++i)
+			{
+				float separation = computeSeparation(obbox1, obbox2, faceBox.getAxis(i), centerVector);
+				if(separation > getContactBreakingThreshold())
+				{
+					return;
+				}
+
+				if(separation > bestFaceSeparation)
+				{
+					bestFaceSeparation = separation;
+					bestFaceAxisIndex = i;
+					isBestFaceOnBox1 = (boxIndex==0);
+				}
+			}
+		}
+
+		//edge axes
+		float bestEdgeSeparation = -std::numeric_limits<float>::max();
+		unsigned int bestEdgeAxisIndex1 = 0, bestEdgeAxisIndex2 = 0;
+		Vector3<float> bestEdgeAxis;
+		for(unsigned int i=0; i<3; ++i)
+		{
+			for(unsigned int j=0; j<3; ++j)
+			{
+				Vector3<float> axis = obbox1.getAxis(i).crossProduct(obbox2.getAxis(j));
+				float axisLength = axis.length();
+				if(axisLength < PARALLEL_EDGES_EPSILON)
+				{ //parallel edges: axis already tested by face axes
+					continue;
+				}
+				axis /= axisLength;
+
+				float separation = computeSeparation(obbox1, obbox2, axis, centerVector);
+				if(separation > getContactBreakingThreshold())
+				{
+					return;
+				}
+
+				if(separation > bestEdgeSeparation)
+				{
+					bestEdgeSeparation = separation;
+					bestEdgeAxisIndex1 = i;
+					bestEdgeAxisIndex2 = j;
+					bestEdgeAxis = axis;
+				}
+			}
+		}
+
+		//face contact is preferred to edge contact for stability
+		if(bestEdgeSeparation > EDGE_RELATIVE_TOLERANCE * bestFaceSeparation + EDGE_ABSOLUTE_TOLERANCE)
+		{
+			Vector3<float> normalFromBox1 = (centerVector.dotProduct(bestEdgeAxis) < 0.0f) ? -bestEdgeAxis : bestEdgeAxis;
+			processEdgeContact(obbox1, bestEdgeAxisIndex1, obbox2, bestEdgeAxisIndex2, normalFromBox1);
+		}else if(isBestFaceOnBox1)
+		{
+			const Vector3<float> &faceAxis = obbox1.getAxis(bestFaceAxisIndex);
+			Vector3<float> referenceNormal = (centerVector.dotProduct(faceAxis) < 0.0f) ? -faceAxis : faceAxis;
+			processFaceContact(obbox1, bestFaceAxisIndex, referenceNormal, obbox2, true);
+		}else
+		{
+			const Vector3<float> &faceAxis = obbox2.getAxis(bestFaceAxisIndex);
+			Vector3<float> referenceNormal = (centerVector.dotProduct(faceAxis) > 0.0f) ? -faceAxis : faceAxis;
+			processFaceContact(obbox2, bestFaceAxisIndex, referenceNormal, obbox1, false);
+		}
+	}
+
+	/**
+	 * @return Distance between projections of the boxes on the axis (negative when projections overlap)
+	 */
+	float BoxBoxCollisionAlgorithm::computeSeparation(const OBBox<float> &obbox1, const OBBox<float> &obbox2, const Vector3<float> &axis,
+			const Vector3<float> &centerVector) const
+	{
+		return std::abs(centerVector.dotProduct(axis)) - computeProjectedHalfSize(obbox1, axis) - computeProjectedHalfSize(obbox2, axis);
+	}
+
+	float BoxBoxCollisionAlgorithm::computeProjectedHalfSize(const OBBox<float> &obbox, const Vector3<float> &axis) const
+	{
+		return obbox.getHalfSize(0) * std::abs(obbox.getAxis(0).dotProduct(axis))
+			+ obbox.getHalfSize(1) * std::abs(obbox.getAxis(1).dotProduct(axis))
+			+ obbox.getHalfSize(2) * std::abs(obbox.getAxis(2).dotProduct(axis));
+	}
+
+	/**
+	 * @param referenceNormal Normal of the reference face oriented toward the incident box
+	 * @param isReferenceBox1 Indicates whether the reference box is the object 1
+	 */
+	void BoxBoxCollisionAlgorithm::processFaceContact(const OBBox<float> &referenceBox, unsigned int referenceAxisIndex, const Vector3<float> &referenceNormal,
+			const OBBox<float> &incidentBox, bool isReferenceBox1)
+	{
+		//incident face: face of incident box the most anti-parallel to reference normal
+		unsigned int incidentAxisIndex = 0;
+		float maxAbsDotProduct = -1.0f;
+		for(unsigned int i=0; i<3; ++i)
+		{
+			float absDotProduct = std::abs(incidentBox.getAxis(i).dotProduct(referenceNormal));
+			if(absDotProduct > maxAbsDotProduct)
+			{
+				maxAbsDotProduct = absDotProduct;
+				incidentAxisIndex = i;
+			}
+		}
+		const Vector3<float> &incidentAxis = incidentBox.getAxis(incidentAxisIndex);
+		Vector3<float> incidentNormal = (incidentAxis.dotProduct(referenceNormal) > 0.0f) ? -incidentAxis : incidentAxis;
+		Point3<float> incidentFaceCenter = incidentBox.getCenterOfMass().translate(incidentNormal * incidentBox.getHalfSize(incidentAxisIndex));
+
+		unsigned int incidentAxisIndexU = (incidentAxisIndex + 1) % 3;
+		unsigned int incidentAxisIndexV = (incidentAxisIndex + 2) % 3;
+		Vector3<float> incidentU = incidentBox.getAxis(incidentAxisIndexU) * incidentBox.getHalfSize(incidentAxisIndexU);
+		Vector3<float> incidentV = incidentBox.getAxis(incidentAxisIndexV) * incidentBox.getHalfSize(incidentAxisIndexV);
+
+		Point3<float> polygon[MAX_CLIPPED_POINTS];
+		polygon[0] = incidentFaceCenter.translate(incidentU + incidentV);
+		polygon[1] = incidentFaceCenter.translate(-incidentU + incidentV);
+		polygon[2] = incidentFaceCenter.translate(-incidentU - incidentV);
+		polygon[3] = incidentFaceCenter.translate(incidentU - incidentV);
+		unsigned int nbPoints = 4;
+
+		//clip incident face against side planes of reference face
+		Point3<float> clippedPolygon[MAX_CLIPPED_POINTS];
+		for(unsigned int sideAxisOffset=1; sideAxisOffset<3; ++sideAxisOffset)
+		{
+			unsigned int sideAxisIndex = (referenceAxisIndex + sideAxisOffset) % 3;
+			const Vector3<float> &sideAxis = referenceBox.getAxis(sideAxisIndex);
+			float centerProjection = sideAxis.dotProduct(referenceBox.getCenterOfMass().toVector());
+			float sideHalfSize = referenceBox.getHalfSize(sideAxisIndex);
+
+			nbPoints = clipPolygon(polygon, nbPoints, sideAxis, centerProjection + sideHalfSize, clippedPolygon);
+			nbPoints = clipPolygon(clippedPolygon, nbPoints, -sideAxis, -centerProjection + sideHalfSize, polygon);
+		}
+
+		//keep points below reference face
+		float referenceFaceOffset = referenceNormal.dotProduct(referenceBox.getCenterOfMass().toVector()) + referenceBox.getHalfSize(referenceAxisIndex);
+		for(unsigned int i=0; i<nbPoints; ++i)
+		{
+			float depth = referenceNormal.dotProduct(polygon[i].toVector()) - referenceFaceOffset;
+			if(depth < getContactBreakingThreshold())
+			{
+				if(isReferenceBox1)
+				{ //incident points are on object 2
+					addNewContactPoint(-referenceNormal, polygon[i], depth);
+				}else
+				{ //reference face is on object 2
+					addNewContactPoint(referenceNormal, polygon[i].translate(-referenceNormal * depth), depth);
+				}
+			}
+		}
+	}
+
+	/**
+	 * Clips a convex polygon by a plane (Sutherland-Hodgman). Points in front of the plane are removed.
+	 * @param clippedPolygon [out] Clipped polygon
+	 * @return Number of points of the clipped polygon
+	 */
+	unsigned int BoxBoxCollisionAlgorithm::clipPolygon(const Point3<float> *polygon, unsigned int nbPoints, const Vector3<float> &planeNormal,
+			float planeOffset, Point3<float> *clippedPolygon) const
+	{
+		unsigned int nbClippedPoints = 0;
+		for(unsigned int i=0; i<nbPoints; ++i)
+		{
+			const Point3<float> &point1 = polygon[i];
+			const Point3<float> &point2 = polygon[(i + 1) % nbPoints];
+			float distance1 = planeNormal.dotProduct(point1.toVector()) - planeOffset;
+			float distance2 = planeNormal.dotProduct(point2.toVector()) - planeOffset;
+
+			if(distance1 <= 0.0f)
+			{
+				clippedPolygon[nbClippedPoints++] = point1;
+			}
+
+			if((distance1 < 0.0f && distance2 > 0.0f) || (distance1 > 0.0f && distance2 < 0.0f))
+			{
+				float t = distance1 / (distance1 - distance2);
+				clippedPolygon[nbClippedPoints++] = point1.translate(point1.vector(point2) * t);
+			}
+		}
+
+		return nbClippedPoints;
+	}
+
+	/**
+	 * @param normalFromBox1 Separating axis oriented from box 1 toward box 2
+	 */
+	void BoxBoxCollisionAlgorithm::processEdgeContact(const OBBox<float> &obbox1, unsigned int edgeAxisIndex1, const OBBox<float> &obbox2,
+			unsigned int edgeAxisIndex2, const Vector3<float> &normalFromBox1)
+	{
+		LineSegment3D<float> edge1 = computeSupportEdge(obbox1, edgeAxisIndex1, normalFromBox1);
+		LineSegment3D<float> edge2 = computeSupportEdge(obbox2, edgeAxisIndex2, -normalFromBox1);
+
+		Point3<float> pointOnEdge1, pointOnEdge2;
+		edge1.closestPoints(edge2, pointOnEdge1, pointOnEdge2);
+
+		Vector3<float> normalFromObject2 = -normalFromBox1;
+		float depth = pointOnEdge2.vector(pointOnEdge1).dotProduct(normalFromObject2);
+		if(depth < getContactBreakingThreshold())
+		{
+			addNewContactPoint(normalFromObject2, pointOnEdge2, depth);
+		}
+	}
+
+	/**
+	 * @return Edge of the box parallel to the axis and the farthest in the direction
+	 */
+	LineSegment3D<float> BoxBoxCollisionAlgorithm::computeSupportEdge(const OBBox<float> &obbox, unsigned int edgeAxisIndex, const Vector3<float> &direction) const
+	{
+		Point3<float> edgeCenter = obbox.getCenterOfMass();
+		for(unsigned int i=0; i<3; ++i)
+		{
+			if(i!=edgeAxisIndex)
+			{
+				float sign = (obbox.getAxis(i).dotProduct(direction) < 0.0f) ? -1.0f : 1.0f;
+				edgeCenter = edgeCenter.translate(obbox.getAxis(i) * (sign * obbox.getHalfSize(i)));
+			}
+		}
+
+		Vector3<float> halfEdge = obbox.getAxis(edgeAxisIndex) * obbox.getHalfSize(edgeAxisIndex);
+		return LineSegment3D<float>(edgeCenter.translate(-halfEdge), edgeCenter.translate(halfEdge));
+	}
+
+	CollisionAlgorithm::AlgorithmType BoxBoxCollisionAlgorithm::getAlgorithmType() const
+	{
+		return BOX_BOX;
+	}
+
+	CollisionAlgorithm *BoxBoxCollisionAlgorithm::Builder::createCollisionAlgorithm(bool objectSwapped, ManifoldResult &&result, FixedSizePool<CollisionAlgorithm> *algorithmPool) const
+	{
+		void *memPtr = algorithmPool->allocate(sizeof(BoxBoxCollisionAlgorithm));
+		return new(memPtr) BoxBoxCollisionAlgorithm(objectSwapped, std::move(result));
+	}
+
+	const std::vector<CollisionShape3D::ShapeType> &BoxBoxCollisionAlgorithm::Builder::getFirstExpectedShapeType() const
+	{
+		return CollisionShape3D::BOX_SHAPES;
+	}
+
+	unsigned int BoxBoxCollisionAlgorithm::Builder::getAlgorithmSize() const
+	{
+		return sizeof(BoxBoxCollisionAlgorithm);
+	}
+
+}
@@ -0,0 +1,44 @@
+#ifndef URCHINENGINE_BOXBOXCOLLISIONALGORITHM_H
+#define URCHINENGINE_BOXBOXCOLLISIONALGORITHM_H
+
+#include "UrchinCommon.h"
+
+#include "collision/narrowphase/algorithm/CollisionAlgorithm.h"
+#include "collision/narrowphase/algorithm/CollisionAlgorithmBuilder.h"
+#include "collision/ManifoldResult.h"
+#include "collision/narrowphase/CollisionObjectWrapper.h"
+
+namespace urchin
+{
+
+	class BoxBoxCollisionAlgorithm : public CollisionAlgorithm
+	{
+		public:
+			BoxBoxCollisionAlgorithm(bool, ManifoldResult &&);
+			~BoxBoxCollisionAlgorithm() override = default;
+
+			void doProcessCollisionAlgorithm(const CollisionObjectWrapper &, const CollisionObjectWrapper &) override;
+			AlgorithmType getAlgorithmType() const override;
+
+			struct Builder : public CollisionAlgorithmBuilder
+			{
+				CollisionAlgorithm *createCollisionAlgorithm(bool, ManifoldResult &&, FixedSizePool<CollisionAlgorithm> *) const override;
+
+				const std::vector<CollisionShape3D::ShapeType> &getFirstExpectedShapeType() const override;
+				unsigned int getAlgorithmSize() const override;
+			};
+
+		private:
+			float computeSeparation(const OBBox<float> &, const OBBox<float> &, const Vector3<float> &, const Vector3<float> &) const;
+			float computeProjectedHalfSize(const OBBox<float> &, const Vector3<float> &) const;
+
+			void processFaceContact(const OBBox<float> &, unsigned int, const Vector3<float> &, const OBBox<float> &, bool);
+			unsigned int clipPolygon(const Point3<float> *, unsigned int, const Vector3<float> &, float, Point3<float> *) const;
+
+			void processEdgeContact(const OBBox<float> &, unsigned int, const OBBox<float> &, unsigned int, const Vector3<float> &);
+			LineSegment3D<float> computeSupportEdge(const OBBox<float> &, unsigned int, const Vector3<float> &) const;
+	};
+
+}
+
+#endif
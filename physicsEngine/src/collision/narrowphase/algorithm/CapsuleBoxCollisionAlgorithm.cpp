@@ -0,0 +1,293 @@
+#include <limits>
+#include <cmath>
+
+#include "collision/narrowphase/algorithm/CapsuleBoxCollisionAlgorithm.h"
+#include "shape/CollisionCapsuleShape.h"
+#include "shape/CollisionBoxShape.h"
+
+#define FACE_NORMAL_COSINE 0.999f
+#define PARALLEL_AXIS_EPSILON 0.0001f
+
+namespace urchin
+{
+
+	CapsuleBoxCollisionAlgorithm::CapsuleBoxCollisionAlgorithm(bool objectSwapped, ManifoldResult &&result) :
+			CollisionAlgorithm(objectSwapped, std::move(result))
+	{
+
+	}
+
+	/**
+	 * Capsule segment is transformed in box local space. When the segment doesn't cross the box, contact points are
+	 * computed from the closest points between the segment and the box. Otherwise, the separating axis of minimum
+	 * penetration is searched among the box face axes and the cross products of segment with box axes.
+	 */
+	void CapsuleBoxCollisionAlgorithm::doProcessCollisionAlgorithm(const CollisionObjectWrapper &object1, const CollisionObjectWrapper &object2)
+	{
+		ScopeProfiler profiler("physics", "algCapsuleBox");
+
+		const auto &capsule1 = dynamic_cast<const CollisionCapsuleShape &>(object1.getShape());
+		const auto &box2 = dynamic_cast<const CollisionBoxShape &>(object2.getShape());
+		const PhysicsTransform &capsuleTransform = object1.getShapeWorldTransform();
+		const PhysicsTransform &boxTransform = object2.getShapeWorldTransform();
+
+		Point3<float> localHalfSegment(0.0f, 0.0f, 0.0f);
+		localHalfSegment[capsule1.getCapsuleOrientation()] = capsule1.getCylinderHeight() / 2.0f;
+		Vector3<float> halfSegment = capsuleTransform.getOrientation().rotatePoint(localHalfSegment).toVector();
+		LineSegment3D<float> segmentLocalBox(boxTransform.inverseTransform(capsuleTransform.getPosition().translate(-halfSegment)),
+				boxTransform.inverseTransform(capsuleTransform.getPosition().translate(halfSegment)));
+
+		float tMin, tMax;
+		if(clipSegment(segmentLocalBox, box2.getHalfSizes(), 3, tMin, tMax))
+		{
+			processIntersectingSegment(segmentLocalBox, capsule1.getRadius(), box2.getHalfSizes(), boxTransform);
+		}else
+		{
+			processSeparatedSegment(segmentLocalBox, capsule1.getRadius(), box2.getHalfSizes(), boxTransform);
+		}
+	}
+
+	/**
+	 * Clips the segment by the slabs of the box (Liang-Barsky)
+	 * @param ignoredAxisIndex Index of axis which is not clipped (3 to clip on all axes)
+	 * @param tMin [out] Start of the clipped segment (0.0 for point A, 1.0 for point B)
+	 * @param tMax [out] End of the clipped segment (0.0 for point A, 1.0 for point B)
+	 * @return True when a part of the segment is inside the slabs
+	 */
+	bool CapsuleBoxCollisionAlgorithm::clipSegment(const LineSegment3D<float> &segment, const Vector3<float> &halfSizes, unsigned int ignoredAxisIndex,
+			float &tMin, float &tMax) const
+	{
+		tMin = 0.0f;
+		tMax = 1.0f;
+		Vector3<float> segmentVector = segment.toVector();
+		for(unsigned int i=0; i<3; ++i)
+		{
+			if(i==ignoredAxisIndex)
+			{
+				continue;
+			}
+
+			if(std::abs(segmentVector[i]) < std::numeric_limits<float>::epsilon())
+			{
+				if(std::abs(segment.getA()[i]) > halfSizes[i])
+				{
+					return false;
+				}
+			}else
+			{
+				float t1 = (-halfSizes[i] - segment.getA()[i]) / segmentVector[i];
+				float t2 = (halfSizes[i] - segment.getA()[i]) / segmentVector[i];
+				tMin = std::max(tMin, std::min(t1, t2));
+				tMax = std::min(tMax, std::max(t1, t2));
+				if(tMin > tMax)
+				{
+					return false;
+				}
+			}
+		}
+
+		return true;
+	}
+
+	void CapsuleBoxCollisionAlgorithm::processSeparatedSegment(const LineSegment3D<float> &segmentLocalBox, float radius, const Vector3<float> &halfSizes,
+			const PhysicsTransform &boxTransform)
+	{
+		//closest points: segment extremities against box and segment against box edges
+		float minSquareDistance = std::numeric_limits<float>::max();
+		Point3<float> closestPointOnSegment, closestPointOnBox;
+		for(const Point3<float> &segmentExtremity : {segmentLocalBox.getA(), segmentLocalBox.getB()})
+		{
+			Point3<float> pointOnBox(
+					MathAlgorithm::clamp(segmentExtremity.X, -halfSizes.X, halfSizes.X),
+					MathAlgorithm::clamp(segmentExtremity.Y, -halfSizes.Y, halfSizes.Y),
+					MathAlgorithm::clamp(segmentExtremity.Z, -halfSizes.Z, halfSizes.Z));
+			float squareDistance = pointOnBox.vector(segmentExtremity).squareLength();
+			if(squareDistance < minSquareDistance)
+			{
+				minSquareDistance = squareDistance;
+				closestPointOnSegment = segmentExtremity;
+				closestPointOnBox = pointOnBox;
+			}
+		}
+		for(unsigned int edgeAxisIndex=0; edgeAxisIndex<3; ++edgeAxisIndex)
+		{
+			unsigned int axisIndexU = (edgeAxisIndex + 1) % 3;
+			unsigned int axisIndexV = (edgeAxisIndex + 2) % 3;
+			for(unsigned int edgeIndex=0; edgeIndex<4; ++edgeIndex)
+			{
+				Point3<float> edgeA, edgeB;
+				edgeA[axisIndexU] = edgeB[axisIndexU] = (edgeIndex & 1u) ? halfSizes[axisIndexU] : -halfSizes[axisIndexU];
+				edgeA[axisIndexV] = edgeB[axisIndexV] = (edgeIndex & 2u) ? halfSizes[axisIndexV] : -halfSizes[axisIndexV];
+				edgeA[edgeAxisIndex] = -halfSizes[edgeAxisIndex];
+				edgeB[edgeAxisIndex] = halfSizes[edgeAxisIndex];
+
+				Point3<float> pointOnSegment, pointOnEdge;
+				segmentLocalBox.closestPoints(LineSegment3D<float>(edgeA, edgeB), pointOnSegment, pointOnEdge);
+				float squareDistance = pointOnEdge.vector(pointOnSegment).squareLength();
+				if(squareDistance < minSquareDistance)
+				{
+					minSquareDistance = squareDistance;
+					closestPointOnSegment = pointOnSegment;
+					closestPointOnBox = pointOnEdge;
+				}
+			}
+		}
+
+		float distance = std::sqrt(minSquareDistance);
+		float depth = distance - radius;
+		if(depth >= getContactBreakingThreshold() || distance <= std::numeric_limits<float>::epsilon())
+		{
+			return;
+		}
+		Vector3<float> localNormal = closestPointOnBox.vector(closestPointOnSegment) / distance;
+
+		//capsule in front of a box face: contact points on the segment part above the face
+		for(unsigned int i=0; i<3; ++i)
+		{
+			if(std::abs(localNormal[i]) > FACE_NORMAL_COSINE)
+			{
+				if(processFaceContact(segmentLocalBox, radius, halfSizes, i, MathAlgorithm::sign<float>(localNormal[i]), boxTransform))
+				{
+					return;
+				}
+				break;
+			}
+		}
+
+		addLocalContactPoint(localNormal, closestPointOnBox, depth, boxTransform);
+	}
+
+	void CapsuleBoxCollisionAlgorithm::processIntersectingSegment(const LineSegment3D<float> &segmentLocalBox, float radius, const Vector3<float> &halfSizes,
+			const PhysicsTransform &boxTransform)
+	{
+		Vector3<float> segmentVector = segmentLocalBox.toVector();
+
+		float bestSeparation = -std::numeric_limits<float>::max();
+		unsigned int bestAxisIndex = 0;
+		Vector3<float> bestNormal;
+		for(unsigned int axisIndex=0; axisIndex<6; ++axisIndex)
+		{ //axis 0 to 2: box face axes, axis 3 to 5: cross products of segment with box axes
+			Vector3<float> axis(0.0f, 0.0f, 0.0f);
+			axis[axisIndex % 3] = 1.0f;
+			if(axisIndex >= 3)
+			{
+				axis = segmentVector.crossProduct(axis);
+				float axisLength = axis.length();
+				if(axisLength < PARALLEL_AXIS_EPSILON)
+				{
+					continue;
+				}
+				axis /= axisLength;
+			}
+
+			float boxProjectedHalfSize = halfSizes.X * std::abs(axis.X) + halfSizes.Y * std::abs(axis.Y) + halfSizes.Z * std::abs(axis.Z);
+			float projectionA = segmentLocalBox.getA().toVector().dotProduct(axis);
+			float projectionB = segmentLocalBox.getB().toVector().dotProduct(axis);
+			float positiveSideSeparation = std::min(projectionA, projectionB) - radius - boxProjectedHalfSize;
+			float negativeSideSeparation = -boxProjectedHalfSize - std::max(projectionA, projectionB) - radius;
+
+			float separation = std::max(positiveSideSeparation, negativeSideSeparation);
+			if(separation > bestSeparation)
+			{
+				bestSeparation = separation;
+				bestAxisIndex = axisIndex;
+				bestNormal = (positiveSideSeparation >= negativeSideSeparation) ? axis : -axis;
+			}
+		}
+
+		if(bestAxisIndex < 3)
+		{
+			if(processFaceContact(segmentLocalBox, radius, halfSizes, bestAxisIndex, MathAlgorithm::sign<float>(bestNormal[bestAxisIndex]), boxTransform))
+			{
+				return;
+			}
+		}
+
+		//box edge parallel to the axis and supporting the normal
+		unsigned int edgeAxisIndex = bestAxisIndex % 3;
+		Point3<float> edgeA, edgeB;
+		for(unsigned int i=0; i<3; ++i)
+		{
+			edgeA[i] = edgeB[i] = (bestNormal[i] < 0.0f) ? -halfSizes[i] : halfSizes[i];
+		}
+		edgeA[edgeAxisIndex] = -halfSizes[edgeAxisIndex];
+		edgeB[edgeAxisIndex] = halfSizes[edgeAxisIndex];
+
+		Point3<float> pointOnSegment, pointOnEdge;
+		segmentLocalBox.closestPoints(LineSegment3D<float>(edgeA, edgeB), pointOnSegment, pointOnEdge);
+		float depth = pointOnEdge.vector(pointOnSegment).dotProduct(bestNormal) - radius;
+		if(depth < getContactBreakingThreshold())
+		{
+			addLocalContactPoint(bestNormal, pointOnEdge, depth, boxTransform);
+		}
+	}
+
+	/**
+	 * Adds contact points at the extremities of the segment part in front of the box face
+	 * @return False when no part of the segment is in front of the box face
+	 */
+	bool CapsuleBoxCollisionAlgorithm::processFaceContact(const LineSegment3D<float> &segmentLocalBox, float radius, const Vector3<float> &halfSizes,
+			unsigned int faceAxisIndex, float faceSign, const PhysicsTransform &boxTransform)
+	{
+		float tMin, tMax;
+		if(!clipSegment(segmentLocalBox, halfSizes, faceAxisIndex, tMin, tMax))
+		{
+			return false;
+		}
+
+		Vector3<float> localFaceNormal(0.0f, 0.0f, 0.0f);
+		localFaceNormal[faceAxisIndex] = faceSign;
+		Vector3<float> segmentVector = segmentLocalBox.toVector();
+		for(float t : {tMin, tMax})
+		{
+			Point3<float> pointOnSegment = segmentLocalBox.getA().translate(segmentVector * t);
+			float depth = faceSign * pointOnSegment[faceAxisIndex] - halfSizes[faceAxisIndex] - radius;
+			if(depth < getContactBreakingThreshold())
+			{
+				Point3<float> pointOnFace = pointOnSegment;
+				pointOnFace[faceAxisIndex] = faceSign * halfSizes[faceAxisIndex];
+				addLocalContactPoint(localFaceNormal, pointOnFace, depth, boxTransform);
+			}
+
+			if(tMax - tMin <= std::numeric_limits<float>::epsilon())
+			{ //segment part reduced to a point
+				break;
+			}
+		}
+
+		return true;
+	}
+
+	/**
+	 * @param localNormalFromBox Contact normal in box local space (from box toward capsule)
+	 * @param localPointOnBox Contact point on box in box local space
+	 */
+	void CapsuleBoxCollisionAlgorithm::addLocalContactPoint(const Vector3<float> &localNormalFromBox, const Point3<float> &localPointOnBox, float depth,
+			const PhysicsTransform &boxTransform)
+	{
+		Vector3<float> normalFromObject2 = boxTransform.getOrientation().rotatePoint(Point3<float>(localNormalFromBox.X, localNormalFromBox.Y, localNormalFromBox.Z)).toVector();
+		addNewContactPoint(normalFromObject2, boxTransform.transform(localPointOnBox), depth);
+	}
+
+	CollisionAlgorithm::AlgorithmType CapsuleBoxCollisionAlgorithm::getAlgorithmType() const
+	{
+		return CAPSULE_BOX;
+	}
+
+	CollisionAlgorithm *CapsuleBoxCollisionAlgorithm::Builder::createCollisionAlgorithm(bool objectSwapped, ManifoldResult &&result, FixedSizePool<CollisionAlgorithm> *algorithmPool) const
+	{
+		void *memPtr = algorithmPool->allocate(sizeof(CapsuleBoxCollisionAlgorithm));
+		return new(memPtr) CapsuleBoxCollisionAlgorithm(objectSwapped, std::move(result));
+	}
+
+	const std::vector<CollisionShape3D::ShapeType> &CapsuleBoxCollisionAlgorithm::Builder::getFirstExpectedShapeType() const
+	{
+		return CollisionShape3D::CAPSULE_SHAPES;
+	}
+
+	unsigned int CapsuleBoxCollisionAlgorithm::Builder::getAlgorithmSize() const
+	{
+		return sizeof(CapsuleBoxCollisionAlgorithm);
+	}
+
+}
@@ -0,0 +1,43 @@
+#ifndef URCHINENGINE_CAPSULEBOXCOLLISIONALGORITHM_H
+#define URCHINENGINE_CAPSULEBOXCOLLISIONALGORITHM_H
+
+#include "UrchinCommon.h"
+
+#include "collision/narrowphase/algorithm/CollisionAlgorithm.h"
+#include "collision/narrowphase/algorithm/CollisionAlgorithmBuilder.h"
+#include "collision/ManifoldResult.h"
+#include "collision/narrowphase/CollisionObjectWrapper.h"
+
+namespace urchin
+{
+
+	class CapsuleBoxCollisionAlgorithm : public CollisionAlgorithm
+	{
+		public:
+			CapsuleBoxCollisionAlgorithm(bool, ManifoldResult &&);
+			~CapsuleBoxCollisionAlgorithm() override = default;
+
+			void doProcessCollisionAlgorithm(const CollisionObjectWrapper &, const CollisionObjectWrapper &) override;
+			AlgorithmType getAlgorithmType() const override;
+
+			struct Builder : public CollisionAlgorithmBuilder
+			{
+				CollisionAlgorithm *createCollisionAlgorithm(bool, ManifoldResult &&, FixedSizePool<CollisionAlgorithm> *) const override;
+
+				const std::vector<CollisionShape3D::ShapeType> &getFirstExpectedShapeType() const override;
+				unsigned int getAlgorithmSize() const override;
+			};
+
+		private:
+			bool clipSegment(const LineSegment3D<float> &, const Vector3<float> &, unsigned int, float &, float &) const;
+
+			void processSeparatedSegment(const LineSegment3D<float> &, float, const Vector3<float> &, const PhysicsTransform &);
+			void processIntersectingSegment(const LineSegment3D<float> &, float, const Vector3<float> &, const PhysicsTransform &);
+
+			bool processFaceContact(const LineSegment3D<float> &, float, const Vector3<float> &, unsigned int, float, const PhysicsTransform &);
+			void addLocalContactPoint(const Vector3<float> &, const Point3<float> &, float, const PhysicsTransform &);
+	};
+
+}
+
+#endif
@@ -0,0 +1,159 @@
+#include <limits>
+#include <cmath>
+
+#include "collision/narrowphase/algorithm/CapsuleCapsuleCollisionAlgorithm.h"
+
+#define PARALLEL_SEGMENTS_COSINE 0.999f
+
+namespace urchin
+{
+
+	CapsuleCapsuleCollisionAlgorithm::CapsuleCapsuleCollisionAlgorithm(bool objectSwapped, ManifoldResult &&result) :
+			CollisionAlgorithm(objectSwapped, std::move(result))
+	{
+
+	}
+
+	void CapsuleCapsuleCollisionAlgorithm::doProcessCollisionAlgorithm(const CollisionObjectWrapper &object1, const CollisionObjectWrapper &object2)
+	{
+		ScopeProfiler profiler("physics", "algCapsuleCapsule");
+
+		const auto &capsule1 = dynamic_cast<const CollisionCapsuleShape &>(object1.getShape());
+		const auto &capsule2 = dynamic_cast<const CollisionCapsuleShape &>(object2.getShape());
+
+		LineSegment3D<float> segment1 = toSegment(capsule1, object1.getShapeWorldTransform());
+		LineSegment3D<float> segment2 = toSegment(capsule2, object2.getShapeWorldTransform());
+
+		Point3<float> pointOnSegment1, pointOnSegment2;
+		segment1.closestPoints(segment2, pointOnSegment1, pointOnSegment2);
+
+		float sumRadius = capsule1.getRadius() + capsule2.getRadius();
+		if(pointOnSegment2.vector(pointOnSegment1).length() - sumRadius >= getContactBreakingThreshold())
+		{
+			return;
+		}
+		Vector3<float> centersVector = object2.getShapeWorldTransform().getPosition().vector(object1.getShapeWorldTransform().getPosition());
+		Vector3<float> fallbackNormal = computeFallbackNormal(segment1, segment2, centersVector);
+
+		//parallel segments: two contact points at the extremities of the overlapping part
+		Vector3<float> segmentVector1 = segment1.toVector();
+		Vector3<float> segmentVector2 = segment2.toVector();
+		float segmentLength1 = segmentVector1.length();
+		float segmentLength2 = segmentVector2.length();
+		if(segmentLength1 > std::numeric_limits<float>::epsilon() && segmentLength2 > std::numeric_limits<float>::epsilon())
+		{
+			Vector3<float> direction1 = segmentVector1 / segmentLength1;
+			if(std::abs(direction1.dotProduct(segmentVector2 / segmentLength2)) > PARALLEL_SEGMENTS_COSINE)
+			{
+				float projectionA = segment1.getA().vector(segment2.getA()).dotProduct(direction1);
+				float projectionB = segment1.getA().vector(segment2.getB()).dotProduct(direction1);
+				float overlapStart = std::max(0.0f, std::min(projectionA, projectionB));
+				float overlapEnd = std::min(segmentLength1, std::max(projectionA, projectionB));
+				if(overlapEnd - overlapStart > getContactBreakingThreshold())
+				{
+					for(float overlapExtremity : {overlapStart, overlapEnd})
+					{
+						Point3<float> overlapPointOnSegment1 = segment1.getA().translate(direction1 * overlapExtremity);
+						Point3<float> overlapPointOnSegment2 = segment2.closestPoint(overlapPointOnSegment1);
+						addCapsuleContactPoint(overlapPointOnSegment1, capsule1.getRadius(), overlapPointOnSegment2, capsule2.getRadius(), fallbackNormal);
+					}
+					return;
+				}
+			}
+		}
+
+		addCapsuleContactPoint(pointOnSegment1, capsule1.getRadius(), pointOnSegment2, capsule2.getRadius(), fallbackNormal);
+	}
+
+	LineSegment3D<float> CapsuleCapsuleCollisionAlgorithm::toSegment(const CollisionCapsuleShape &capsule, const PhysicsTransform &transform) const
+	{
+		Point3<float> localHalfSegment(0.0f, 0.0f, 0.0f);
+		localHalfSegment[capsule.getCapsuleOrientation()] = capsule.getCylinderHeight() / 2.0f;
+
+		Vector3<float> halfSegment = transform.getOrientation().rotatePoint(localHalfSegment).toVector();
+		return LineSegment3D<float>(transform.getPosition().translate(-halfSegment), transform.getPosition().translate(halfSegment));
+	}
+
+	/**
+	 * @param centersVector Vector from the center of capsule 2 to the center of capsule 1
+	 * @return Normal from object 2 used when segments intersect: normal perpendicular to both segments and oriented with
+	 * the centers vector. The normal doesn't depend on the direction of the segments.
+	 */
+	Vector3<float> CapsuleCapsuleCollisionAlgorithm::computeFallbackNormal(const LineSegment3D<float> &segment1, const LineSegment3D<float> &segment2,
+			const Vector3<float> &centersVector) const
+	{
+		Vector3<float> normal = segment1.toVector().crossProduct(segment2.toVector());
+		if(normal.squareLength() > std::numeric_limits<float>::epsilon())
+		{
+			normal = normal.normalize();
+			float centersDotNormal = centersVector.dotProduct(normal);
+			if(std::abs(centersDotNormal) > std::numeric_limits<float>::epsilon())
+			{
+				return centersDotNormal > 0.0f ? normal : -normal;
+			}
+
+			//centers in the plane of the segments: largest component of the normal is positive
+			int largestAxis = (std::abs(normal.X) >= std::abs(normal.Y)) ? 0 : 1;
+			largestAxis = (std::abs(normal[largestAxis]) >= std::abs(normal.Z)) ? largestAxis : 2;
+			return normal[largestAxis] > 0.0f ? normal : -normal;
+		}
+
+		//colinear segments: centers vector
+		if(centersVector.squareLength() > std::numeric_limits<float>::epsilon())
+		{
+			return centersVector.normalize();
+		}
+
+		//colinear segments with same center: any normal perpendicular to the segment 1
+		Vector3<float> segmentVector1 = segment1.toVector();
+		Vector3<float> otherAxis = (std::abs(segmentVector1.X) < std::abs(segmentVector1.Y)) ? Vector3<float>(1.0f, 0.0f, 0.0f) : Vector3<float>(0.0f, 1.0f, 0.0f);
+		normal = segmentVector1.crossProduct(otherAxis);
+		if(normal.squareLength() > std::numeric_limits<float>::epsilon())
+		{
+			return normal.normalize();
+		}
+		return Vector3<float>(0.0f, 1.0f, 0.0f);
+	}
+
+	void CapsuleCapsuleCollisionAlgorithm::addCapsuleContactPoint(const Point3<float> &pointOnSegment1, float radius1, const Point3<float> &pointOnSegment2,
+			float radius2, const Vector3<float> &fallbackNormal)
+	{
+		Vector3<float> normalFromObject2 = pointOnSegment2.vector(pointOnSegment1);
+		float segmentsDistance = normalFromObject2.length();
+		if(segmentsDistance > std::numeric_limits<float>::epsilon())
+		{
+			normalFromObject2 /= segmentsDistance;
+		}else
+		{
+			normalFromObject2 = fallbackNormal;
+		}
+
+		float depth = segmentsDistance - radius1 - radius2;
+		if(depth < getContactBreakingThreshold())
+		{
+			addNewContactPoint(normalFromObject2, pointOnSegment2.translate(normalFromObject2 * radius2), depth);
+		}
+	}
+
+	CollisionAlgorithm::AlgorithmType CapsuleCapsuleCollisionAlgorithm::getAlgorithmType() const
+	{
+		return CAPSULE_CAPSULE;
+	}
+
+	CollisionAlgorithm *CapsuleCapsuleCollisionAlgorithm::Builder::createCollisionAlgorithm(bool objectSwapped, ManifoldResult &&result, FixedSizePool<CollisionAlgorithm> *algorithmPool) const
+	{
+		void *memPtr = algorithmPool->allocate(sizeof(CapsuleCapsuleCollisionAlgorithm));
+		return new(memPtr) CapsuleCapsuleCollisionAlgorithm(objectSwapped, std::move(result));
+	}
+
+	const std::vector<CollisionShape3D::ShapeType> &CapsuleCapsuleCollisionAlgorithm::Builder::getFirstExpectedShapeType() const
+	{
+		return CollisionShape3D::CAPSULE_SHAPES;
+	}
+
+	unsigned int CapsuleCapsuleCollisionAlgorithm::Builder::getAlgorithmSize() const
+	{
+		return sizeof(CapsuleCapsuleCollisionAlgorithm);
+	}
+
+}
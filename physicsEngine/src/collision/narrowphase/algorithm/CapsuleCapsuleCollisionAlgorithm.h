@@ -0,0 +1,41 @@
+#ifndef URCHINENGINE_CAPSULECAPSULECOLLISIONALGORITHM_H
+#define URCHINENGINE_CAPSULECAPSULECOLLISIONALGORITHM_H
+
+#include "UrchinCommon.h"
+
+#include "collision/narrowphase/algorithm/CollisionAlgorithm.h"
+#include "collision/narrowphase/algorithm/CollisionAlgorithmBuilder.h"
+#include "collision/ManifoldResult.h"
+#include "collision/narrowphase/CollisionObjectWrapper.h"
+#include "shape/CollisionCapsuleShape.h"
+
+namespace urchin
+{
+
+	class CapsuleCapsuleCollisionAlgorithm : public CollisionAlgorithm
+	{
+		public:
+			CapsuleCapsuleCollisionAlgorithm(bool, ManifoldResult &&);
+			~CapsuleCapsuleCollisionAlgorithm() override = default;
+
+			void doProcessCollisionAlgorithm(const CollisionObjectWrapper &, const CollisionObjectWrapper &) override;
+			AlgorithmType getAlgorithmType() const override;
+
+			struct Builder : public CollisionAlgorithmBuilder
+			{
+				CollisionAlgorithm *createCollisionAlgorithm(bool, ManifoldResult &&, FixedSizePool<CollisionAlgorithm> *) const override;
+
+				const std::vector<CollisionShape3D::ShapeType> &getFirstExpectedShapeType() const override;
+				unsigned int getAlgorithmSize() const override;
+			};
+
+		private:
+			LineSegment3D<float> toSegment(const CollisionCapsuleShape &, const PhysicsTransform &) const;
+			Vector3<float> computeFallbackNormal(const LineSegment3D<float> &, const LineSegment3D<float> &, const Vector3<float> &) const;
+
+			void addCapsuleContactPoint(const Point3<float> &, float, const Point3<float> &, float, const Vector3<float> &);
+	};
+
+}
+
+#endif
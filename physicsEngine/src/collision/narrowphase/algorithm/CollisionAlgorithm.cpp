@@ -1,5 +1,6 @@
 #include "collision/narrowphase/algorithm/CollisionAlgorithm.h"
 #include "collision/narrowphase/algorithm/CollisionAlgorithmSelector.h"
+#include "statistics/ScopeThreadStatistics.h"
 
 namespace urchin
 {
@@ -7,7 +8,8 @@ namespace urchin
 	CollisionAlgorithm::CollisionAlgorithm(bool objectSwapped, ManifoldResult &&manifoldResult) :
 			objectSwapped(objectSwapped),
             manifoldResult(std::move(manifoldResult)),
-            collisionAlgorithmSelector(nullptr)
+            collisionAlgorithmSelector(nullptr),
+            referenceCount(0)
 	{
 
 	}
@@ -17,8 +19,30 @@ namespace urchin
 	    this->collisionAlgorithmSelector = collisionAlgorithmSelector;
     }
 
+	void CollisionAlgorithm::addReference()
+	{
+		referenceCount.fetch_add(1, std::memory_order_relaxed);
+	}
+
+	/**
+	 * Release a reference on the algorithm. Algorithm is given back to the pool of the selector when the last reference is released.
+	 */
+	void CollisionAlgorithm::releaseReference()
+	{
+		if(referenceCount.fetch_sub(1, std::memory_order_acq_rel) == 1)
+		{
+			collisionAlgorithmSelector->freeCollisionAlgorithm(this);
+		}
+	}
+
 	void CollisionAlgorithm::processCollisionAlgorithm(const CollisionObjectWrapper &object1, const CollisionObjectWrapper &object2, bool refreshContractPoints)
 	{
+		PhysicsStatistics *statistics = ScopeThreadStatistics::current();
+		if(statistics)
+		{
+			statistics->narrowPhaseTests[getAlgorithmType()]++;
+		}
+
 		if(objectSwapped)
 		{
 			doProcessCollisionAlgorithm(object2, object1);
@@ -38,6 +62,14 @@ namespace urchin
 		return manifoldResult;
 	}
 
+	/**
+	 * Adds a contact point to the manifold as it is (e.g.: contact point restored from a snapshot)
+	 */
+	void CollisionAlgorithm::restoreContactPoint(const ManifoldContactPoint &contactPoint)
+	{
+		manifoldResult.restoreContactPoint(contactPoint);
+	}
+
 	bool CollisionAlgorithm::isObjectSwapped() const
 	{
 		return objectSwapped;
@@ -1,6 +1,8 @@
 #ifndef URCHINENGINE_COLLISIONALGORITHM_H
 #define URCHINENGINE_COLLISIONALGORITHM_H
 
+#include <atomic>
+
 #include "collision/ManifoldResult.h"
 #include "collision/narrowphase/CollisionObjectWrapper.h"
 
@@ -15,12 +17,31 @@ namespace urchin
 			CollisionAlgorithm(bool, ManifoldResult &&);
 			virtual ~CollisionAlgorithm() = default;
 
+			enum AlgorithmType
+			{
+				SPHERE_SPHERE = 0,
+				SPHERE_BOX,
+				CAPSULE_CAPSULE,
+				CAPSULE_BOX,
+				BOX_BOX,
+				CONVEX_CONVEX,
+				COMPOUND_ANY,
+				CONCAVE_ANY,
+
+				ALGORITHM_TYPE_MAX
+			};
+
 			void setupCollisionAlgorithmSelector(const CollisionAlgorithmSelector *);
 
+			void addReference();
+			void releaseReference();
+
 			void processCollisionAlgorithm(const CollisionObjectWrapper &, const CollisionObjectWrapper &, bool);
+			virtual AlgorithmType getAlgorithmType() const = 0;
 
 			bool isObjectSwapped() const;
 			const ManifoldResult &getConstManifoldResult() const;
+			void restoreContactPoint(const ManifoldContactPoint &);
 
 		protected:
 			virtual void doProcessCollisionAlgorithm(const CollisionObjectWrapper &, const CollisionObjectWrapper &) = 0;
@@ -38,6 +59,7 @@ namespace urchin
 			ManifoldResult manifoldResult;
 
 			const CollisionAlgorithmSelector *collisionAlgorithmSelector;
+			std::atomic_uint referenceCount;
 	};
 
 }
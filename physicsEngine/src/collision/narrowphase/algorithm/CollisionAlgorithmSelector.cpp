@@ -4,6 +4,9 @@
 #include "collision/narrowphase/algorithm/CollisionAlgorithmSelector.h"
 #include "collision/narrowphase/algorithm/SphereSphereCollisionAlgorithm.h"
 #include "collision/narrowphase/algorithm/SphereBoxCollisionAlgorithm.h"
+#include "collision/narrowphase/algorithm/BoxBoxCollisionAlgorithm.h"
+#include "collision/narrowphase/algorithm/CapsuleCapsuleCollisionAlgorithm.h"
+#include "collision/narrowphase/algorithm/CapsuleBoxCollisionAlgorithm.h"
 #include "collision/narrowphase/algorithm/ConvexConvexCollisionAlgorithm.h"
 #include "collision/narrowphase/algorithm/CompoundAnyCollisionAlgorithm.h"
 #include "collision/narrowphase/algorithm/ConcaveAnyCollisionAlgorithm.h"
@@ -53,6 +56,10 @@ namespace urchin
 		collisionAlgorithmBuilderMatrix[CollisionShape3D::SPHERE_SHAPE][CollisionShape3D::SPHERE_SHAPE] = new SphereSphereCollisionAlgorithm::Builder();
 		collisionAlgorithmBuilderMatrix[CollisionShape3D::SPHERE_SHAPE][CollisionShape3D::BOX_SHAPE] = new SphereBoxCollisionAlgorithm::Builder();
 		collisionAlgorithmBuilderMatrix[CollisionShape3D::BOX_SHAPE][CollisionShape3D::SPHERE_SHAPE] = new SphereBoxCollisionAlgorithm::Builder();
+		collisionAlgorithmBuilderMatrix[CollisionShape3D::BOX_SHAPE][CollisionShape3D::BOX_SHAPE] = new BoxBoxCollisionAlgorithm::Builder();
+		collisionAlgorithmBuilderMatrix[CollisionShape3D::CAPSULE_SHAPE][CollisionShape3D::CAPSULE_SHAPE] = new CapsuleCapsuleCollisionAlgorithm::Builder();
+		collisionAlgorithmBuilderMatrix[CollisionShape3D::CAPSULE_SHAPE][CollisionShape3D::BOX_SHAPE] = new CapsuleBoxCollisionAlgorithm::Builder();
+		collisionAlgorithmBuilderMatrix[CollisionShape3D::BOX_SHAPE][CollisionShape3D::CAPSULE_SHAPE] = new CapsuleBoxCollisionAlgorithm::Builder();
 		initializeConcaveAlgorithm();
 		initializeCompoundAlgorithm();
 
@@ -130,7 +137,7 @@ namespace urchin
 	 * @param shape1 Shape or partial shape composing the body 1
 	 * @param shape2 Shape or partial shape composing the body 2
 	 */
-	std::shared_ptr<CollisionAlgorithm> CollisionAlgorithmSelector::createCollisionAlgorithm(
+	IntrusivePtr<CollisionAlgorithm> CollisionAlgorithmSelector::createCollisionAlgorithm(
 			AbstractWorkBody *body1, const CollisionShape3D *shape1, AbstractWorkBody *body2, const CollisionShape3D *shape2) const
 	{
 		CollisionAlgorithmBuilder *collisionAlgorithmBuilder = collisionAlgorithmBuilderMatrix[shape1->getShapeType()][shape2->getShapeType()];
@@ -149,20 +156,21 @@ namespace urchin
 									 + " and " + std::to_string(shape2->getShapeType()));
 		}
 
-		std::shared_ptr<CollisionAlgorithm> collisionAlgorithm = std::shared_ptr<CollisionAlgorithm>(collisionAlgorithmPtr, AlgorithmDeleter(algorithmPool));
-		collisionAlgorithm->setupCollisionAlgorithmSelector(this);
-		return collisionAlgorithm;
+		collisionAlgorithmPtr->setupCollisionAlgorithmSelector(this);
+		return IntrusivePtr<CollisionAlgorithm>(collisionAlgorithmPtr);
 	}
 
-	CollisionAlgorithmSelector::AlgorithmDeleter::AlgorithmDeleter(FixedSizePool<CollisionAlgorithm> *const algorithmPool) :
-		algorithmPool(algorithmPool)
+	/**
+	 * Give back the memory of the algorithm to the pool. Called when the last reference on the algorithm is released.
+	 */
+	void CollisionAlgorithmSelector::freeCollisionAlgorithm(CollisionAlgorithm *collisionAlgorithm) const
 	{
-
+		algorithmPool->free(collisionAlgorithm);
 	}
 
-	void CollisionAlgorithmSelector::AlgorithmDeleter::operator()(CollisionAlgorithm *const collisionAlgorithm)
+	PoolStatistics CollisionAlgorithmSelector::getAlgorithmPoolStatistics() const
 	{
-		algorithmPool->free(collisionAlgorithm);
+		return algorithmPool->getStatistics();
 	}
 
 }
@@ -7,6 +7,7 @@
 #include "collision/narrowphase/algorithm/CollisionAlgorithm.h"
 #include "collision/narrowphase/algorithm/CollisionAlgorithmBuilder.h"
 #include "utils/pool/SyncFixedSizePool.h"
+#include "utils/pool/IntrusivePtr.h"
 
 namespace urchin
 {
@@ -17,7 +18,10 @@ namespace urchin
 			CollisionAlgorithmSelector();
 			~CollisionAlgorithmSelector();
 
-			std::shared_ptr<CollisionAlgorithm> createCollisionAlgorithm(AbstractWorkBody *, const CollisionShape3D *, AbstractWorkBody *, const CollisionShape3D *) const;
+			IntrusivePtr<CollisionAlgorithm> createCollisionAlgorithm(AbstractWorkBody *, const CollisionShape3D *, AbstractWorkBody *, const CollisionShape3D *) const;
+			void freeCollisionAlgorithm(CollisionAlgorithm *) const;
+
+			PoolStatistics getAlgorithmPoolStatistics() const;
 
 		private:
 			void initializeCollisionAlgorithmBuilderMatrix();
@@ -27,16 +31,6 @@ namespace urchin
 
 			void initializeAlgorithmPool();
 
-			class AlgorithmDeleter
-			{
-				public:
-					explicit AlgorithmDeleter(FixedSizePool<CollisionAlgorithm> *);
-					void operator()(CollisionAlgorithm *);
-
-				private:
-					FixedSizePool<CollisionAlgorithm> *const algorithmPool;
-			};
-
 			SyncFixedSizePool<CollisionAlgorithm> *algorithmPool;
 			CollisionAlgorithmBuilder *collisionAlgorithmBuilderMatrix[CollisionShape3D::SHAPE_MAX][CollisionShape3D::SHAPE_MAX];
 	};
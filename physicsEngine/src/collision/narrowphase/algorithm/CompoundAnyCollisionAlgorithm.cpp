@@ -6,7 +6,8 @@ namespace urchin
 {
 
 	CompoundAnyCollisionAlgorithm::CompoundAnyCollisionAlgorithm(bool objectSwapped, ManifoldResult &&result) :
-			CollisionAlgorithm(objectSwapped, std::move(result))
+			CollisionAlgorithm(objectSwapped, std::move(result)),
+			compoundShape(nullptr)
 	{
 
 	}
@@ -17,25 +18,60 @@ namespace urchin
 
 		const auto &compoundShape = dynamic_cast<const CollisionCompoundShape &>(object1.getShape());
 		const CollisionShape3D &otherShape = object2.getShape();
+		refreshLocalizedShapeAlgorithms(compoundShape);
 
 		AbstractWorkBody *body1 = getManifoldResult().getBody1();
 		AbstractWorkBody *body2 = getManifoldResult().getBody2();
 
+		//find localized shapes overlapping the other shape (in compound shape space)
+		PhysicsTransform otherShapeLocalTransform = object1.getShapeWorldTransform().inverse() * object2.getShapeWorldTransform();
+		AABBox<float> otherShapeLocalBox = otherShape.toAABBox(otherShapeLocalTransform).enlarge(getContactBreakingThreshold(), getContactBreakingThreshold());
+		overlappingShapeIndices.clear();
+		compoundShape.findLocalizedShapes(otherShapeLocalBox, overlappingShapeIndices);
+
 		const std::vector<std::shared_ptr<const LocalizedCollisionShape>> &localizedShapes = compoundShape.getLocalizedShapes();
-		for (const auto &localizedShape : localizedShapes)
+		for (std::size_t localizedShapeIndex : overlappingShapeIndices)
 		{
-			std::shared_ptr<CollisionAlgorithm> collisionAlgorithm = getCollisionAlgorithmSelector()->createCollisionAlgorithm(
-					body1, localizedShape->shape.get(), body2, &otherShape);
+			const std::shared_ptr<const LocalizedCollisionShape> &localizedShape = localizedShapes[localizedShapeIndex];
+			overlappingShapes[localizedShapeIndex] = true;
+
+			IntrusivePtr<CollisionAlgorithm> &collisionAlgorithm = localizedShapeAlgorithms[localizedShapeIndex];
+			if(!collisionAlgorithm)
+			{
+				collisionAlgorithm = getCollisionAlgorithmSelector()->createCollisionAlgorithm(body1, localizedShape->shape.get(), body2, &otherShape);
+			}
 
 			PhysicsTransform shapeWorldTransform = object1.getShapeWorldTransform() * localizedShape->transform;
 			CollisionObjectWrapper subObject1(*localizedShape->shape, shapeWorldTransform);
 			CollisionObjectWrapper subObject2(otherShape, object2.getShapeWorldTransform());
 
-			collisionAlgorithm->processCollisionAlgorithm(subObject1, subObject2, false);
+			collisionAlgorithm->processCollisionAlgorithm(subObject1, subObject2, true);
 
 			const ManifoldResult &algorithmManifoldResult = collisionAlgorithm->getConstManifoldResult();
 			addContactPointsToManifold(algorithmManifoldResult, collisionAlgorithm->isObjectSwapped());
 		}
+
+		//release algorithms of localized shapes not overlapping anymore
+		for(std::size_t i=0; i<localizedShapeAlgorithms.size(); ++i)
+		{
+			if(!overlappingShapes[i])
+			{
+				localizedShapeAlgorithms[i].reset();
+			}
+			overlappingShapes[i] = false;
+		}
+	}
+
+	void CompoundAnyCollisionAlgorithm::refreshLocalizedShapeAlgorithms(const CollisionCompoundShape &compoundShape)
+	{
+		if(this->compoundShape!=&compoundShape)
+		{ //first process or shape updated
+			this->compoundShape = &compoundShape;
+
+			localizedShapeAlgorithms.clear();
+			localizedShapeAlgorithms.resize(compoundShape.getLocalizedShapes().size());
+			overlappingShapes.assign(compoundShape.getLocalizedShapes().size(), false);
+		}
 	}
 
 	void CompoundAnyCollisionAlgorithm::addContactPointsToManifold(const ManifoldResult &manifoldResult, bool manifoldSwapped)
@@ -67,6 +103,24 @@ namespace urchin
 		}
 	}
 
+	CollisionAlgorithm::AlgorithmType CompoundAnyCollisionAlgorithm::getAlgorithmType() const
+	{
+		return COMPOUND_ANY;
+	}
+
+	/**
+	 * @return Collision algorithm kept for the localized shape or null when the localized shape didn't overlap the other
+	 * shape during the last process
+	 */
+	const CollisionAlgorithm *CompoundAnyCollisionAlgorithm::getLocalizedShapeAlgorithm(std::size_t localizedShapeIndex) const
+	{
+		if(localizedShapeIndex >= localizedShapeAlgorithms.size())
+		{
+			return nullptr;
+		}
+		return localizedShapeAlgorithms[localizedShapeIndex].get();
+	}
+
 	CollisionAlgorithm *CompoundAnyCollisionAlgorithm::Builder::createCollisionAlgorithm(bool objectSwapped, ManifoldResult &&result, FixedSizePool<CollisionAlgorithm> *algorithmPool) const
 	{
 		void *memPtr = algorithmPool->allocate(sizeof(CompoundAnyCollisionAlgorithm));
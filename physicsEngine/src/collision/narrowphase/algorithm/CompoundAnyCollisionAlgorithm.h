@@ -1,15 +1,23 @@
 #ifndef URCHINENGINE_COMPOUNDANYCOLLISIONALGORITHM_H
 #define URCHINENGINE_COMPOUNDANYCOLLISIONALGORITHM_H
 
+#include <vector>
+#include <memory>
+
 #include "collision/narrowphase/algorithm/CollisionAlgorithm.h"
 #include "collision/narrowphase/algorithm/CollisionAlgorithmBuilder.h"
 #include "collision/narrowphase/algorithm/CollisionAlgorithmSelector.h"
 #include "collision/ManifoldResult.h"
 #include "collision/narrowphase/CollisionObjectWrapper.h"
+#include "shape/CollisionCompoundShape.h"
 
 namespace urchin
 {
 
+	/**
+	* Collision algorithm between a compound shape and any other shape. Only the localized shapes overlapping the other
+	* shape are tested and their collision algorithms are kept between the frames.
+	*/
 	class CompoundAnyCollisionAlgorithm : public CollisionAlgorithm
 	{
 		public:
@@ -17,6 +25,9 @@ namespace urchin
 			~CompoundAnyCollisionAlgorithm() override = default;
 
 			void doProcessCollisionAlgorithm(const CollisionObjectWrapper &, const CollisionObjectWrapper &) override;
+			AlgorithmType getAlgorithmType() const override;
+
+			const CollisionAlgorithm *getLocalizedShapeAlgorithm(std::size_t) const;
 
 			struct Builder : public CollisionAlgorithmBuilder
 			{
@@ -27,7 +38,13 @@ namespace urchin
 			};
 
 		private:
+			void refreshLocalizedShapeAlgorithms(const CollisionCompoundShape &);
 			void addContactPointsToManifold(const ManifoldResult &, bool);
+
+			const CollisionCompoundShape *compoundShape;
+			std::vector<IntrusivePtr<CollisionAlgorithm>> localizedShapeAlgorithms; //indexed by localized shape index
+			std::vector<std::size_t> overlappingShapeIndices;
+			std::vector<bool> overlappingShapes;
 	};
 
 }
@@ -7,8 +7,19 @@
 namespace urchin
 {
 
+    //static
+    const float ConcaveAnyCollisionAlgorithm::TRIANGLES_BOX_MARGIN_PERCENTAGE = 0.2f;
+
+    ConcaveAnyCollisionAlgorithm::TriangleAlgorithm::TriangleAlgorithm(std::size_t triangleIndex, CollisionTriangleShape &&triangleShape) :
+            triangleIndex(triangleIndex),
+            triangleShape(std::move(triangleShape))
+    {
+
+    }
+
     ConcaveAnyCollisionAlgorithm::ConcaveAnyCollisionAlgorithm(bool objectSwapped, ManifoldResult &&result) :
-            CollisionAlgorithm(objectSwapped, std::move(result))
+            CollisionAlgorithm(objectSwapped, std::move(result)),
+            concaveShape(nullptr)
     {
 
     }
@@ -24,21 +35,67 @@ namespace urchin
 
         AABBox<float> aabboxLocalToObject1 = object2.getShape().toAABBox(object1.getShapeWorldTransform().inverse() * object2.getShapeWorldTransform());
         const auto &concaveShape = dynamic_cast<const CollisionConcaveShape &>(object1.getShape());
+        refreshTriangleAlgorithms(concaveShape, aabboxLocalToObject1);
 
-        const std::vector<CollisionTriangleShape> &triangles = concaveShape.findTrianglesInAABBox(aabboxLocalToObject1);
-        for(const auto &triangle : triangles)
+        for(auto &triangleAlgorithm : triangleAlgorithms)
         {
-            std::shared_ptr<CollisionAlgorithm> collisionAlgorithm = getCollisionAlgorithmSelector()->createCollisionAlgorithm(
-                    body1, &triangle, body2, &otherShape);
+            if(!triangleAlgorithm.collisionAlgorithm)
+            {
+                triangleAlgorithm.collisionAlgorithm = getCollisionAlgorithmSelector()->createCollisionAlgorithm(
+                        body1, &triangleAlgorithm.triangleShape, body2, &otherShape);
+            }
 
-            CollisionObjectWrapper subObject1(triangle, object1.getShapeWorldTransform());
+            CollisionObjectWrapper subObject1(triangleAlgorithm.triangleShape, object1.getShapeWorldTransform());
             CollisionObjectWrapper subObject2(otherShape, object2.getShapeWorldTransform());
 
-            collisionAlgorithm->processCollisionAlgorithm(subObject1, subObject2, false);
+            triangleAlgorithm.collisionAlgorithm->processCollisionAlgorithm(subObject1, subObject2, true);
+
+            const ManifoldResult &algorithmManifoldResult = triangleAlgorithm.collisionAlgorithm->getConstManifoldResult();
+            addContactPointsToManifold(algorithmManifoldResult, triangleAlgorithm.collisionAlgorithm->isObjectSwapped());
+        }
+    }
+
+    /**
+     * Refresh the triangles in range of the other shape. Triangles are searched in a fat box: while the other shape
+     * remains in this box, the triangles are not searched again.
+     * @param otherShapeBox Box of the other shape expressed in concave shape space
+     */
+    void ConcaveAnyCollisionAlgorithm::refreshTriangleAlgorithms(const CollisionConcaveShape &concaveShape, const AABBox<float> &otherShapeBox)
+    {
+        if(this->concaveShape!=&concaveShape)
+        { //first process or shape updated
+            this->concaveShape = &concaveShape;
+            triangleAlgorithms.clear();
+        }else if(trianglesBox.include(otherShapeBox))
+        {
+            return;
+        }
+
+        float margin = otherShapeBox.getMaxHalfSize() * TRIANGLES_BOX_MARGIN_PERCENTAGE + getContactBreakingThreshold();
+        trianglesBox = otherShapeBox.enlarge(margin, margin);
+        triangleIndices.clear();
+        concaveShape.findTriangleIndicesInAABBox(trianglesBox, triangleIndices);
 
-            const ManifoldResult &algorithmManifoldResult = collisionAlgorithm->getConstManifoldResult();
-            addContactPointsToManifold(algorithmManifoldResult, collisionAlgorithm->isObjectSwapped());
+        //keep algorithms of triangles still in range (both lists are sorted by triangle index)
+        previousTriangleAlgorithms.swap(triangleAlgorithms);
+        triangleAlgorithms.clear();
+        auto itPrevious = previousTriangleAlgorithms.begin();
+        for(std::size_t triangleIndex : triangleIndices)
+        {
+            while(itPrevious!=previousTriangleAlgorithms.end() && itPrevious->triangleIndex < triangleIndex)
+            {
+                ++itPrevious;
+            }
+
+            if(itPrevious!=previousTriangleAlgorithms.end() && itPrevious->triangleIndex==triangleIndex)
+            {
+                triangleAlgorithms.emplace_back(std::move(*itPrevious));
+            }else
+            {
+                triangleAlgorithms.emplace_back(TriangleAlgorithm(triangleIndex, concaveShape.createTriangleShape(triangleIndex)));
+            }
         }
+        previousTriangleAlgorithms.clear();
     }
 
     void ConcaveAnyCollisionAlgorithm::addContactPointsToManifold(const ManifoldResult &manifoldResult, bool manifoldSwapped)
@@ -70,6 +127,11 @@ namespace urchin
         }
     }
 
+    CollisionAlgorithm::AlgorithmType ConcaveAnyCollisionAlgorithm::getAlgorithmType() const
+    {
+        return CONCAVE_ANY;
+    }
+
     CollisionAlgorithm *ConcaveAnyCollisionAlgorithm::Builder::createCollisionAlgorithm(bool objectSwapped, ManifoldResult &&result, FixedSizePool<CollisionAlgorithm> *algorithmPool) const
     {
         void *memPtr = algorithmPool->allocate(sizeof(ConcaveAnyCollisionAlgorithm));
@@ -1,15 +1,24 @@
 #ifndef URCHINENGINE_CONCAVEANYCOLLISIONALGORITHM_H
 #define URCHINENGINE_CONCAVEANYCOLLISIONALGORITHM_H
 
+#include <vector>
+#include <memory>
+
 #include "collision/narrowphase/algorithm/CollisionAlgorithm.h"
 #include "collision/narrowphase/algorithm/CollisionAlgorithmBuilder.h"
 #include "collision/narrowphase/algorithm/CollisionAlgorithmSelector.h"
 #include "collision/ManifoldResult.h"
 #include "collision/narrowphase/CollisionObjectWrapper.h"
+#include "shape/CollisionConcaveShape.h"
+#include "shape/CollisionTriangleShape.h"
 
 namespace urchin
 {
 
+    /**
+    * Collision algorithm between a concave shape and any other shape. Algorithms of the triangles are kept between the
+    * frames while the triangles remain in range of the other shape.
+    */
     class ConcaveAnyCollisionAlgorithm : public CollisionAlgorithm
     {
         public:
@@ -17,6 +26,7 @@ namespace urchin
             ~ConcaveAnyCollisionAlgorithm() override = default;
 
             void doProcessCollisionAlgorithm(const CollisionObjectWrapper &, const CollisionObjectWrapper &) override;
+            AlgorithmType getAlgorithmType() const override;
 
             struct Builder : public CollisionAlgorithmBuilder
             {
@@ -27,7 +37,25 @@ namespace urchin
             };
 
         private:
+            struct TriangleAlgorithm
+            {
+                TriangleAlgorithm(std::size_t, CollisionTriangleShape &&);
+
+                std::size_t triangleIndex;
+                CollisionTriangleShape triangleShape;
+                IntrusivePtr<CollisionAlgorithm> collisionAlgorithm;
+            };
+
+            void refreshTriangleAlgorithms(const CollisionConcaveShape &, const AABBox<float> &);
             void addContactPointsToManifold(const ManifoldResult &, bool);
+
+            static const float TRIANGLES_BOX_MARGIN_PERCENTAGE;
+
+            const CollisionConcaveShape *concaveShape;
+            AABBox<float> trianglesBox; //fat box used to find the triangles (in concave shape space)
+            std::vector<std::size_t> triangleIndices;
+            std::vector<TriangleAlgorithm> triangleAlgorithms; //sorted by triangle index
+            std::vector<TriangleAlgorithm> previousTriangleAlgorithms;
     };
 
 }
@@ -7,7 +7,8 @@ namespace urchin
 {
 
 	ConvexConvexCollisionAlgorithm::ConvexConvexCollisionAlgorithm(bool objectSwapped, ManifoldResult &&result) :
-			CollisionAlgorithm(objectSwapped, std::move(result))
+			CollisionAlgorithm(objectSwapped, std::move(result)),
+			hasSeparatingAxis(false)
 	{
 
 	}
@@ -20,9 +21,16 @@ namespace urchin
 		std::unique_ptr<CollisionConvexObject3D, ObjectDeleter> convexObject1 = object1.getShape().toConvexObject(object1.getShapeWorldTransform());
 		std::unique_ptr<CollisionConvexObject3D, ObjectDeleter> convexObject2 = object2.getShape().toConvexObject(object2.getShapeWorldTransform());
 
+		if(hasSeparatingAxis && isSeparatedByCachedAxis(*convexObject1, *convexObject2))
+		{ //objects still separated by the axis of the previous process: no contact possible
+			return;
+		}
+
 		//process GJK and EPA hybrid algorithms
-		std::unique_ptr<GJKResult<double>, AlgorithmResultDeleter> gjkResultWithoutMargin = gjkAlgorithm.processGJK(*convexObject1, *convexObject2, false);
+		Vector3<double> initialDirection = hasSeparatingAxis ? -separatingAxis : Vector3<double>(1.0, 0.0, 0.0);
+		std::unique_ptr<GJKResult<double>, AlgorithmResultDeleter> gjkResultWithoutMargin = gjkAlgorithm.processGJK(*convexObject1, *convexObject2, false, initialDirection);
 
+		hasSeparatingAxis = false;
 		if(gjkResultWithoutMargin->isValidResult())
 		{
 			if(gjkResultWithoutMargin->isCollide())
@@ -31,6 +39,7 @@ namespace urchin
 			}else
 			{ //collision detected on enlarged objects (with margins) OR no collision detected
 				const Vector3<double> &vectorBA = gjkResultWithoutMargin->getClosestPointB().vector(gjkResultWithoutMargin->getClosestPointA());
+
 				float vectorBALength = vectorBA.length();
 				float sumMargins = convexObject1->getOuterMargin() + convexObject2->getOuterMargin();
 				if(sumMargins > vectorBALength - getContactBreakingThreshold())
@@ -40,11 +49,30 @@ namespace urchin
 					const float penetrationDepth = vectorBALength - sumMargins;
 
 					addNewContactPoint(normalFromObject2.cast<float>(), pointOnObject2.cast<float>(), penetrationDepth);
+				}else if(vectorBA.squareLength() > 0.0)
+				{ //no collision: keep separating axis for next process
+					separatingAxis = vectorBA;
+					hasSeparatingAxis = true;
 				}
 			}
 		}
 	}
 
+	/**
+	 * Check if the axis found on the previous process still separates the objects by more than the margins and the
+	 * contact breaking threshold. For resting or slowly moving objects, this check avoids a GJK process.
+	 */
+	bool ConvexConvexCollisionAlgorithm::isSeparatedByCachedAxis(const CollisionConvexObject3D &convexObject1, const CollisionConvexObject3D &convexObject2) const
+	{
+		Vector3<float> axis = separatingAxis.normalize().cast<float>();
+		Point3<float> supportPointA = convexObject1.getSupportPoint(-axis, false);
+		Point3<float> supportPointB = convexObject2.getSupportPoint(axis, false);
+
+		float minimumDistance = supportPointB.vector(supportPointA).dotProduct(axis);
+		float sumMargins = convexObject1.getOuterMargin() + convexObject2.getOuterMargin();
+		return minimumDistance >= sumMargins + getContactBreakingThreshold();
+	}
+
 	void ConvexConvexCollisionAlgorithm::processCollisionAlgorithmWithMargin(const std::unique_ptr<CollisionConvexObject3D, ObjectDeleter> &convexObject1,
 			const std::unique_ptr<CollisionConvexObject3D, ObjectDeleter> &convexObject2)
 	{
@@ -65,6 +93,11 @@ namespace urchin
 		}
 	}
 
+	CollisionAlgorithm::AlgorithmType ConvexConvexCollisionAlgorithm::getAlgorithmType() const
+	{
+		return CONVEX_CONVEX;
+	}
+
 	CollisionAlgorithm *ConvexConvexCollisionAlgorithm::Builder::createCollisionAlgorithm(bool objectSwapped, ManifoldResult &&result, FixedSizePool<CollisionAlgorithm> *algorithmPool) const
 	{
 		void *memPtr = algorithmPool->allocate(sizeof(ConvexConvexCollisionAlgorithm));
@@ -18,6 +18,7 @@ namespace urchin
 			~ConvexConvexCollisionAlgorithm() override = default;
 
 			void doProcessCollisionAlgorithm(const CollisionObjectWrapper &, const CollisionObjectWrapper &) override;
+			AlgorithmType getAlgorithmType() const override;
 
 			struct Builder : public CollisionAlgorithmBuilder
 			{
@@ -28,11 +29,18 @@ namespace urchin
 			};
 
 		private:
+			bool isSeparatedByCachedAxis(const CollisionConvexObject3D &, const CollisionConvexObject3D &) const;
 			void processCollisionAlgorithmWithMargin(const std::unique_ptr<CollisionConvexObject3D, ObjectDeleter> &,
 			        const std::unique_ptr<CollisionConvexObject3D, ObjectDeleter> &);
 
 			GJKAlgorithm<double> gjkAlgorithm;
 			EPAAlgorithm<double> epaAlgorithm;
+
+			//Axis separating the objects on previous process (vector from closest point of object 2 to closest point of object 1).
+			//Axis is kept only when no contact has been found: for objects in contact, GJK restarts from a fixed direction
+			//in order to find different contact points on each process and fill the persistent manifold.
+			Vector3<double> separatingAxis;
+			bool hasSeparatingAxis;
 	};
 
 }
@@ -83,6 +83,11 @@ namespace urchin
 		}
 	}
 
+	CollisionAlgorithm::AlgorithmType SphereBoxCollisionAlgorithm::getAlgorithmType() const
+	{
+		return SPHERE_BOX;
+	}
+
 	CollisionAlgorithm *SphereBoxCollisionAlgorithm::Builder::createCollisionAlgorithm(bool objectSwapped, ManifoldResult &&result, FixedSizePool<CollisionAlgorithm> *algorithmPool) const
 	{
 		void *memPtr = algorithmPool->allocate(sizeof(SphereBoxCollisionAlgorithm));
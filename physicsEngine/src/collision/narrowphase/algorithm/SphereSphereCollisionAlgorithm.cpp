@@ -43,6 +43,11 @@ namespace urchin
 		}
 	}
 
+	CollisionAlgorithm::AlgorithmType SphereSphereCollisionAlgorithm::getAlgorithmType() const
+	{
+		return SPHERE_SPHERE;
+	}
+
 	CollisionAlgorithm *SphereSphereCollisionAlgorithm::Builder::createCollisionAlgorithm(bool objectSwapped, ManifoldResult &&result, FixedSizePool<CollisionAlgorithm> *algorithmPool) const
 	{
 		void *memPtr = algorithmPool->allocate(sizeof(SphereSphereCollisionAlgorithm));
@@ -16,6 +16,7 @@ namespace urchin
 			~SphereSphereCollisionAlgorithm() override = default;
 
 			void doProcessCollisionAlgorithm(const CollisionObjectWrapper &, const CollisionObjectWrapper &) override;
+			AlgorithmType getAlgorithmType() const override;
 
 			struct Builder : public CollisionAlgorithmBuilder
 			{
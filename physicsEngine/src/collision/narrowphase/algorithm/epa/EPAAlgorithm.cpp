@@ -2,6 +2,7 @@
 #include "collision/narrowphase/algorithm/utils/AlgorithmResultAllocator.h"
 #include "collision/narrowphase/algorithm/epa/EPAAlgorithm.h"
 #include "utils/property/EagerPropertyLoader.h"
+#include "statistics/ScopeThreadStatistics.h"
 
 namespace urchin
 {
@@ -32,47 +33,33 @@ namespace urchin
 			return AlgorithmResultAllocator::instance()->newEPAResultNoCollide<T>();
 		}
 
-		//2. initialize global variables
-		std::map<std::size_t, Point3<T>> supportPointsA, supportPointsB;  //first: index of point in convex hull, second: support points
-		std::map<std::size_t, EPATriangleData<T>> trianglesData; //first: index of triangle in convex hull, second: EPA triangle data
+		//2. create initial convex hull in the polytope of the thread (buffers reused between EPA processes)
+		static thread_local EPAPolytope<T> polytope;
+		polytope.reset();
 
-		//3. create initial convex hull
-		std::map<std::size_t, ConvexHullPoint<T>> convexHullPoints;
-		std::map<std::size_t, IndexedTriangle3D<T>> indexedTriangles;
-
-		determineInitialPoints(simplex, convexObject1, convexObject2, convexHullPoints, supportPointsA, supportPointsB);
-        if(convexHullPoints.size() >= 4)
-        {
-            determineInitialTriangles(convexHullPoints, indexedTriangles);
-        }
-
-		if(indexedTriangles.size()!=4)
+		EPAVertex<T> initialVertices[5];
+		std::size_t initialVerticesCount = determineInitialPoints(simplex, convexObject1, convexObject2, initialVertices);
+		if(initialVerticesCount < 4 || !determineInitialTriangles(initialVertices, polytope))
 		{//due to numerical imprecision, it's impossible to create indexed triangles correctly
 			return AlgorithmResultAllocator::instance()->newEPAResultInvalid<T>();
 		}
 
-		ConvexHullShape3D<T> convexHullShape(convexHullPoints, indexedTriangles);
-		for(auto it = indexedTriangles.begin(); it!=indexedTriangles.end(); ++it)
-		{
-			trianglesData.insert(std::pair<std::size_t, EPATriangleData<T>>(it->first, createTriangleData(convexHullShape, it->first)));
-		}
-
-		//4. find closest plane of extended polytope
+		//3. find closest plane of extended polytope
 		T upperBoundPenDepth = std::numeric_limits<T>::max();
-		typename std::map<std::size_t, EPATriangleData<T>>::const_iterator itClosestTriangleData;
+		std::size_t closestFaceIndex;
 		unsigned int iterationNumber = 0;
 		Vector3<T> normal;
 		T distanceToOrigin;
 
 		while(true)
 		{
-			itClosestTriangleData = getClosestTriangleData(trianglesData);
-			const EPATriangleData<T> &closestTriangleData = itClosestTriangleData->second;
+			closestFaceIndex = polytope.getClosestFaceIndex();
+			const EPATriangleData<T> &closestTriangleData = polytope.getFace(closestFaceIndex).triangleData;
 
 			normal = closestTriangleData.getNormal();
 			distanceToOrigin = closestTriangleData.getDistanceToOrigin();
 
-			if(iterationNumber > maxIteration)
+			if(iterationNumber > maxIteration || polytope.getVertexCount()==EPAPolytope<T>::MAX_VERTICES)
 			{ //can happen on spherical forms where EPA algorithm doesn't progress enough fast
 				break;
 			}
@@ -87,47 +74,30 @@ namespace urchin
 
 			if(!closeEnough)
 			{ //polytope can be extended in direction of normal: add a new point
-				std::vector<std::size_t> removedTriangleIndices;
-                std::size_t index = convexHullShape.addNewPoint(minkowskiDiffPoint, removedTriangleIndices);
-				if(index==0)
-				{ //finally, polytope cannot by extended in direction of normal. Cause: numerical imprecision.
+				std::size_t vertexIndex = polytope.addVertex(minkowskiDiffPoint, supportPointNormal, supportPointMinusNormal);
+				if(!polytope.expand(closestFaceIndex, vertexIndex))
+				{ //finally, polytope cannot by extended in direction of normal. Cause: numerical imprecision or faces capacity reached.
 					break;
 				}
-
-				//compute new triangles data
-				const std::vector<std::size_t> &newTriangleIndices = convexHullShape.getConvexHullPoints().at(index).triangleIndices;
-				for (std::size_t newTriangleIndex : newTriangleIndices)
-				{
-					trianglesData.insert(std::pair<std::size_t, EPATriangleData<T>>(newTriangleIndex, createTriangleData(convexHullShape, newTriangleIndex)));
-				}
-
-				//remove triangle data not used anymore
-				for (std::size_t removedTriangleIndex : removedTriangleIndices)
-				{
-					trianglesData.erase(removedTriangleIndex);
-				}
-
-				//save support points
-				supportPointsA[index] = supportPointNormal;
-				supportPointsB[index] = supportPointMinusNormal;
 			}else
 			{ //polytope cannot by extended in direction of normal: solution is found
 				break;
 			}
 			iterationNumber++;
 		}
+		recordIterations(iterationNumber);
 
-		//5. compute EPA result: normal, penetration depth and contact points of collision
-		const EPATriangleData<T> &closestTriangleData = itClosestTriangleData->second;
-		const IndexedTriangle3D<T> &indexedTriangle = convexHullShape.getIndexedTriangles().at(itClosestTriangleData->first);
-		const std::size_t pointIndex1 = indexedTriangle.getIndex(0);
-		const std::size_t pointIndex2 = indexedTriangle.getIndex(1);
-		const std::size_t pointIndex3 = indexedTriangle.getIndex(2);
+		//4. compute EPA result: normal, penetration depth and contact points of collision
+		const EPAFace<T> &closestFace = polytope.getFace(closestFaceIndex);
+		const EPATriangleData<T> &closestTriangleData = closestFace.triangleData;
+		const EPAVertex<T> &vertex1 = polytope.getVertex(closestFace.vertexIndices[0]);
+		const EPAVertex<T> &vertex2 = polytope.getVertex(closestFace.vertexIndices[1]);
+		const EPAVertex<T> &vertex3 = polytope.getVertex(closestFace.vertexIndices[2]);
 
-		const Point3<T> contactPointA = closestTriangleData.getBarycentric(0) * supportPointsA[pointIndex1] + closestTriangleData.getBarycentric(1) * supportPointsA[pointIndex2]
-				+ closestTriangleData.getBarycentric(2) * supportPointsA[pointIndex3];
-		const Point3<T> contactPointB = closestTriangleData.getBarycentric(0) * supportPointsB[pointIndex1] + closestTriangleData.getBarycentric(1) * supportPointsB[pointIndex2]
-				+ closestTriangleData.getBarycentric(2) * supportPointsB[pointIndex3];
+		const Point3<T> contactPointA = closestTriangleData.getBarycentric(0) * vertex1.supportPointA + closestTriangleData.getBarycentric(1) * vertex2.supportPointA
+				+ closestTriangleData.getBarycentric(2) * vertex3.supportPointA;
+		const Point3<T> contactPointB = closestTriangleData.getBarycentric(0) * vertex1.supportPointB + closestTriangleData.getBarycentric(1) * vertex2.supportPointB
+				+ closestTriangleData.getBarycentric(2) * vertex3.supportPointB;
 
         if(Check::instance()->additionalChecksEnable())
         {
@@ -141,6 +111,15 @@ namespace urchin
 		return AlgorithmResultAllocator::instance()->newEPAResultCollide<T>(contactPointA, contactPointB, normal, distanceToOrigin);
 	}
 
+	template<class T> void EPAAlgorithm<T>::recordIterations(unsigned int iterations) const
+	{
+		PhysicsStatistics *statistics = ScopeThreadStatistics::current();
+		if(statistics)
+		{
+			statistics->epaIterations[PhysicsStatistics::toIterationHistogramBucket(iterations)]++;
+		}
+	}
+
     template<class T> std::unique_ptr<EPAResult<T>, AlgorithmResultDeleter> EPAAlgorithm<T>::handleSubTriangle(const CollisionConvexObject3D &convexObject1,
                                                                                        const CollisionConvexObject3D &convexObject2) const
     {
@@ -191,13 +170,11 @@ namespace urchin
 	/**
 	 * Determine initial points useful for EPA algorithm: points of initial convex hull as well as the linked support points
 	 * @param simplex Simplex resulting from GJK algorithm
-	 * @param convexHullPoints [out] Initial points for EPA algorithm
-	 * @param supportPointsA [out] Support points of object A used to compute indexed points
-	 * @param supportPointsB [out] Support points of object B used to compute indexed points
+	 * @param initialVertices [out] Initial points for EPA algorithm and linked support points. Only the 4 first points form the initial tetrahedron.
+	 * @return Number of initial points or zero when no tetrahedron containing the origin can be found
 	 */
-	template<class T> void EPAAlgorithm<T>::determineInitialPoints(const Simplex<T> &simplex, const CollisionConvexObject3D &convexObject1,
-			const CollisionConvexObject3D &convexObject2, std::map<std::size_t, ConvexHullPoint<T>> &convexHullPoints,
-			std::map<std::size_t, Point3<T>> &supportPointsA, std::map<std::size_t, Point3<T>> &supportPointsB) const
+	template<class T> std::size_t EPAAlgorithm<T>::determineInitialPoints(const Simplex<T> &simplex, const CollisionConvexObject3D &convexObject1,
+			const CollisionConvexObject3D &convexObject2, EPAVertex<T> initialVertices[5]) const
 	{
 		if(simplex.getSize()==2)
 		{ //simplex is a segment line containing the origin
@@ -240,34 +217,31 @@ namespace urchin
 
 			for(std::size_t i=0; i<2; ++i)
 			{
-				convexHullPoints[i].point = simplex.getPoint(i);
-				supportPointsA[i] = simplex.getSupportPointA(i);
-				supportPointsB[i] = simplex.getSupportPointB(i);
+				initialVertices[i].point = simplex.getPoint(i);
+				initialVertices[i].supportPointA = simplex.getSupportPointA(i);
+				initialVertices[i].supportPointB = simplex.getSupportPointB(i);
 			}
 			for(std::size_t i=0; i<3; ++i)
 			{
-				convexHullPoints[i+2].point = supportPoints[i] - supportPointsMinus[i];
-				supportPointsA[i+2] = supportPoints[i];
-				supportPointsB[i+2] = supportPointsMinus[i];
+				initialVertices[i+2].point = supportPoints[i] - supportPointsMinus[i];
+				initialVertices[i+2].supportPointA = supportPoints[i];
+				initialVertices[i+2].supportPointB = supportPointsMinus[i];
 			}
 
 			//keep only the tetrahedron containing the origin
-			if(Tetrahedron<T>(convexHullPoints[0].point, convexHullPoints[2].point, convexHullPoints[3].point, convexHullPoints[4].point).collideWithPoint(Point3<T>(0.0, 0.0, 0.0)))
+			if(Tetrahedron<T>(initialVertices[0].point, initialVertices[2].point, initialVertices[3].point, initialVertices[4].point).collideWithPoint(Point3<T>(0.0, 0.0, 0.0)))
 			{
 				//we use the point 4 instead of point 1 for the initial tetrahedron
-				convexHullPoints[1].point = convexHullPoints[4].point;
-				supportPointsA[1] = supportPointsA[4];
-				supportPointsB[1] = supportPointsB[4];
-			}else if(Tetrahedron<T>(convexHullPoints[4].point, convexHullPoints[1].point, convexHullPoints[2].point, convexHullPoints[3].point).collideWithPoint(Point3<T>(0.0, 0.0, 0.0)))
+				initialVertices[1] = initialVertices[4];
+			}else if(Tetrahedron<T>(initialVertices[4].point, initialVertices[1].point, initialVertices[2].point, initialVertices[3].point).collideWithPoint(Point3<T>(0.0, 0.0, 0.0)))
 			{
 				//we use the point 4 instead of point 0 for the initial tetrahedron
-				convexHullPoints[0].point = convexHullPoints[4].point;
-				supportPointsA[0] = supportPointsA[4];
-				supportPointsB[0] = supportPointsB[4];
+				initialVertices[0] = initialVertices[4];
 			}else
             { //no tetrahedron containing the origin due to float imprecision
-                convexHullPoints.clear();
+                return 0;
             }
+            return 5;
 		}else if(simplex.getSize()==3)
 		{ //simplex is a triangle containing the origin
 			//create two vectors based on three points
@@ -285,39 +259,39 @@ namespace urchin
 
 			for(std::size_t i=0; i<3; ++i)
 			{
-				convexHullPoints[i].point = simplex.getPoint(i);
-				supportPointsA[i] = simplex.getSupportPointA(i);
-				supportPointsB[i] = simplex.getSupportPointB(i);
+				initialVertices[i].point = simplex.getPoint(i);
+				initialVertices[i].supportPointA = simplex.getSupportPointA(i);
+				initialVertices[i].supportPointB = simplex.getSupportPointB(i);
 			}
 			for(std::size_t i=0; i<2; ++i)
 			{
-				convexHullPoints[i+3].point = supportPoints[i] - supportPointsMinus[i];
-				supportPointsA[i+3] = supportPoints[i];
-				supportPointsB[i+3] = supportPointsMinus[i];
+				initialVertices[i+3].point = supportPoints[i] - supportPointsMinus[i];
+				initialVertices[i+3].supportPointA = supportPoints[i];
+				initialVertices[i+3].supportPointB = supportPointsMinus[i];
 			}
 
 			//keep only the tetrahedron containing the origin
-			if(Tetrahedron<T>(convexHullPoints[0].point, convexHullPoints[1].point, convexHullPoints[2].point, convexHullPoints[3].point).collideWithPoint(Point3<T>(0.0, 0.0, 0.0)))
+			if(Tetrahedron<T>(initialVertices[0].point, initialVertices[1].point, initialVertices[2].point, initialVertices[3].point).collideWithPoint(Point3<T>(0.0, 0.0, 0.0)))
 			{
 				//we use the 4 first point - nothing to do
-			}else if(Tetrahedron<T>(convexHullPoints[0].point, convexHullPoints[1].point, convexHullPoints[2].point, convexHullPoints[4].point).collideWithPoint(Point3<T>(0.0, 0.0, 0.0)))
+			}else if(Tetrahedron<T>(initialVertices[0].point, initialVertices[1].point, initialVertices[2].point, initialVertices[4].point).collideWithPoint(Point3<T>(0.0, 0.0, 0.0)))
 			{
 				//we use the point 4 instead of point 3 for the initial tetrahedron
-				convexHullPoints[3].point = convexHullPoints[4].point;
-				supportPointsA[3] = supportPointsA[4];
-				supportPointsB[3] = supportPointsB[4];
+				initialVertices[3] = initialVertices[4];
 			}else
             { //no tetrahedron containing the origin due to float imprecision
-                convexHullPoints.clear();
+                return 0;
             }
+            return 5;
 		}else if(simplex.getSize()==4)
 		{ //simplex is a tetrahedron containing the origin
 			for(std::size_t i=0; i<4; ++i)
 			{
-				convexHullPoints[i].point = simplex.getPoint(i);
-				supportPointsA[i] = simplex.getSupportPointA(i);
-				supportPointsB[i] = simplex.getSupportPointB(i);
+				initialVertices[i].point = simplex.getPoint(i);
+				initialVertices[i].supportPointA = simplex.getSupportPointA(i);
+				initialVertices[i].supportPointB = simplex.getSupportPointB(i);
 			}
+			return 4;
 		}else
 		{
 			throw std::invalid_argument("Size of simplex unsupported: " + std::to_string(simplex.getSize()) + ".");
@@ -326,37 +300,37 @@ namespace urchin
 
 	/**
 	 * Determine triangles of initial convex hull of EPA algorithm. Normal of triangle must be outside the convex hull.
-	 * @param convexHullPoints [in/out] Points of initial convex hull. Linked triangles to points are updated.
-	 * @param indexedTriangles [out] Triangle of initial convex hull. When points are too close together or almost on same
-	 * plane: the indexed triangles can be incomplete
+	 * @param initialVertices Points of initial convex hull (4 first points are used)
+	 * @param polytope [out] Polytope filled with the initial tetrahedron
+	 * @return False when points are too close together or almost on same plane
 	 */
-	template<class T> void EPAAlgorithm<T>::determineInitialTriangles(std::map<std::size_t, ConvexHullPoint<T>> &convexHullPoints,
-			std::map<std::size_t, IndexedTriangle3D<T>> &indexedTriangles) const
+	template<class T> bool EPAAlgorithm<T>::determineInitialTriangles(const EPAVertex<T> initialVertices[5], EPAPolytope<T> &polytope) const
 	{
 		for(std::size_t i=0; i<3; ++i)
 		{
 			for(std::size_t j=i+1; j<4; ++j)
 			{
-				T distance = convexHullPoints.at(i).point.vector(convexHullPoints.at(j).point).length();
+				T distance = initialVertices[i].point.vector(initialVertices[j].point).length();
 				T minPointsDistance = (std::nextafter(distance, std::numeric_limits<T>::max()) - distance) * 10.0;
 
 				if(distance < minPointsDistance)
 				{
-					return;
+					return false;
 				}
 			}
 		}
 
 		constexpr std::size_t indices[4][3] = 		{{0, 1, 2}, {0, 3, 1}, {0, 2, 3}, {1, 3, 2}};
 		constexpr std::size_t revIndices[4][3] = 	{{0, 2, 1}, {0, 1, 3}, {0, 3, 2}, {1, 2, 3}};
+		std::size_t faceIndices[4][3];
 		for(std::size_t i=0; i<4; ++i)
 		{
 			const std::size_t pointOutsideTriangle = 6 - (indices[i][0] + indices[i][1] + indices[i][2]);
 			const Vector3<T> normalTriangle = IndexedTriangle3D<T>(indices[i]).computeNormal(
-					convexHullPoints.at(indices[i][0]).point,
-					convexHullPoints.at(indices[i][1]).point,
-					convexHullPoints.at(indices[i][2]).point);
-			const Vector3<T> trianglePointToOutsidePoint = convexHullPoints.at(indices[i][0]).point.vector(convexHullPoints.at(pointOutsideTriangle).point);
+					initialVertices[indices[i][0]].point,
+					initialVertices[indices[i][1]].point,
+					initialVertices[indices[i][2]].point);
+			const Vector3<T> trianglePointToOutsidePoint = initialVertices[indices[i][0]].point.vector(initialVertices[pointOutsideTriangle].point);
 			T dotProduct = normalTriangle.dotProduct(trianglePointToOutsidePoint);
 
 			T trianglePointToOutsidePointLength = trianglePointToOutsidePoint.length();
@@ -364,78 +338,21 @@ namespace urchin
 
 			if(dotProduct < -dotProductTolerance)
 			{
-				indexedTriangles.insert(std::pair<std::size_t, IndexedTriangle3D<T>>(i, IndexedTriangle3D<T>(indices[i])));
-				for(std::size_t pointI=0; pointI<3; ++pointI)
-				{
-					convexHullPoints.at(indices[i][pointI]).triangleIndices.push_back(i);
-				}
+				std::copy(indices[i], indices[i] + 3, faceIndices[i]);
 			}else if(dotProduct > dotProductTolerance)
 			{
-				indexedTriangles.insert(std::pair<std::size_t, IndexedTriangle3D<T>>(i, IndexedTriangle3D<T>(revIndices[i])));
-				for(std::size_t pointI=0; pointI<3; ++pointI)
-				{
-					convexHullPoints.at(revIndices[i][pointI]).triangleIndices.push_back(i);
-				}
+				std::copy(revIndices[i], revIndices[i] + 3, faceIndices[i]);
 			}else
 			{
-				return;
+				return false;
 			}
 		}
-	}
-
-	/**
-	 * Find closest plane (triangle plane) near the origin
-	 * @param trianglesData Triangles data
-	 * @return Iterator on closest triangle data
-	 */
-	template<class T> typename std::map<std::size_t, EPATriangleData<T>>::const_iterator EPAAlgorithm<T>::getClosestTriangleData(
-			const typename std::map<std::size_t, EPATriangleData<T>> &trianglesData) const
-	{
-		T minDistanceToOrigin = std::numeric_limits<T>::max();
-		typename std::map<std::size_t, EPATriangleData<T>>::const_iterator closestTriangleData;
 
-		for(auto it = trianglesData.begin(); it!=trianglesData.end(); ++it)
+		for(std::size_t i=0; i<4; ++i)
 		{
-			const EPATriangleData<T> &triangleData = it->second;
-			T distanceToOrigin = std::abs(triangleData.getDistanceToOrigin());
-
-			if(minDistanceToOrigin > distanceToOrigin)
-			{
-				minDistanceToOrigin = distanceToOrigin;
-				closestTriangleData = it;
-			}
+			polytope.addVertex(initialVertices[i].point, initialVertices[i].supportPointA, initialVertices[i].supportPointB);
 		}
-
-		return closestTriangleData;
-	}
-
-	/**
-	 * @param triangleIndex Index of triangle in convex hull shape used to compute the data
-	 * @return Computed triangle data (normal, distance to origin...).
-	 */
-	template<class T> EPATriangleData<T> EPAAlgorithm<T>::createTriangleData(const ConvexHullShape3D<T> &convexHullShape, std::size_t triangleIndex) const
-	{
-		const IndexedTriangle3D<T> &indexedTriangle = convexHullShape.getIndexedTriangles().at(triangleIndex);
-		const std::size_t pointIndex1 = indexedTriangle.getIndex(0);
-		const std::size_t pointIndex2 = indexedTriangle.getIndex(1);
-		const std::size_t pointIndex3 = indexedTriangle.getIndex(2);
-
-		const Point3<T> &point1 = convexHullShape.getConvexHullPoints().at(pointIndex1).point;
-		const Point3<T> &point2 = convexHullShape.getConvexHullPoints().at(pointIndex2).point;
-		const Point3<T> &point3 = convexHullShape.getConvexHullPoints().at(pointIndex3).point;
-		const Triangle3D<T> triangle(point1, point2, point3);
-
-		//compute point on the triangle nearest to origin
-		T barycentrics[3];
-		Point3<T> closestPointToOrigin = triangle.closestPoint(Point3<T>(0.0, 0.0, 0.0), barycentrics);
-
-		//compute minimum distance between triangle and the origin
-		T distanceToOrigin = closestPointToOrigin.toVector().length();
-
-		//compute normal (external to convex hull)
-		const Vector3<T> normal = triangle.computeNormal();
-
-		return EPATriangleData<T>(distanceToOrigin, normal, closestPointToOrigin, barycentrics);
+		return polytope.addInitialFaces(faceIndices);
 	}
 
     template<class T> void EPAAlgorithm<T>::logInputData(const std::string &errorMessage, const CollisionConvexObject3D &convexObject1,
@@ -2,8 +2,8 @@
 #define URCHINENGINE_EPAALGORITHM_H
 
 #include <vector>
+#include <algorithm>
 #include <limits>
-#include <map>
 #include <cmath>
 #include <stdexcept>
 #include <cassert>
@@ -11,6 +11,7 @@
 #include "UrchinCommon.h"
 
 #include "collision/narrowphase/algorithm/epa/EPATriangleData.h"
+#include "collision/narrowphase/algorithm/epa/EPAPolytope.h"
 #include "collision/narrowphase/algorithm/epa/result/EPAResult.h"
 #include "collision/narrowphase/algorithm/epa/result/EPAResultCollide.h"
 #include "collision/narrowphase/algorithm/epa/result/EPAResultNoCollide.h"
@@ -32,12 +33,9 @@ namespace urchin
 		private:
 			std::unique_ptr<EPAResult<T>, AlgorithmResultDeleter> handleSubTriangle(const CollisionConvexObject3D &, const CollisionConvexObject3D &) const;
 
-			void determineInitialPoints(const Simplex<T> &, const CollisionConvexObject3D &, const CollisionConvexObject3D &,
-					std::map<std::size_t, ConvexHullPoint<T>> &, std::map<std::size_t, Point3<T>> &, std::map<std::size_t, Point3<T>> &) const;
-			void determineInitialTriangles(std::map<std::size_t, ConvexHullPoint<T>> &, std::map<std::size_t, IndexedTriangle3D<T>> &) const;
-
-			typename std::map<std::size_t, EPATriangleData<T>>::const_iterator getClosestTriangleData(const typename std::map<std::size_t, EPATriangleData<T>> &) const;
-            EPATriangleData<T> createTriangleData(const ConvexHullShape3D<T> &, std::size_t) const;
+			std::size_t determineInitialPoints(const Simplex<T> &, const CollisionConvexObject3D &, const CollisionConvexObject3D &, EPAVertex<T> [5]) const;
+			bool determineInitialTriangles(const EPAVertex<T> [5], EPAPolytope<T> &) const;
+			void recordIterations(unsigned int) const;
 
             void logInputData(const std::string &, const CollisionConvexObject3D &, const CollisionConvexObject3D &, const GJKResult<T> &) const;
 
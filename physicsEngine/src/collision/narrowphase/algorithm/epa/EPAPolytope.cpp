@@ -0,0 +1,256 @@
+#include <algorithm>
+#include <cassert>
+#include <cmath>
+
+#include "collision/narrowphase/algorithm/epa/EPAPolytope.h"
+
+namespace urchin
+{
+
+	//static
+	template<class T> const std::size_t EPAPolytope<T>::MAX_VERTICES = 128;
+	template<class T> const std::size_t EPAPolytope<T>::MAX_FACES = 512;
+
+	template<class T> EPAPolytope<T>::EPAPolytope() :
+		vertices(MAX_VERTICES),
+		vertexCount(0),
+		faces(MAX_FACES),
+		faceCount(0),
+		firstHorizonFace(0),
+		lastHorizonFace(0),
+		horizonFaceCount(0)
+	{
+		facesHeap.reserve(MAX_FACES);
+	}
+
+	/**
+	 * Removes all vertices and faces. Buffers are kept for the next EPA process.
+	 */
+	template<class T> void EPAPolytope<T>::reset()
+	{
+		vertexCount = 0;
+		faceCount = 0;
+		facesHeap.clear();
+	}
+
+	/**
+	 * @return Index of the added vertex. The caller must ensure that the vertex count is lower than MAX_VERTICES.
+	 */
+	template<class T> std::size_t EPAPolytope<T>::addVertex(const Point3<T> &point, const Point3<T> &supportPointA, const Point3<T> &supportPointB)
+	{
+		assert(vertexCount < MAX_VERTICES);
+
+		EPAVertex<T> &vertex = vertices[vertexCount];
+		vertex.point = point;
+		vertex.supportPointA = supportPointA;
+		vertex.supportPointB = supportPointB;
+
+		return vertexCount++;
+	}
+
+	/**
+	 * Adds the four faces of the initial tetrahedron and links them together.
+	 * @param indices Vertex indices of faces sorted in counter clockwise direction
+	 * @return True when each edge is shared by two faces with opposite directions
+	 */
+	template<class T> bool EPAPolytope<T>::addInitialFaces(const std::size_t indices[4][3])
+	{
+		for(std::size_t i=0; i<4; ++i)
+		{
+			addFace(indices[i][0], indices[i][1], indices[i][2]);
+		}
+
+		unsigned int linkedEdges = 0;
+		for(std::size_t face1=0; face1<4; ++face1)
+		{
+			for(std::size_t face2=face1+1; face2<4; ++face2)
+			{
+				for(unsigned int edge1=0; edge1<3; ++edge1)
+				{
+					for(unsigned int edge2=0; edge2<3; ++edge2)
+					{
+						if(faces[face1].vertexIndices[edge1]==faces[face2].vertexIndices[(edge2+1)%3]
+								&& faces[face1].vertexIndices[(edge1+1)%3]==faces[face2].vertexIndices[edge2])
+						{
+							linkFaces(face1, edge1, face2, edge2);
+							linkedEdges++;
+						}
+					}
+				}
+			}
+		}
+
+		return linkedEdges==6;
+	}
+
+	/**
+	 * @return Index of the face nearest to the origin. Obsolete faces are removed from the heap on the fly.
+	 */
+	template<class T> std::size_t EPAPolytope<T>::getClosestFaceIndex()
+	{
+		FaceDistanceComparator faceDistanceComparator(faces);
+		while(faces[facesHeap.front()].obsolete)
+		{
+			std::pop_heap(facesHeap.begin(), facesHeap.end(), faceDistanceComparator);
+			facesHeap.pop_back();
+		}
+
+		return facesHeap.front();
+	}
+
+	/**
+	 * Removes the faces visible from the vertex and replaces them by faces linking the horizon edges to the vertex.
+	 * @param faceIndex Face visible from the vertex
+	 * @return True when the polytope has been expanded. On false, the polytope is not usable anymore but the data of
+	 * the faces already created stay valid.
+	 */
+	template<class T> bool EPAPolytope<T>::expand(std::size_t faceIndex, std::size_t vertexIndex)
+	{
+		EPAFace<T> &face = faces[faceIndex];
+		if(!isVisible(faceIndex, vertexIndex))
+		{
+			return false;
+		}
+
+		face.obsolete = true;
+		horizonFaceCount = 0;
+		for(unsigned int edge=0; edge<3; ++edge)
+		{
+			if(!computeHorizon(face.adjacentFaces[edge], face.adjacentEdges[edge], vertexIndex))
+			{
+				return false;
+			}
+		}
+
+		if(horizonFaceCount < 3)
+		{
+			return false;
+		}
+
+		linkFaces(lastHorizonFace, 1, firstHorizonFace, 2);
+		return true;
+	}
+
+	template<class T> const EPAVertex<T> &EPAPolytope<T>::getVertex(std::size_t vertexIndex) const
+	{
+		return vertices[vertexIndex];
+	}
+
+	template<class T> std::size_t EPAPolytope<T>::getVertexCount() const
+	{
+		return vertexCount;
+	}
+
+	template<class T> const EPAFace<T> &EPAPolytope<T>::getFace(std::size_t faceIndex) const
+	{
+		return faces[faceIndex];
+	}
+
+	template<class T> std::size_t EPAPolytope<T>::addFace(std::size_t vertexIndex1, std::size_t vertexIndex2, std::size_t vertexIndex3)
+	{
+		std::size_t faceIndex = faceCount++;
+		EPAFace<T> &face = faces[faceIndex];
+		face.vertexIndices[0] = vertexIndex1;
+		face.vertexIndices[1] = vertexIndex2;
+		face.vertexIndices[2] = vertexIndex3;
+		face.obsolete = false;
+
+		const Triangle3D<T> triangle(vertices[vertexIndex1].point, vertices[vertexIndex2].point, vertices[vertexIndex3].point);
+
+		//compute point on the triangle nearest to origin
+		T barycentrics[3];
+		Point3<T> closestPointToOrigin = triangle.closestPoint(Point3<T>(0.0, 0.0, 0.0), barycentrics);
+
+		//compute minimum distance between triangle and the origin
+		T distanceToOrigin = closestPointToOrigin.toVector().length();
+
+		//compute normal (external to convex hull)
+		const Vector3<T> normal = triangle.computeNormal();
+
+		face.triangleData = EPATriangleData<T>(distanceToOrigin, normal, closestPointToOrigin, barycentrics);
+
+		facesHeap.push_back(faceIndex);
+		std::push_heap(facesHeap.begin(), facesHeap.end(), FaceDistanceComparator(faces));
+
+		return faceIndex;
+	}
+
+	template<class T> void EPAPolytope<T>::linkFaces(std::size_t faceIndex1, unsigned int edge1, std::size_t faceIndex2, unsigned int edge2)
+	{
+		faces[faceIndex1].adjacentFaces[edge1] = faceIndex2;
+		faces[faceIndex1].adjacentEdges[edge1] = edge2;
+		faces[faceIndex2].adjacentFaces[edge2] = faceIndex1;
+		faces[faceIndex2].adjacentEdges[edge2] = edge1;
+	}
+
+	/**
+	 * Walks through the faces visible from the vertex by crossing the edges. A face not visible from the vertex is
+	 * beyond the horizon: a new face is created between the crossed edge and the vertex. Horizon edges are reached in
+	 * counter clockwise order, so each new face is linked to the previous one.
+	 * @param edge Crossed edge of the face
+	 * @return False when the faces capacity is reached
+	 */
+	template<class T> bool EPAPolytope<T>::computeHorizon(std::size_t faceIndex, unsigned int edge, std::size_t vertexIndex)
+	{
+		EPAFace<T> &face = faces[faceIndex];
+		if(face.obsolete)
+		{
+			return true;
+		}
+
+		const unsigned int nextEdge = (edge+1)%3;
+		if(!isVisible(faceIndex, vertexIndex))
+		{
+			if(faceCount==MAX_FACES)
+			{
+				return false;
+			}
+
+			std::size_t newFaceIndex = addFace(face.vertexIndices[nextEdge], face.vertexIndices[edge], vertexIndex);
+			linkFaces(newFaceIndex, 0, faceIndex, edge);
+			if(horizonFaceCount==0)
+			{
+				firstHorizonFace = newFaceIndex;
+			}else
+			{
+				linkFaces(lastHorizonFace, 1, newFaceIndex, 2);
+			}
+			lastHorizonFace = newFaceIndex;
+			horizonFaceCount++;
+
+			return true;
+		}
+
+		face.obsolete = true;
+		const unsigned int previousEdge = (edge+2)%3;
+		return computeHorizon(face.adjacentFaces[nextEdge], face.adjacentEdges[nextEdge], vertexIndex)
+				&& computeHorizon(face.adjacentFaces[previousEdge], face.adjacentEdges[previousEdge], vertexIndex);
+	}
+
+	template<class T> bool EPAPolytope<T>::isVisible(std::size_t faceIndex, std::size_t vertexIndex) const
+	{
+		const EPAFace<T> &face = faces[faceIndex];
+		const Vector3<T> faceToVertex = vertices[face.vertexIndices[0]].point.vector(vertices[vertexIndex].point);
+
+		return face.triangleData.getNormal().dotProduct(faceToVertex) > 0.0;
+	}
+
+	template<class T> EPAPolytope<T>::FaceDistanceComparator::FaceDistanceComparator(const std::vector<EPAFace<T>> &faces) :
+		faces(faces)
+	{
+
+	}
+
+	/**
+	 * @return True when the first face is farther from the origin than the second one: nearest face is on top of the heap
+	 */
+	template<class T> bool EPAPolytope<T>::FaceDistanceComparator::operator()(std::size_t faceIndex1, std::size_t faceIndex2) const
+	{
+		return std::abs(faces[faceIndex1].triangleData.getDistanceToOrigin()) > std::abs(faces[faceIndex2].triangleData.getDistanceToOrigin());
+	}
+
+	//explicit template
+	template class EPAPolytope<float>;
+	template class EPAPolytope<double>;
+
+}
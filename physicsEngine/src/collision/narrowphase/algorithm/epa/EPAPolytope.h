@@ -0,0 +1,79 @@
+#ifndef URCHINENGINE_EPAPOLYTOPE_H
+#define URCHINENGINE_EPAPOLYTOPE_H
+
+#include <vector>
+#include "UrchinCommon.h"
+
+#include "collision/narrowphase/algorithm/epa/EPATriangleData.h"
+
+namespace urchin
+{
+
+	template<class T> struct EPAVertex
+	{
+		Point3<T> point; //point of Minkowski difference
+		Point3<T> supportPointA; //support point of object A used to compute the point
+		Point3<T> supportPointB; //support point of object B used to compute the point
+	};
+
+	template<class T> struct EPAFace
+	{
+		std::size_t vertexIndices[3]; //sorted in counter clockwise direction
+		std::size_t adjacentFaces[3]; //adjacent face sharing the edge from vertex i to vertex i+1
+		unsigned int adjacentEdges[3]; //index of the shared edge in the adjacent face
+		EPATriangleData<T> triangleData;
+		bool obsolete;
+	};
+
+	/**
+	* Expanding polytope of EPA algorithm. Vertices and faces are stored in buffers of fixed capacity allocated once:
+	* faces removed from the polytope are only flagged as obsolete and skipped when they reach the top of the heap.
+	*/
+	template<class T> class EPAPolytope
+	{
+		public:
+			static const std::size_t MAX_VERTICES;
+			static const std::size_t MAX_FACES;
+
+			EPAPolytope();
+
+			void reset();
+
+			std::size_t addVertex(const Point3<T> &, const Point3<T> &, const Point3<T> &);
+			bool addInitialFaces(const std::size_t [4][3]);
+
+			std::size_t getClosestFaceIndex();
+			bool expand(std::size_t, std::size_t);
+
+			const EPAVertex<T> &getVertex(std::size_t) const;
+			std::size_t getVertexCount() const;
+			const EPAFace<T> &getFace(std::size_t) const;
+
+		private:
+			std::size_t addFace(std::size_t, std::size_t, std::size_t);
+			void linkFaces(std::size_t, unsigned int, std::size_t, unsigned int);
+			bool computeHorizon(std::size_t, unsigned int, std::size_t);
+			bool isVisible(std::size_t, std::size_t) const;
+
+			struct FaceDistanceComparator
+			{
+				explicit FaceDistanceComparator(const std::vector<EPAFace<T>> &);
+				bool operator()(std::size_t, std::size_t) const;
+
+				const std::vector<EPAFace<T>> &faces;
+			};
+
+			std::vector<EPAVertex<T>> vertices;
+			std::size_t vertexCount;
+			std::vector<EPAFace<T>> faces;
+			std::size_t faceCount;
+			std::vector<std::size_t> facesHeap;
+
+			//horizon of the current expansion: faces created around the new vertex
+			std::size_t firstHorizonFace, lastHorizonFace;
+			unsigned int horizonFaceCount;
+	};
+
+}
+
+#endif
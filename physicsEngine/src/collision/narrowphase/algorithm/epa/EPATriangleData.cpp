@@ -3,6 +3,13 @@
 namespace urchin
 {
 
+	template<class T> EPATriangleData<T>::EPATriangleData() :
+		distanceToOrigin(0.0),
+		barycentrics{0.0, 0.0, 0.0}
+	{
+
+	}
+
 	/**
 	* @param distanceToOrigin Minimum distance between the triangle and the origin
 	* @param closestPointToOrigin Point on the triangle nearest to origin
@@ -9,6 +9,7 @@ namespace urchin
 	template<class T> class EPATriangleData
 	{
 		public:
+			EPATriangleData();
 			EPATriangleData(T, const Vector3<T> &, const Point3<T> &, T [3]);
 
 			T getDistanceToOrigin() const;
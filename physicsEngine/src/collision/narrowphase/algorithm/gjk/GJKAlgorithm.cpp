@@ -5,6 +5,7 @@
 #include "collision/narrowphase/algorithm/utils/AlgorithmResultAllocator.h"
 #include "collision/narrowphase/algorithm/gjk/GJKAlgorithm.h"
 #include "utils/property/EagerPropertyLoader.h"
+#include "statistics/ScopeThreadStatistics.h"
 
 namespace urchin
 {
@@ -21,9 +22,20 @@ namespace urchin
 	*/
 	template<class T> std::unique_ptr<GJKResult<T>, AlgorithmResultDeleter> GJKAlgorithm<T>::processGJK(const CollisionConvexObject3D &convexObject1,
 			const CollisionConvexObject3D &convexObject2, bool includeMargin) const
+	{
+		return processGJK(convexObject1, convexObject2, includeMargin, Vector3<T>(1.0, 0.0, 0.0));
+	}
+
+	/**
+	* @param includeMargin Indicate whether algorithm operates on objects with margin
+	* @param initialDirection Direction used to find the first point of the simplex. A direction close to the direction
+	* from the closest point of the Minkowski difference to the origin (e.g.: result of the previous frame) reduces the
+	* number of iterations.
+	*/
+	template<class T> std::unique_ptr<GJKResult<T>, AlgorithmResultDeleter> GJKAlgorithm<T>::processGJK(const CollisionConvexObject3D &convexObject1,
+			const CollisionConvexObject3D &convexObject2, bool includeMargin, const Vector3<T> &initialDirection) const
 	{
 		//get point which belongs to the outline of the shape (Minkowski difference)
-		Vector3<T> initialDirection = Vector3<T>(1.0, 0.0, 0.0);
 		Point3<T> initialSupportPointA = convexObject1.getSupportPoint(initialDirection.template cast<float>(), includeMargin).template cast<T>();
 		Point3<T> initialSupportPointB = convexObject2.getSupportPoint((-initialDirection).template cast<float>(), includeMargin).template cast<T>();
 		Point3<T> initialPoint = initialSupportPointA - initialSupportPointB;
@@ -46,6 +58,7 @@ namespace urchin
 			//check termination conditions: new point is not more extreme that existing ones OR new point already exist in simplex
 			if((closestPointSquareDistance-closestPointDotNewPoint) <= terminationTolerance || simplex.isPointInSimplex(newPoint))
 			{
+				recordIterations(iterationNumber);
 				if(closestPointDotNewPoint <= 0.0)
 				{ //collision detected
                     return AlgorithmResultAllocator::instance()->newGJKResultCollide<T>(simplex);
@@ -59,11 +72,21 @@ namespace urchin
 			direction = (-simplex.getClosestPointToOrigin()).toVector();
 		}
 
+		recordIterations(maxIteration);
 		logMaximumIterationReach(convexObject1, convexObject2, includeMargin);
 
         return AlgorithmResultAllocator::instance()->newGJKResultInvalid<T>();
 	}
 
+	template<class T> void GJKAlgorithm<T>::recordIterations(unsigned int iterations) const
+	{
+		PhysicsStatistics *statistics = ScopeThreadStatistics::current();
+		if(statistics)
+		{
+			statistics->gjkIterations[PhysicsStatistics::toIterationHistogramBucket(iterations)]++;
+		}
+	}
+
 	template<class T> void GJKAlgorithm<T>::logMaximumIterationReach(const CollisionConvexObject3D &convexObject1,
 			const CollisionConvexObject3D &convexObject2, bool includeMargin) const
 	{
@@ -23,8 +23,10 @@ namespace urchin
 			GJKAlgorithm();
 
 			std::unique_ptr<GJKResult<T>, AlgorithmResultDeleter> processGJK(const CollisionConvexObject3D &, const CollisionConvexObject3D &, bool) const;
+			std::unique_ptr<GJKResult<T>, AlgorithmResultDeleter> processGJK(const CollisionConvexObject3D &, const CollisionConvexObject3D &, bool, const Vector3<T> &) const;
 
 		private:
+			void recordIterations(unsigned int) const;
 			void logMaximumIterationReach(const CollisionConvexObject3D &, const CollisionConvexObject3D &, bool) const;
 
 			const unsigned int maxIteration;
@@ -1,5 +1,4 @@
 #include <sstream>
-#include <utility>
 
 #include "object/CollisionConvexHullObject.h"
 
@@ -7,38 +6,44 @@ namespace urchin
 {
 
 	/**
-	 * @param pointsWithMargin Points including margin used to construct the convex hull. Points inside the convex hull are accepted but will unused.
-	 * @param pointsWithoutMargin Points without margin used to construct the convex hull. Points inside the convex hull are accepted but will unused.
+	 * @param localPointsWithMargin Convex hull points including margin and expressed in local space. Points are not copied and must outlive the object.
+	 * @param localPointsWithoutMargin Convex hull points without margin and expressed in local space. Points are not copied and must outlive the object.
 	 * @param outerMargin Collision outer margin. Collision margin must match with convex hulls arguments.
 	 */
-	CollisionConvexHullObject::CollisionConvexHullObject(float outerMargin, const std::vector<Point3<float>> &pointsWithMargin, const std::vector<Point3<float>> &pointsWithoutMargin) :
+	CollisionConvexHullObject::CollisionConvexHullObject(float outerMargin, const std::vector<Point3<float>> *localPointsWithMargin,
+			const std::vector<Point3<float>> *localPointsWithoutMargin, const Point3<float> &position, const Quaternion<float> &orientation) :
 			CollisionConvexObject3D(outerMargin),
-			convexHullObjectWithMargin(std::make_shared<ConvexHull3D<float>>(pointsWithMargin)),
-			convexHullObjectWithoutMargin(std::make_shared<ConvexHull3D<float>>(pointsWithoutMargin))
+			localPointsWithMargin(localPointsWithMargin),
+			localPointsWithoutMargin(localPointsWithoutMargin),
+			position(position),
+			orientation(orientation),
+			inverseOrientation(orientation.conjugate())
 	{
 
 	}
 
-	/**
-	 * @param outerMargin Collision outer margin. Collision margin must match with convex hulls arguments.
-	 */
-	CollisionConvexHullObject::CollisionConvexHullObject(float outerMargin, std::shared_ptr<ConvexHull3D<float>> convexHullObjectWithMargin, std::shared_ptr<ConvexHull3D<float>> convexHullObjectWithoutMargin) :
-			CollisionConvexObject3D(outerMargin),
-			convexHullObjectWithMargin(std::move(convexHullObjectWithMargin)),
-			convexHullObjectWithoutMargin(std::move(convexHullObjectWithoutMargin))
+	std::vector<Point3<float>> CollisionConvexHullObject::getPointsWithoutMargin() const
 	{
-
+		return toWorldPoints(*localPointsWithoutMargin);
 	}
 
-	std::vector<Point3<float>> CollisionConvexHullObject::getPointsWithoutMargin() const
+	std::vector<Point3<float>> CollisionConvexHullObject::getPointsWithMargin() const
 	{
-		return convexHullObjectWithoutMargin->getPoints();
+		return toWorldPoints(*localPointsWithMargin);
 	}
 
-    std::vector<Point3<float>> CollisionConvexHullObject::getPointsWithMargin() const
-    {
-        return convexHullObjectWithMargin->getPoints();
-    }
+	std::vector<Point3<float>> CollisionConvexHullObject::toWorldPoints(const std::vector<Point3<float>> &localPoints) const
+	{
+		std::vector<Point3<float>> worldPoints;
+		worldPoints.reserve(localPoints.size());
+
+		for(const auto &localPoint : localPoints)
+		{
+			worldPoints.push_back(orientation.rotatePoint(localPoint) + position);
+		}
+
+		return worldPoints;
+	}
 
 	CollisionConvexObject3D::ObjectType CollisionConvexHullObject::getObjectType() const
 	{
@@ -50,12 +55,22 @@ namespace urchin
 	 */
 	Point3<float> CollisionConvexHullObject::getSupportPoint(const Vector3<float> &direction, bool includeMargin) const
 	{
-		if(includeMargin)
+		const std::vector<Point3<float>> &localPoints = includeMargin ? *localPointsWithMargin : *localPointsWithoutMargin;
+		Point3<float> localDirection = inverseOrientation.rotatePoint(Point3<float>(direction.X, direction.Y, direction.Z));
+
+		std::size_t maxPointIndex = 0;
+		float maxPointDotDirection = localPoints[0].X * localDirection.X + localPoints[0].Y * localDirection.Y + localPoints[0].Z * localDirection.Z;
+		for(std::size_t i=1, size=localPoints.size(); i<size; ++i)
 		{
-			return convexHullObjectWithMargin->getSupportPoint(direction);
+			float pointDotDirection = localPoints[i].X * localDirection.X + localPoints[i].Y * localDirection.Y + localPoints[i].Z * localDirection.Z;
+			if(pointDotDirection > maxPointDotDirection)
+			{
+				maxPointDotDirection = pointDotDirection;
+				maxPointIndex = i;
+			}
 		}
 
-		return convexHullObjectWithoutMargin->getSupportPoint(direction);
+		return orientation.rotatePoint(localPoints[maxPointIndex]) + position;
 	}
 
 	std::string CollisionConvexHullObject::toString() const
@@ -65,8 +80,10 @@ namespace urchin
 
 		ss << "Collision convex hull:" << std::endl;
 		ss << std::setw(20) << std::left << " - Outer margin: " << getOuterMargin() << std::endl;
-		ss << std::setw(20) << std::left << " - Convex hull (margin): " << (*convexHullObjectWithMargin) << std::endl;
-		ss << std::setw(20) << std::left << " - Convex hull (no margin): " << (*convexHullObjectWithoutMargin);
+		ss << std::setw(20) << std::left << " - Position: " << position << std::endl;
+		ss << std::setw(20) << std::left << " - Orientation: " << orientation << std::endl;
+		ss << std::setw(20) << std::left << " - Points (margin): " << localPointsWithMargin->size() << std::endl;
+		ss << std::setw(20) << std::left << " - Points (no margin): " << localPointsWithoutMargin->size();
 
 		return ss.str();
 	}
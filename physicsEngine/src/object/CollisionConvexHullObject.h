@@ -2,9 +2,7 @@
 #define URCHINENGINE_COLLISIONCONVEXHULLOBJECT_H
 
 #include <string>
-#include <map>
 #include <vector>
-#include <memory>
 #include "UrchinCommon.h"
 
 #include "object/CollisionConvexObject3D.h"
@@ -12,14 +10,18 @@
 namespace urchin
 {
 
+	/**
+	* Convex hull defined by points expressed in local space and a transformation. Support points are computed in local
+	* space: points are never transformed into world space during collision tests.
+	*/
 	class CollisionConvexHullObject : public CollisionConvexObject3D
 	{
 		public:
-			CollisionConvexHullObject(float, const std::vector<Point3<float>> &, const std::vector<Point3<float>> &);
-			CollisionConvexHullObject(float, std::shared_ptr<ConvexHull3D<float>>, std::shared_ptr<ConvexHull3D<float>>);
+			CollisionConvexHullObject(float, const std::vector<Point3<float>> *, const std::vector<Point3<float>> *, const Point3<float> &, const Quaternion<float> &);
+			CollisionConvexHullObject(const CollisionConvexHullObject &) = delete;
 
 			std::vector<Point3<float>> getPointsWithoutMargin() const;
-            std::vector<Point3<float>> getPointsWithMargin() const;
+			std::vector<Point3<float>> getPointsWithMargin() const;
 
 			CollisionConvexObject3D::ObjectType getObjectType() const override;
 			Point3<float> getSupportPoint(const Vector3<float> &, bool) const override;
@@ -27,8 +29,13 @@ namespace urchin
 			std::string toString() const override;
 
 		private:
-			std::shared_ptr<ConvexHull3D<float>> convexHullObjectWithMargin;
-			std::shared_ptr<ConvexHull3D<float>> convexHullObjectWithoutMargin;
+			std::vector<Point3<float>> toWorldPoints(const std::vector<Point3<float>> &) const;
+
+			const std::vector<Point3<float>> *localPointsWithMargin;
+			const std::vector<Point3<float>> *localPointsWithoutMargin;
+			Point3<float> position;
+			Quaternion<float> orientation;
+			Quaternion<float> inverseOrientation;
 	};
 
 }
@@ -0,0 +1,25 @@
+#include "object/StandaloneConvexHullObject.h"
+
+namespace urchin
+{
+
+	StandaloneConvexHullPoints::StandaloneConvexHullPoints(const std::vector<Point3<float>> &pointsWithMargin, const std::vector<Point3<float>> &pointsWithoutMargin) :
+			ownedPointsWithMargin(ConvexHullShape3D<float>(pointsWithMargin).getPoints()),
+			ownedPointsWithoutMargin(ConvexHullShape3D<float>(pointsWithoutMargin).getPoints())
+	{
+
+	}
+
+	/**
+	 * @param pointsWithMargin Points including margin used to construct the convex hull. Points inside the convex hull are accepted but will unused.
+	 * @param pointsWithoutMargin Points without margin used to construct the convex hull. Points inside the convex hull are accepted but will unused.
+	 * @param outerMargin Collision outer margin. Collision margin must match with convex hulls arguments.
+	 */
+	StandaloneConvexHullObject::StandaloneConvexHullObject(float outerMargin, const std::vector<Point3<float>> &pointsWithMargin, const std::vector<Point3<float>> &pointsWithoutMargin) :
+			StandaloneConvexHullPoints(pointsWithMargin, pointsWithoutMargin),
+			CollisionConvexHullObject(outerMargin, &ownedPointsWithMargin, &ownedPointsWithoutMargin, Point3<float>(0.0, 0.0, 0.0), Quaternion<float>())
+	{
+
+	}
+
+}
@@ -0,0 +1,38 @@
+#ifndef URCHINENGINE_STANDALONECONVEXHULLOBJECT_H
+#define URCHINENGINE_STANDALONECONVEXHULLOBJECT_H
+
+#include <vector>
+#include "UrchinCommon.h"
+
+#include "object/CollisionConvexHullObject.h"
+
+namespace urchin
+{
+
+	/**
+	* Convex hull points owned by a standalone convex hull object. Declared as first base class of the object so that the
+	* points are built before the convex hull object referencing them.
+	*/
+	class StandaloneConvexHullPoints
+	{
+		protected:
+			StandaloneConvexHullPoints(const std::vector<Point3<float>> &, const std::vector<Point3<float>> &);
+
+			std::vector<Point3<float>> ownedPointsWithMargin;
+			std::vector<Point3<float>> ownedPointsWithoutMargin;
+	};
+
+	/**
+	* Convex hull object owning its points and expressed in world space. Created outside the collision convex object pool
+	* (tools, tests) so that the pooled convex hull objects keep referencing the points of their shape.
+	*/
+	class StandaloneConvexHullObject : private StandaloneConvexHullPoints, public CollisionConvexHullObject
+	{
+		public:
+			StandaloneConvexHullObject(float, const std::vector<Point3<float>> &, const std::vector<Point3<float>> &);
+			StandaloneConvexHullObject(const StandaloneConvexHullObject &) = delete;
+	};
+
+}
+
+#endif
@@ -9,6 +9,11 @@ namespace urchin
 
     class CollisionConvexObject3D;
 
+    /**
+    * Pool of the convex objects created by the collision shapes. The pool is shared by all the physics worlds of the process:
+    * the shapes create their convex objects without any world context and a shape can be used by several worlds. Worlds processed
+    * concurrently (see PhysicsWorldScheduler) don't contend on the pool lock because each thread works in its own pool cache.
+    */
     class CollisionConvexObjectPool : public Singleton<CollisionConvexObjectPool>
     {
         public:
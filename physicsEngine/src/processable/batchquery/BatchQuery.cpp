@@ -0,0 +1,114 @@
+#include <stdexcept>
+
+#include "processable/batchquery/BatchQuery.h"
+
+namespace urchin
+{
+
+	/**
+	 * @return Index of the test in the batch
+	 */
+	unsigned int BatchQuery::addRayTest(const Ray<float> &ray)
+	{
+		rays.push_back(ray);
+		enlargeSizes.push_back(0.0f);
+		sweepShapes.push_back(nullptr);
+		froms.emplace_back(PhysicsTransform(ray.getOrigin()));
+		tos.emplace_back(PhysicsTransform(ray.computeTo()));
+		closestHitOnly.push_back(false);
+
+		return rays.size() - 1;
+	}
+
+	/**
+	 * Add a ray test returning only the closest hit. Faster than a ray test on concave shapes (e.g. heightfield) as only
+	 * the closest triangle hit by the ray is tested.
+	 * @return Index of the test in the batch
+	 */
+	unsigned int BatchQuery::addClosestHitRayTest(const Ray<float> &ray)
+	{
+		unsigned int testIndex = addRayTest(ray);
+		closestHitOnly[testIndex] = true;
+
+		return testIndex;
+	}
+
+	/**
+	 * @param shape Convex shape moving from 'from' to 'to'
+	 * @return Index of the test in the batch
+	 */
+	unsigned int BatchQuery::addSweepTest(const std::shared_ptr<const CollisionShape3D> &shape, const PhysicsTransform &from, const PhysicsTransform &to)
+	{
+		if(!shape->isConvex())
+		{
+			throw std::invalid_argument("Sweep test is only supported for convex shape. Shape type: " + std::to_string(shape->getShapeType()));
+		}
+
+		rays.emplace_back(Ray<float>(from.getPosition(), to.getPosition()));
+		enlargeSizes.push_back(shape->getMaxDistanceToCenter());
+		sweepShapes.push_back(shape);
+		froms.push_back(from);
+		tos.push_back(to);
+		closestHitOnly.push_back(false);
+
+		return rays.size() - 1;
+	}
+
+	unsigned int BatchQuery::getNumberOfTests() const
+	{
+		return rays.size();
+	}
+
+	void BatchQuery::clear()
+	{
+		rays.clear();
+		enlargeSizes.clear();
+		sweepShapes.clear();
+		froms.clear();
+		tos.clear();
+		closestHitOnly.clear();
+	}
+
+	/**
+	 * @return Rays of the tests. For sweep tests, ray goes from the initial position to the final position of the shape.
+	 */
+	const std::vector<Ray<float>> &BatchQuery::getRays() const
+	{
+		return rays;
+	}
+
+	/**
+	 * @return Enlargement to apply on bodies AABBox to detect the bodies potentially hit by the tests
+	 */
+	const std::vector<float> &BatchQuery::getEnlargeSizes() const
+	{
+		return enlargeSizes;
+	}
+
+	/**
+	 * @return Shape of the sweep test or null for a ray test
+	 */
+	const CollisionShape3D *BatchQuery::getSweepShape(unsigned int testIndex) const
+	{
+		return sweepShapes[testIndex].get();
+	}
+
+	const PhysicsTransform &BatchQuery::getFrom(unsigned int testIndex) const
+	{
+		return froms[testIndex];
+	}
+
+	const PhysicsTransform &BatchQuery::getTo(unsigned int testIndex) const
+	{
+		return tos[testIndex];
+	}
+
+	/**
+	 * @return True when only the closest hit of the test is required
+	 */
+	bool BatchQuery::isClosestHitOnly(unsigned int testIndex) const
+	{
+		return closestHitOnly[testIndex];
+	}
+
+}
@@ -0,0 +1,46 @@
+#ifndef URCHINENGINE_BATCHQUERY_H
+#define URCHINENGINE_BATCHQUERY_H
+
+#include <vector>
+#include <memory>
+#include "UrchinCommon.h"
+
+#include "shape/CollisionShape3D.h"
+#include "utils/math/PhysicsTransform.h"
+
+namespace urchin
+{
+
+	/**
+	* Set of ray tests and sweep tests resolved together by the physics world. Each test is identified by the index
+	* returned at its addition: the same index allows to retrieve its result in BatchQueryResult.
+	*/
+	class BatchQuery
+	{
+		public:
+			unsigned int addRayTest(const Ray<float> &);
+			unsigned int addClosestHitRayTest(const Ray<float> &);
+			unsigned int addSweepTest(const std::shared_ptr<const CollisionShape3D> &, const PhysicsTransform &, const PhysicsTransform &);
+
+			unsigned int getNumberOfTests() const;
+			void clear();
+
+			const std::vector<Ray<float>> &getRays() const;
+			const std::vector<float> &getEnlargeSizes() const;
+			const CollisionShape3D *getSweepShape(unsigned int) const;
+			const PhysicsTransform &getFrom(unsigned int) const;
+			const PhysicsTransform &getTo(unsigned int) const;
+			bool isClosestHitOnly(unsigned int) const;
+
+		private:
+			std::vector<Ray<float>> rays;
+			std::vector<float> enlargeSizes;
+			std::vector<std::shared_ptr<const CollisionShape3D>> sweepShapes;
+			std::vector<PhysicsTransform> froms;
+			std::vector<PhysicsTransform> tos;
+			std::vector<bool> closestHitOnly;
+	};
+
+}
+
+#endif
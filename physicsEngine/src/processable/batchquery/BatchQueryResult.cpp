@@ -0,0 +1,78 @@
+#include <stdexcept>
+
+#include "processable/batchquery/BatchQueryResult.h"
+
+namespace urchin
+{
+
+	BatchQueryResult::BatchQueryResult() :
+			resultReady(false)
+	{
+
+	}
+
+	void BatchQueryResult::addResults(std::vector<ccd_set> &testsResults)
+	{
+		assert(this->testsResults.empty());
+
+		this->testsResults.swap(testsResults);
+
+		resultReady.store(true, std::memory_order_release);
+	}
+
+	/**
+	 * Return true if result is available. Indeed, after calling batch query method, the result is not directly available
+	 * as the physics engine work in separate thread.
+	 */
+	bool BatchQueryResult::isResultReady() const
+	{
+		return resultReady.load(std::memory_order_acquire);
+	}
+
+	unsigned int BatchQueryResult::getNumberOfResults() const
+	{
+		checkResultReady();
+
+		return testsResults.size();
+	}
+
+	/**
+	 * @param testIndex Index of the test returned by BatchQuery
+	 */
+	bool BatchQueryResult::hasHit(unsigned int testIndex) const
+	{
+		checkResultReady();
+
+		return !testsResults[testIndex].empty();
+	}
+
+	/**
+	 * @param testIndex Index of the test returned by BatchQuery
+	 */
+	const std::unique_ptr<ContinuousCollisionResult<float>, AlgorithmResultDeleter> &BatchQueryResult::getNearestResult(unsigned int testIndex) const
+	{
+		checkResultReady();
+		assert(!testsResults[testIndex].empty());
+
+		return *testsResults[testIndex].begin();
+	}
+
+	/**
+	 * @param testIndex Index of the test returned by BatchQuery
+	 */
+	const ccd_set &BatchQueryResult::getResults(unsigned int testIndex) const
+	{
+		checkResultReady();
+
+		return testsResults[testIndex];
+	}
+
+	void BatchQueryResult::checkResultReady() const
+	{
+		if(!resultReady.load(std::memory_order_acquire))
+		{
+			throw std::runtime_error("Batch query result is not ready.");
+		}
+	}
+
+}
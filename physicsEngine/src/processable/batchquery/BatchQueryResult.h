@@ -0,0 +1,41 @@
+#ifndef URCHINENGINE_BATCHQUERYRESULT_H
+#define URCHINENGINE_BATCHQUERYRESULT_H
+
+#include <atomic>
+#include <memory>
+#include <vector>
+
+#include "collision/narrowphase/algorithm/continuous/result/ContinuousCollisionResult.h"
+
+namespace urchin
+{
+
+	/**
+	 * Result of a batch query. The result is filled asynchronously to the batch query when the query is not synchronous.
+	 * Method "isResultReady" returns true when the results of all tests are completed.
+	 */
+	class BatchQueryResult
+	{
+		public:
+			BatchQueryResult();
+
+			void addResults(std::vector<ccd_set> &);
+
+			bool isResultReady() const;
+
+			unsigned int getNumberOfResults() const;
+			bool hasHit(unsigned int) const;
+			const std::unique_ptr<ContinuousCollisionResult<float>, AlgorithmResultDeleter> &getNearestResult(unsigned int) const;
+			const ccd_set &getResults(unsigned int) const;
+
+		private:
+			void checkResultReady() const;
+
+			std::atomic_bool resultReady;
+
+			std::vector<ccd_set> testsResults;
+	};
+
+}
+
+#endif
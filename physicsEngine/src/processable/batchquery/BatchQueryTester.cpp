@@ -0,0 +1,58 @@
+#include <utility>
+
+#include "processable/batchquery/BatchQueryTester.h"
+#include "shape/CollisionSphereShape.h"
+#include "object/TemporalObject.h"
+
+namespace urchin
+{
+
+	BatchQueryTester::BatchQueryTester(BatchQuery batchQuery) :
+			batchQuery(std::move(batchQuery)),
+			batchQueryResult(std::make_shared<BatchQueryResult>()),
+			collisionWorld(nullptr)
+	{
+
+	}
+
+	std::shared_ptr<const BatchQueryResult> BatchQueryTester::getBatchQueryResult() const
+	{
+		return batchQueryResult;
+	}
+
+	void BatchQueryTester::initialize(PhysicsWorld *physicsWorld)
+	{
+		collisionWorld = physicsWorld->getCollisionWorld();
+	}
+
+	void BatchQueryTester::setup(float, const Vector3<float> &)
+	{
+		//nothing to do
+	}
+
+	/**
+	 * Resolve all tests of the batch: bodies potentially hit by the tests are determined in one pass on the broad phase
+	 * structure, then each test is resolved by the narrow phase.
+	 */
+	void BatchQueryTester::execute(float, const Vector3<float> &)
+	{
+		std::vector<std::vector<AbstractWorkBody *>> bodiesAABBoxHit;
+		collisionWorld->getBroadPhaseManager()->batchRayTest(batchQuery.getRays(), batchQuery.getEnlargeSizes(), bodiesAABBoxHit);
+
+		CollisionSphereShape pointShape(0.0f);
+		std::vector<ccd_set> testsResults(batchQuery.getNumberOfTests());
+		for(unsigned int testIndex=0; testIndex<batchQuery.getNumberOfTests(); ++testIndex)
+		{
+			if(!bodiesAABBoxHit[testIndex].empty())
+			{
+				const CollisionShape3D *sweepShape = batchQuery.getSweepShape(testIndex);
+				TemporalObject temporalObject(sweepShape ? sweepShape : &pointShape, batchQuery.getFrom(testIndex), batchQuery.getTo(testIndex));
+
+				testsResults[testIndex] = collisionWorld->getNarrowPhaseManager()->continuousCollisionTest(temporalObject, bodiesAABBoxHit[testIndex], batchQuery.isClosestHitOnly(testIndex));
+			}
+		}
+
+		batchQueryResult->addResults(testsResults);
+	}
+
+}
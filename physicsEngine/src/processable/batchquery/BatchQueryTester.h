@@ -0,0 +1,36 @@
+#ifndef URCHINENGINE_BATCHQUERYTESTER_H
+#define URCHINENGINE_BATCHQUERYTESTER_H
+
+#include "UrchinCommon.h"
+
+#include "PhysicsWorld.h"
+#include "processable/Processable.h"
+#include "processable/batchquery/BatchQuery.h"
+#include "processable/batchquery/BatchQueryResult.h"
+#include "collision/CollisionWorld.h"
+
+namespace urchin
+{
+
+	class BatchQueryTester : public Processable
+	{
+		public:
+			explicit BatchQueryTester(BatchQuery);
+
+			std::shared_ptr<const BatchQueryResult> getBatchQueryResult() const;
+
+			void initialize(PhysicsWorld *) override;
+
+			void setup(float, const Vector3<float> &) override;
+			void execute(float, const Vector3<float> &) override;
+
+		private:
+			const BatchQuery batchQuery;
+			std::shared_ptr<BatchQueryResult> batchQueryResult;
+
+			CollisionWorld *collisionWorld;
+	};
+
+}
+
+#endif
@@ -60,6 +60,8 @@ namespace urchin
 
 	AABBox<float> CollisionBoxShape::toAABBox(const PhysicsTransform &physicsTransform) const
 	{
+		std::lock_guard<std::mutex> lock(lastAABBoxMutex);
+
 		if(!lastTransform.equals(physicsTransform))
 		{
 			const Matrix3<float> &orientation = physicsTransform.retrieveOrientationMatrix();
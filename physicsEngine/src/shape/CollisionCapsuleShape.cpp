@@ -63,6 +63,8 @@ namespace urchin
 
 	AABBox<float> CollisionCapsuleShape::toAABBox(const PhysicsTransform &physicsTransform) const
 	{
+		std::lock_guard<std::mutex> lock(lastAABBoxMutex);
+
 		if(!lastTransform.equals(physicsTransform))
 		{
 			Vector3<float> boxHalfSizes(getRadius(), getRadius(), getRadius());
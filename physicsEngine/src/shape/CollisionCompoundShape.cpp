@@ -1,11 +1,15 @@
 #include <stdexcept>
 #include <limits>
+#include <algorithm>
 
 #include "shape/CollisionCompoundShape.h"
 
 namespace urchin
 {
 
+	//static
+	const unsigned int CollisionCompoundShape::NO_LOCALIZED_SHAPE = std::numeric_limits<unsigned int>::max();
+
 	CollisionCompoundShape::CollisionCompoundShape(const std::vector<std::shared_ptr<const LocalizedCollisionShape>> &localizedShapes) :
 			CollisionShape3D(),
 			localizedShapes(localizedShapes),
@@ -18,6 +22,7 @@ namespace urchin
 		}
 
 		initializeDistances();
+		initializeLocalizedShapeTree();
 	}
 
 	void CollisionCompoundShape::initializeDistances()
@@ -34,6 +39,60 @@ namespace urchin
 		}
 	}
 
+	void CollisionCompoundShape::initializeLocalizedShapeTree()
+	{
+		std::vector<std::pair<std::size_t, AABBox<float>>> localizedShapeBoxes;
+		localizedShapeBoxes.reserve(localizedShapes.size());
+		for(std::size_t i=0; i<localizedShapes.size(); ++i)
+		{
+			localizedShapeBoxes.emplace_back(i, localizedShapes[i]->shape->toAABBox(localizedShapes[i]->transform));
+		}
+
+		localizedShapeNodes.reserve(2 * localizedShapes.size() - 1);
+		buildLocalizedShapeTree(localizedShapeBoxes, 0, localizedShapeBoxes.size());
+	}
+
+	/**
+	 * Build the tree node of the localized shapes in range [begin, end[
+	 * @return Index of the built node
+	 */
+	unsigned int CollisionCompoundShape::buildLocalizedShapeTree(std::vector<std::pair<std::size_t, AABBox<float>>> &localizedShapeBoxes, std::size_t begin, std::size_t end)
+	{
+		auto nodeIndex = static_cast<unsigned int>(localizedShapeNodes.size());
+		localizedShapeNodes.emplace_back(LocalizedShapeNode());
+
+		AABBox<float> nodeBox = localizedShapeBoxes[begin].second;
+		for(std::size_t i=begin+1; i<end; ++i)
+		{
+			nodeBox = nodeBox.merge(localizedShapeBoxes[i].second);
+		}
+		localizedShapeNodes[nodeIndex].box = nodeBox;
+
+		if(end - begin == 1)
+		{
+			localizedShapeNodes[nodeIndex].leftChild = 0;
+			localizedShapeNodes[nodeIndex].rightChild = 0;
+			localizedShapeNodes[nodeIndex].localizedShapeIndex = static_cast<unsigned int>(localizedShapeBoxes[begin].first);
+			return nodeIndex;
+		}
+
+		//split on the median of the largest axis
+		unsigned int splitAxis = nodeBox.getMaxHalfSizeIndex();
+		std::size_t middle = begin + (end - begin) / 2;
+		std::nth_element(localizedShapeBoxes.begin() + (long)begin, localizedShapeBoxes.begin() + (long)middle, localizedShapeBoxes.begin() + (long)end,
+				[splitAxis](const std::pair<std::size_t, AABBox<float>> &left, const std::pair<std::size_t, AABBox<float>> &right) {
+					return left.second.getCenterOfMass()[splitAxis] < right.second.getCenterOfMass()[splitAxis];
+				});
+
+		unsigned int leftChild = buildLocalizedShapeTree(localizedShapeBoxes, begin, middle);
+		unsigned int rightChild = buildLocalizedShapeTree(localizedShapeBoxes, middle, end);
+
+		localizedShapeNodes[nodeIndex].leftChild = leftChild;
+		localizedShapeNodes[nodeIndex].rightChild = rightChild;
+		localizedShapeNodes[nodeIndex].localizedShapeIndex = NO_LOCALIZED_SHAPE;
+		return nodeIndex;
+	}
+
 	CollisionShape3D::ShapeType CollisionCompoundShape::getShapeType() const
 	{
 		return CollisionShape3D::COMPOUND_SHAPE;
@@ -49,6 +108,33 @@ namespace urchin
 		return localizedShapes;
 	}
 
+	/**
+	 * @param box Box expressed in compound shape space
+	 * @param localizedShapeIndices [out] Indices of the localized shapes having their box overlapping the provided box
+	 */
+	void CollisionCompoundShape::findLocalizedShapes(const AABBox<float> &box, std::vector<std::size_t> &localizedShapeIndices) const
+	{
+		unsigned int browseNodes[64]; //tree is balanced: depth is limited to log2(number of shapes) + 1
+		unsigned int numberOfBrowseNodes = 0;
+		browseNodes[numberOfBrowseNodes++] = 0;
+
+		while(numberOfBrowseNodes!=0)
+		{
+			const LocalizedShapeNode &node = localizedShapeNodes[browseNodes[--numberOfBrowseNodes]];
+			if(node.box.collideWithAABBox(box))
+			{
+				if(node.localizedShapeIndex!=NO_LOCALIZED_SHAPE)
+				{
+					localizedShapeIndices.push_back(node.localizedShapeIndex);
+				}else
+				{
+					browseNodes[numberOfBrowseNodes++] = node.rightChild;
+					browseNodes[numberOfBrowseNodes++] = node.leftChild;
+				}
+			}
+		}
+	}
+
 	std::shared_ptr<CollisionShape3D> CollisionCompoundShape::scale(float scale) const
 	{
 		std::vector<std::shared_ptr<const LocalizedCollisionShape>> scaledLocalizedShapes;
@@ -68,6 +154,8 @@ namespace urchin
 
 	AABBox<float> CollisionCompoundShape::toAABBox(const PhysicsTransform &physicsTransform) const
 	{
+		std::lock_guard<std::mutex> lock(lastAABBoxMutex);
+
 		if(!lastTransform.equals(physicsTransform))
 		{
 			PhysicsTransform shapeWorldTransform = physicsTransform * localizedShapes[0]->transform;
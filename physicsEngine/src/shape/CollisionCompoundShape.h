@@ -27,6 +27,7 @@ namespace urchin
 			CollisionShape3D::ShapeType getShapeType() const override;
 			const ConvexShape3D<float> *getSingleShape() const override;
 			const std::vector<std::shared_ptr<const LocalizedCollisionShape>> &getLocalizedShapes() const;
+			void findLocalizedShapes(const AABBox<float> &, std::vector<std::size_t> &) const;
 
 			std::shared_ptr<CollisionShape3D> scale(float) const override;
 
@@ -40,9 +41,21 @@ namespace urchin
 			CollisionShape3D *clone() const override;
 
 		private:
+			struct LocalizedShapeNode
+			{
+				AABBox<float> box; //box in compound shape space
+				unsigned int leftChild;
+				unsigned int rightChild;
+				unsigned int localizedShapeIndex; //NO_LOCALIZED_SHAPE for internal node
+			};
+			static const unsigned int NO_LOCALIZED_SHAPE;
+
 			void initializeDistances();
+			void initializeLocalizedShapeTree();
+			unsigned int buildLocalizedShapeTree(std::vector<std::pair<std::size_t, AABBox<float>>> &, std::size_t, std::size_t);
 
 			const std::vector<std::shared_ptr<const LocalizedCollisionShape>> localizedShapes;
+			std::vector<LocalizedShapeNode> localizedShapeNodes; //static tree of the localized shapes (root at index 0)
 
 			float maxDistanceToCenter;
 			float minDistanceToCenter;
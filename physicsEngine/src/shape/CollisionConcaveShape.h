@@ -15,7 +15,11 @@ namespace urchin
             virtual ~CollisionConcaveShape() = default;
 
             virtual const std::vector<CollisionTriangleShape> &findTrianglesInAABBox(const AABBox<float> &) const = 0;
-            virtual const std::vector<CollisionTriangleShape> &findTrianglesHitByRay(const LineSegment3D<float> &) const = 0;
+            virtual const std::vector<CollisionTriangleShape> &findTrianglesHitByRay(const LineSegment3D<float> &, bool) const = 0;
+
+            virtual void findTriangleIndicesInAABBox(const AABBox<float> &, std::vector<std::size_t> &) const = 0;
+            virtual void findTriangleIndicesHitByRay(const LineSegment3D<float> &, bool, std::vector<std::size_t> &) const = 0;
+            virtual CollisionTriangleShape createTriangleShape(std::size_t) const = 0;
     };
 
 }
@@ -64,6 +64,8 @@ namespace urchin
 
 	AABBox<float> CollisionConeShape::toAABBox(const PhysicsTransform &physicsTransform) const
 	{
+		std::lock_guard<std::mutex> lock(lastAABBoxMutex);
+
 		if(!lastTransform.equals(physicsTransform))
 		{
 			Vector3<float> boxHalfSizes(getRadius(), getRadius(), getRadius());
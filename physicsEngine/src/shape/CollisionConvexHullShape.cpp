@@ -33,6 +33,8 @@ namespace urchin
 			CollisionShape3D(collisionConvexHullShape),
 			convexHullShape(std::exchange(collisionConvexHullShape.convexHullShape, nullptr)),
 			convexHullShapeReduced(std::move(collisionConvexHullShape.convexHullShapeReduced)),
+			pointsWithMargin(std::move(collisionConvexHullShape.pointsWithMargin)),
+			pointsWithoutMargin(std::move(collisionConvexHullShape.pointsWithoutMargin)),
 			minDistanceToCenter(std::exchange(collisionConvexHullShape.minDistanceToCenter, 0.0f)),
 			maxDistanceToCenter(std::exchange(collisionConvexHullShape.maxDistanceToCenter, 0.0f))
 	{
@@ -47,6 +49,7 @@ namespace urchin
 	{
 		initializeDistances();
 		initializeConvexHullReduced();
+		initializePoints();
 	}
 
 	void CollisionConvexHullShape::initializeConvexHullReduced()
@@ -60,6 +63,19 @@ namespace urchin
 		}
 	}
 
+	void CollisionConvexHullShape::initializePoints()
+	{
+		pointsWithMargin = convexHullShape->getPoints();
+		if(convexHullShapeReduced)
+		{
+			pointsWithoutMargin = convexHullShapeReduced->getPoints();
+		}else
+		{ //impossible to compute convex hull without margin => use convex hull with margin and a margin of 0.0
+			assert(getInnerMargin()==0.0f);
+			pointsWithoutMargin = pointsWithMargin;
+		}
+	}
+
 	void CollisionConvexHullShape::initializeDistances()
 	{
 		AABBox<float> aabbox = toAABBox(PhysicsTransform());
@@ -102,6 +118,8 @@ namespace urchin
 
 	AABBox<float> CollisionConvexHullShape::toAABBox(const PhysicsTransform &physicsTransform) const
 	{
+		std::lock_guard<std::mutex> lock(lastAABBoxMutex);
+
 		if(!lastTransform.equals(physicsTransform))
 		{
 			const Quaternion<float> &orientation = physicsTransform.getOrientation();
@@ -131,24 +149,10 @@ namespace urchin
 
 	std::unique_ptr<CollisionConvexObject3D, ObjectDeleter> CollisionConvexHullShape::toConvexObject(const PhysicsTransform &physicsTransform) const
 	{
-		Transform<float> transform = physicsTransform.toTransform();
-        auto convexHullWithMargin = std::shared_ptr<ConvexHull3D<float>>(dynamic_cast<ConvexHull3D<float>*>(convexHullShape->toConvexObject(transform).release()));
-
-        void *memPtr = getObjectsPool()->allocate(sizeof(CollisionConvexHullObject));
-
-		if(!convexHullShapeReduced)
-		{ //impossible to compute convex hull without margin => use convex hull with margin and set a margin of 0.0
-            assert(getInnerMargin()==0.0f);
-            const std::shared_ptr<ConvexHull3D<float>> &convexHullWithoutMargin(convexHullWithMargin);
-
-            auto *collisionObjectPtr = new (memPtr) CollisionConvexHullObject(getInnerMargin(), convexHullWithMargin, convexHullWithoutMargin);
-            return std::unique_ptr<CollisionConvexHullObject, ObjectDeleter>(collisionObjectPtr);
-		}
-
-        auto convexHullWithoutMargin = std::shared_ptr<ConvexHull3D<float>>(dynamic_cast<ConvexHull3D<float>*>(convexHullShapeReduced->toConvexObject(transform).release()));
-
-        auto *collisionObjectPtr = new (memPtr) CollisionConvexHullObject(getInnerMargin(), convexHullWithMargin, convexHullWithoutMargin);
-        return std::unique_ptr<CollisionConvexHullObject, ObjectDeleter>(collisionObjectPtr);
+		void *memPtr = getObjectsPool()->allocate(sizeof(CollisionConvexHullObject));
+		auto *collisionObjectPtr = new (memPtr) CollisionConvexHullObject(getInnerMargin(), &pointsWithMargin, &pointsWithoutMargin,
+				physicsTransform.getPosition(), physicsTransform.getOrientation());
+		return std::unique_ptr<CollisionConvexHullObject, ObjectDeleter>(collisionObjectPtr);
 	}
 
 	Vector3<float> CollisionConvexHullShape::computeLocalInertia(float mass) const
@@ -39,11 +39,16 @@ namespace urchin
 		private:
 			void initialize();
 			void initializeConvexHullReduced();
+			void initializePoints();
 			void initializeDistances();
 
 			ConvexHullShape3D<float> *convexHullShape; //shape including margin
 			std::unique_ptr<ConvexHullShape3D<float>> convexHullShapeReduced; //shape where margin has been subtracted
 
+			//flat copies of the shapes points used for support point computation
+			std::vector<Point3<float>> pointsWithMargin;
+			std::vector<Point3<float>> pointsWithoutMargin;
+
 			float minDistanceToCenter;
 			float maxDistanceToCenter;
 	};
@@ -18,6 +18,8 @@ namespace urchin
 
         unsigned int trianglesShapePoolSize = ConfigService::instance()->getUnsignedIntValue("collisionShape.heightfieldTrianglesPoolSize");
         triangleShapesPool = new FixedSizePool<TriangleShape3D<float>>("triangleShapesPool", sizeof(TriangleShape3D<float>), trianglesShapePoolSize);
+
+        buildHeightRangeTree();
     }
 
     CollisionHeightfieldShape::~CollisionHeightfieldShape()
@@ -93,6 +95,8 @@ namespace urchin
 
     AABBox<float> CollisionHeightfieldShape::toAABBox(const PhysicsTransform &physicsTransform) const
     {
+        std::lock_guard<std::mutex> lock(lastAABBoxMutex);
+
         if(!lastTransform.equals(physicsTransform))
         {
             const Matrix3<float> &orientation = physicsTransform.retrieveOrientationMatrix();
@@ -144,76 +148,328 @@ namespace urchin
         return new CollisionHeightfieldShape(vertices, xLength, zLength);
     }
 
+    void CollisionHeightfieldShape::buildHeightRangeTree()
+    {
+        //level 0: height range of each cell
+        HeightRangeLevel cellLevel;
+        cellLevel.xLength = xLength - 1;
+        cellLevel.zLength = zLength - 1;
+        cellLevel.heightRanges.reserve(cellLevel.xLength * cellLevel.zLength);
+        for(unsigned int z = 0; z < cellLevel.zLength; ++z)
+        {
+            for (unsigned int x = 0; x < cellLevel.xLength; ++x)
+            {
+                auto minMaxY = std::minmax({vertices[x + xLength * z].Y, vertices[x + 1 + xLength * z].Y,
+                                            vertices[x + xLength * (z + 1)].Y, vertices[x + 1 + xLength * (z + 1)].Y});
+                cellLevel.heightRanges.push_back({minMaxY.first, minMaxY.second});
+            }
+        }
+        heightRangeTree.push_back(std::move(cellLevel));
+
+        //upper levels: height range of 2x2 nodes of the previous level
+        while(heightRangeTree.back().xLength > 1 || heightRangeTree.back().zLength > 1)
+        {
+            const HeightRangeLevel &childLevel = heightRangeTree.back();
+            HeightRangeLevel level;
+            level.xLength = (childLevel.xLength + 1) / 2;
+            level.zLength = (childLevel.zLength + 1) / 2;
+            level.heightRanges.reserve(level.xLength * level.zLength);
+            for(unsigned int z = 0; z < level.zLength; ++z)
+            {
+                for (unsigned int x = 0; x < level.xLength; ++x)
+                {
+                    HeightRange heightRange = {std::numeric_limits<float>::max(), -std::numeric_limits<float>::max()};
+                    for(unsigned int childZ = z * 2; childZ < std::min(z * 2 + 2, childLevel.zLength); ++childZ)
+                    {
+                        for(unsigned int childX = x * 2; childX < std::min(x * 2 + 2, childLevel.xLength); ++childX)
+                        {
+                            const HeightRange &childHeightRange = childLevel.heightRanges[childX + childLevel.xLength * childZ];
+                            heightRange.min = std::min(heightRange.min, childHeightRange.min);
+                            heightRange.max = std::max(heightRange.max, childHeightRange.max);
+                        }
+                    }
+                    level.heightRanges.push_back(heightRange);
+                }
+            }
+            heightRangeTree.push_back(std::move(level));
+        }
+    }
+
     const std::vector<CollisionTriangleShape> &CollisionHeightfieldShape::findTrianglesInAABBox(const AABBox<float> &checkAABBox) const
     {
         trianglesInAABBox.clear();
+        triangleIndices.clear();
+
+        findTriangleIndicesInAABBox(checkAABBox, triangleIndices);
+        for(std::size_t triangleIndex : triangleIndices)
+        {
+            createCollisionTriangleShape(triangleIndex);
+        }
+
+        return trianglesInAABBox;
+    }
+
+    /**
+     * Thread-safe version of 'findTrianglesInAABBox' returning triangle indices. A triangle index remains identical as
+     * long as the shape exists: it can be used to identify a triangle across several frames.
+     * @param triangleIndices [out] Indices of triangles in AABBox, sorted in increasing order
+     */
+    void CollisionHeightfieldShape::findTriangleIndicesInAABBox(const AABBox<float> &checkAABBox, std::vector<std::size_t> &triangleIndices) const
+    {
+        auto cellXRange = computeStartEndIndices(checkAABBox.getMin().X, checkAABBox.getMax().X, Axis::X);
+        auto cellZRange = computeStartEndIndices(checkAABBox.getMin().Z, checkAABBox.getMax().Z, Axis::Z);
+        if(cellXRange.first >= cellXRange.second || cellZRange.first >= cellZRange.second)
+        {
+            return;
+        }
+
+        std::size_t firstTriangleIndex = triangleIndices.size();
+        auto rootLevel = static_cast<unsigned int>(heightRangeTree.size() - 1);
+        findTriangleIndicesInNode(rootLevel, 0, 0, cellXRange, cellZRange, checkAABBox.getMin().Y, checkAABBox.getMax().Y, triangleIndices);
 
-        auto vertexXRange = computeStartEndIndices(checkAABBox.getMin().X, checkAABBox.getMax().X, Axis::X);
-        auto vertexZRange = computeStartEndIndices(checkAABBox.getMin().Z, checkAABBox.getMax().Z, Axis::Z);
+        std::sort(triangleIndices.begin() + (long)firstTriangleIndex, triangleIndices.end());
+    }
 
-        for(unsigned int z = vertexZRange.first; z < vertexZRange.second; ++z)
+    /**
+     * Browse the height range tree from the node (nodeX, nodeZ) of the level. Nodes out of the cell ranges or out of
+     * the height range [minY, maxY] are culled with all their children.
+     */
+    void CollisionHeightfieldShape::findTriangleIndicesInNode(unsigned int level, unsigned int nodeX, unsigned int nodeZ, const std::pair<unsigned int, unsigned int> &cellXRange,
+            const std::pair<unsigned int, unsigned int> &cellZRange, float minY, float maxY, std::vector<std::size_t> &triangleIndices) const
+    {
+        const HeightRangeLevel &heightRangeLevel = heightRangeTree[level];
+        const HeightRange &heightRange = heightRangeLevel.heightRanges[nodeX + heightRangeLevel.xLength * nodeZ];
+        if(heightRange.max <= minY || heightRange.min >= maxY)
         {
-            for (unsigned int x = vertexXRange.first; x < vertexXRange.second; ++x)
+            return;
+        }
+
+        if(level == 0)
+        {
+            std::pair<bool, bool> matchHeight = trianglesMatchHeight(nodeX, nodeZ, minY, maxY);
+            std::size_t cellIndex = nodeX + (xLength - 1) * nodeZ;
+            if(matchHeight.first)
+            {
+                triangleIndices.push_back(cellIndex * 2);
+            }
+            if(matchHeight.second)
             {
-                createTrianglesMatchHeight(x, z, checkAABBox.getMin().Y, checkAABBox.getMax().Y);
+                triangleIndices.push_back(cellIndex * 2 + 1);
             }
+            return;
         }
 
-        return trianglesInAABBox;
+        const HeightRangeLevel &childLevel = heightRangeTree[level - 1];
+        unsigned int childCellSize = 1u << (level - 1u); //number of cells covered by a child node on each axis
+        for(unsigned int childZ = nodeZ * 2; childZ < std::min(nodeZ * 2 + 2, childLevel.zLength); ++childZ)
+        {
+            if(childZ * childCellSize >= cellZRange.second || (childZ + 1) * childCellSize <= cellZRange.first)
+            {
+                continue;
+            }
+
+            for(unsigned int childX = nodeX * 2; childX < std::min(nodeX * 2 + 2, childLevel.xLength); ++childX)
+            {
+                if(childX * childCellSize >= cellXRange.second || (childX + 1) * childCellSize <= cellXRange.first)
+                {
+                    continue;
+                }
+
+                findTriangleIndicesInNode(level - 1, childX, childZ, cellXRange, cellZRange, minY, maxY, triangleIndices);
+            }
+        }
+    }
+
+    CollisionTriangleShape CollisionHeightfieldShape::createTriangleShape(std::size_t triangleIndex) const
+    {
+        Point3<float> trianglePoints[3];
+        retrieveTrianglePoints(triangleIndex, trianglePoints);
+
+        return CollisionTriangleShape(trianglePoints);
     }
 
-    const std::vector<CollisionTriangleShape> &CollisionHeightfieldShape::findTrianglesHitByRay(const LineSegment3D<float> &ray) const
+    void CollisionHeightfieldShape::retrieveTrianglePoints(std::size_t triangleIndex, Point3<float> *trianglePoints) const
+    {
+        std::size_t cellIndex = triangleIndex / 2;
+        auto x = static_cast<unsigned int>(cellIndex % (xLength - 1));
+        auto z = static_cast<unsigned int>(cellIndex / (xLength - 1));
+
+        if(triangleIndex % 2 == 0)
+        {
+            trianglePoints[0] = vertices[x + xLength * z]; //far-left
+            trianglePoints[1] = vertices[x + xLength * (z + 1)]; //near-left
+            trianglePoints[2] = vertices[x + 1 + xLength * z]; //far-right
+        }else
+        {
+            trianglePoints[0] = vertices[x + 1 + xLength * z]; //far-right
+            trianglePoints[1] = vertices[x + xLength * (z + 1)]; //near-left
+            trianglePoints[2] = vertices[x + 1 + xLength * (z + 1)]; //near-right
+        }
+    }
+
+    /**
+     * @param closestHitOnly Return only the closest triangle
+     * @return Triangles hit by the ray, sorted from the nearest to the farthest of the ray origin
+     */
+    const std::vector<CollisionTriangleShape> &CollisionHeightfieldShape::findTrianglesHitByRay(const LineSegment3D<float> &ray, bool closestHitOnly) const
     {
         trianglesInAABBox.clear();
+        triangleIndices.clear();
 
-        bool raySameXValues = ray.getA().X == ray.getB().X;
-        bool raySameZValues = ray.getA().Z == ray.getB().Z;
+        findTriangleIndicesHitByRay(ray, closestHitOnly, triangleIndices);
+        for(std::size_t triangleIndex : triangleIndices)
+        {
+            createCollisionTriangleShape(triangleIndex);
+        }
 
-        //2d line equation variables
-        float slopeLineZX = (ray.getB().X - ray.getA().X) / (ray.getB().Z - ray.getA().Z);
-        float slopeLineXY = (ray.getB().Y - ray.getA().Y) / (ray.getB().X - ray.getA().X);
-        float slopeLineZY = (ray.getB().Y - ray.getA().Y) / (ray.getB().Z - ray.getA().Z);
-        float interceptLineZX = ray.getA().X - (slopeLineZX * ray.getA().Z);
-        float interceptLineXY = ray.getA().Y - (slopeLineXY * ray.getA().X);
-        float interceptLineZY = ray.getA().Y - (slopeLineZY * ray.getA().Z);
+        return trianglesInAABBox;
+    }
 
-        float rayMinZ = std::min(ray.getA().Z, ray.getB().Z);
-        float rayMaxZ = std::max(ray.getA().Z, ray.getB().Z);
-        auto vertexZRange = computeStartEndIndices(rayMinZ, rayMaxZ, Axis::Z);
+    /**
+     * Thread-safe version of 'findTrianglesHitByRay' returning triangle indices. Cells crossed by the ray are browsed in
+     * order thanks to a 2D DDA on the X/Z plane and cells whose height range doesn't cross the ray are skipped.
+     * @param closestHitOnly Stop at the first cell containing a hit and return only the closest triangle
+     * @param triangleIndices [out] Indices of triangles hit by the ray, sorted from the nearest to the farthest of the ray origin
+     */
+    void CollisionHeightfieldShape::findTriangleIndicesHitByRay(const LineSegment3D<float> &ray, bool closestHitOnly, std::vector<std::size_t> &triangleIndices) const
+    {
+        const Point3<float> &rayA = ray.getA();
+        Vector3<float> rayDirection = rayA.vector(ray.getB());
+        const HeightRangeLevel &cellLevel = heightRangeTree[0];
+        Point3<float> gridMin(vertices[0].X, 0.0f, vertices[0].Z);
+        Point3<float> gridMax(vertices[xLength - 1].X, 0.0f, vertices[xLength * (zLength - 1)].Z);
+        float cellSizeX = (gridMax.X - gridMin.X) / static_cast<float>(cellLevel.xLength);
+        float cellSizeZ = (gridMax.Z - gridMin.Z) / static_cast<float>(cellLevel.zLength);
+
+        //clip the ray on the grid (parametric values in [0, 1])
+        float tEnter = 0.0f;
+        float tExit = 1.0f;
+        for(unsigned int axis : {0u, 2u})
+        {
+            if(MathAlgorithm::isZero(rayDirection[axis]))
+            {
+                if(rayA[axis] < gridMin[axis] || rayA[axis] > gridMax[axis])
+                {
+                    return;
+                }
+            }else
+            {
+                std::pair<float, float> tAxis = std::minmax((gridMin[axis] - rayA[axis]) / rayDirection[axis], (gridMax[axis] - rayA[axis]) / rayDirection[axis]);
+                tEnter = std::max(tEnter, tAxis.first);
+                tExit = std::min(tExit, tAxis.second);
+            }
+        }
+        if(tEnter > tExit)
+        {
+            return;
+        }
 
-        for(unsigned int z = vertexZRange.first; z < vertexZRange.second; ++z)
+        //2D DDA initialization
+        auto cellX = static_cast<unsigned int>(MathAlgorithm::clamp(static_cast<int>((rayA.X + rayDirection.X * tEnter - gridMin.X) / cellSizeX), 0, (int)cellLevel.xLength - 1));
+        auto cellZ = static_cast<unsigned int>(MathAlgorithm::clamp(static_cast<int>((rayA.Z + rayDirection.Z * tEnter - gridMin.Z) / cellSizeZ), 0, (int)cellLevel.zLength - 1));
+        int stepX = rayDirection.X > 0.0f ? 1 : -1;
+        int stepZ = rayDirection.Z > 0.0f ? 1 : -1;
+        float tDeltaX = MathAlgorithm::isZero(rayDirection.X) ? std::numeric_limits<float>::max() : cellSizeX / std::abs(rayDirection.X);
+        float tDeltaZ = MathAlgorithm::isZero(rayDirection.Z) ? std::numeric_limits<float>::max() : cellSizeZ / std::abs(rayDirection.Z);
+        float tNextX = MathAlgorithm::isZero(rayDirection.X) ? std::numeric_limits<float>::max()
+                : (gridMin.X + static_cast<float>(cellX + (stepX > 0 ? 1 : 0)) * cellSizeX - rayA.X) / rayDirection.X;
+        float tNextZ = MathAlgorithm::isZero(rayDirection.Z) ? std::numeric_limits<float>::max()
+                : (gridMin.Z + static_cast<float>(cellZ + (stepZ > 0 ? 1 : 0)) * cellSizeZ - rayA.Z) / rayDirection.Z;
+
+        float tCellEnter = tEnter;
+        while(true)
         {
-            float zStartValue = vertices[xLength * z].Z;
-            float zEndValue = vertices[xLength * (z + 1)].Z;
-            float xFirstValue = raySameZValues ? ray.getA().X : slopeLineZX * zStartValue + interceptLineZX;
-            float xSecondValue = raySameZValues ? ray.getB().X : slopeLineZX * zEndValue + interceptLineZX;
-            auto xMinMaxValue = std::minmax(xFirstValue, xSecondValue);
+            float tCellExit = std::min(std::min(tNextX, tNextZ), tExit);
 
-            auto vertexXRange = computeStartEndIndices(xMinMaxValue.first, xMinMaxValue.second, Axis::X);
+            const HeightRange &cellHeightRange = cellLevel.heightRanges[cellX + cellLevel.xLength * cellZ];
+            std::pair<float, float> rayMinMaxY = std::minmax(rayA.Y + rayDirection.Y * tCellEnter, rayA.Y + rayDirection.Y * tCellExit);
+            if(rayMinMaxY.first <= cellHeightRange.max && rayMinMaxY.second >= cellHeightRange.min)
+            {
+                std::size_t cellIndex = cellX + cellLevel.xLength * cellZ;
+                float hitT[2];
+                bool hit[2] = {rayHitTriangle(rayA, rayDirection, cellIndex * 2, hitT[0]), rayHitTriangle(rayA, rayDirection, cellIndex * 2 + 1, hitT[1])};
+                unsigned int firstTriangle = (hit[0] && hit[1] && hitT[1] < hitT[0]) ? 1 : 0;
+                for(unsigned int i = 0; i < 2; ++i)
+                {
+                    unsigned int triangle = (firstTriangle + i) % 2;
+                    if(hit[triangle])
+                    {
+                        triangleIndices.push_back(cellIndex * 2 + triangle);
+                        if(closestHitOnly)
+                        {
+                            return;
+                        }
+                    }
+                }
+            }
 
-            for (unsigned int x = vertexXRange.first; x < vertexXRange.second; ++x)
+            if(tCellExit >= tExit)
             {
-                //compute min and max Y values based on X value (don't give satisfying result when ray is parallel to Z axis)
-                float xCurrentValue = vertices[x].X;
-                float xNextValue = vertices[x + 1].X;
-                float yFirstValue1 = raySameXValues ? ray.getA().Y : slopeLineXY * xCurrentValue + interceptLineXY;
-                float ySecondValue1 = raySameXValues ? ray.getB().Y : slopeLineXY * xNextValue + interceptLineXY;
-                auto yMinMaxValue1 = std::minmax(yFirstValue1, ySecondValue1);
-
-                //compute min and max Y values based on Z value (don't give satisfying result when ray is parallel to X axis)
-                float yFirstValue2 = raySameZValues ? ray.getA().Y : slopeLineZY * zStartValue + interceptLineZY;
-                float ySecondValue2 = raySameZValues ? ray.getB().Y : slopeLineZY * zEndValue + interceptLineZY;
-                auto yMinMaxValue2 = std::minmax(yFirstValue2, ySecondValue2);
-
-                //combine both results to get a more satisfying result
-                float rayMinY = std::max(yMinMaxValue1.first, yMinMaxValue2.first);
-                float rayMaxY = std::min(yMinMaxValue1.second, yMinMaxValue2.second);
-
-                createTrianglesMatchHeight(x, z, rayMinY, rayMaxY);
+                break;
+            }
+
+            if(tNextX < tNextZ)
+            {
+                if((stepX < 0 && cellX == 0) || (stepX > 0 && cellX + 1 >= cellLevel.xLength))
+                {
+                    break;
+                }
+                cellX = static_cast<unsigned int>(static_cast<int>(cellX) + stepX);
+                tCellEnter = tNextX;
+                tNextX += tDeltaX;
+            }else
+            {
+                if((stepZ < 0 && cellZ == 0) || (stepZ > 0 && cellZ + 1 >= cellLevel.zLength))
+                {
+                    break;
+                }
+                cellZ = static_cast<unsigned int>(static_cast<int>(cellZ) + stepZ);
+                tCellEnter = tNextZ;
+                tNextZ += tDeltaZ;
             }
         }
+    }
 
-        return trianglesInAABBox;
+    /**
+     * Ray/triangle intersection test (Moller-Trumbore) with a small tolerance: the test is only used to discard triangles
+     * before the exact collision test.
+     * @param t [out] Parametric value of the hit point on the ray
+     */
+    bool CollisionHeightfieldShape::rayHitTriangle(const Point3<float> &rayA, const Vector3<float> &rayDirection, std::size_t triangleIndex, float &t) const
+    {
+        constexpr float TOLERANCE = 0.001f;
+
+        Point3<float> trianglePoints[3];
+        retrieveTrianglePoints(triangleIndex, trianglePoints);
+        Vector3<float> edge1 = trianglePoints[0].vector(trianglePoints[1]);
+        Vector3<float> edge2 = trianglePoints[0].vector(trianglePoints[2]);
+
+        Vector3<float> tVector = trianglePoints[0].vector(rayA);
+        Vector3<float> pVector = rayDirection.crossProduct(edge2);
+        float determinant = edge1.dotProduct(pVector);
+        if(std::abs(determinant) < std::numeric_limits<float>::epsilon())
+        { //ray parallel to triangle: keep triangle for exact collision test only when ray lies in triangle plane
+            Vector3<float> triangleNormal = edge1.crossProduct(edge2);
+            t = 0.0f;
+            return std::abs(triangleNormal.dotProduct(tVector)) <= TOLERANCE * triangleNormal.length();
+        }
+        float inverseDeterminant = 1.0f / determinant;
+
+        float u = tVector.dotProduct(pVector) * inverseDeterminant;
+        if(u < -TOLERANCE || u > 1.0f + TOLERANCE)
+        {
+            return false;
+        }
+
+        Vector3<float> qVector = tVector.crossProduct(edge1);
+        float v = rayDirection.dotProduct(qVector) * inverseDeterminant;
+        if(v < -TOLERANCE || u + v > 1.0f + TOLERANCE)
+        {
+            return false;
+        }
+
+        t = edge2.dotProduct(qVector) * inverseDeterminant;
+        return t >= -TOLERANCE && t <= 1.0f + TOLERANCE;
     }
 
     /**
@@ -235,31 +491,30 @@ namespace urchin
         return std::make_pair(startVertex, endVertex);
     }
 
-    void CollisionHeightfieldShape::createTrianglesMatchHeight(unsigned int x, unsigned int z, float minY, float maxY) const
+    /**
+     * @return Indicates for both triangles of the cell (x, z) if they match the height range
+     */
+    std::pair<bool, bool> CollisionHeightfieldShape::trianglesMatchHeight(unsigned int x, unsigned int z, float minY, float maxY) const
     {
-        Point3<float> point1 = vertices[x + xLength * z]; //far-left
-        Point3<float> point2 = vertices[x + 1 + xLength * z]; //far-right
-        Point3<float> point3 = vertices[x + xLength * (z + 1)]; //near-left
-        Point3<float> point4 = vertices[x + 1 + xLength * (z + 1)]; //near-right
+        float point1Y = vertices[x + xLength * z].Y; //far-left
+        float point2Y = vertices[x + 1 + xLength * z].Y; //far-right
+        float point3Y = vertices[x + xLength * (z + 1)].Y; //near-left
+        float point4Y = vertices[x + 1 + xLength * (z + 1)].Y; //near-right
 
-        bool hasDiagonalPointAbove = point2.Y > minY || point3.Y > minY;
-        bool hasDiagonalPointBelow = point2.Y < maxY || point3.Y < maxY;
+        bool hasDiagonalPointAbove = point2Y > minY || point3Y > minY;
+        bool hasDiagonalPointBelow = point2Y < maxY || point3Y < maxY;
 
-        if( (point1.Y > minY || hasDiagonalPointAbove) && (point1.Y < maxY || hasDiagonalPointBelow) )
-        {
-            createCollisionTriangleShape(point1, point3, point2);
-        }
-
-        if( (point4.Y > minY || hasDiagonalPointAbove) && (point4.Y < maxY || hasDiagonalPointBelow) )
-        {
-            createCollisionTriangleShape(point2, point3, point4);
-        }
+        return std::make_pair((point1Y > minY || hasDiagonalPointAbove) && (point1Y < maxY || hasDiagonalPointBelow),
+                (point4Y > minY || hasDiagonalPointAbove) && (point4Y < maxY || hasDiagonalPointBelow));
     }
 
-    void CollisionHeightfieldShape::createCollisionTriangleShape(const Point3<float> &p1, const Point3<float> &p2, const Point3<float> &p3) const
+    void CollisionHeightfieldShape::createCollisionTriangleShape(std::size_t triangleIndex) const
     {
+        Point3<float> trianglePoints[3];
+        retrieveTrianglePoints(triangleIndex, trianglePoints);
+
         void *shapeMemPtr = triangleShapesPool->allocate(sizeof(TriangleShape3D<float>));
-        trianglesInAABBox.emplace_back(CollisionTriangleShape(new (shapeMemPtr) TriangleShape3D<float>(p1, p2, p3), triangleShapesPool));
+        trianglesInAABBox.emplace_back(CollisionTriangleShape(new (shapeMemPtr) TriangleShape3D<float>(trianglePoints), triangleShapesPool));
     }
 
 }
@@ -39,22 +39,46 @@ namespace urchin
             CollisionShape3D *clone() const override;
 
             const std::vector<CollisionTriangleShape> &findTrianglesInAABBox(const AABBox<float> &) const override;
-            const std::vector<CollisionTriangleShape> &findTrianglesHitByRay(const LineSegment3D<float> &) const override;
+            const std::vector<CollisionTriangleShape> &findTrianglesHitByRay(const LineSegment3D<float> &, bool) const override;
+
+            void findTriangleIndicesInAABBox(const AABBox<float> &, std::vector<std::size_t> &) const override;
+            void findTriangleIndicesHitByRay(const LineSegment3D<float> &, bool, std::vector<std::size_t> &) const override;
+            CollisionTriangleShape createTriangleShape(std::size_t) const override;
 
         private:
             enum Axis{X, Z};
 
+            struct HeightRange
+            {
+                float min;
+                float max;
+            };
+            struct HeightRangeLevel
+            {
+                unsigned int xLength;
+                unsigned int zLength;
+                std::vector<HeightRange> heightRanges;
+            };
+
             std::unique_ptr<BoxShape<float>> buildLocalAABBox() const;
+            void buildHeightRangeTree();
+
             std::pair<unsigned int, unsigned int> computeStartEndIndices(float, float, Axis) const;
-            void createTrianglesMatchHeight(unsigned int, unsigned int, float, float) const;
-            void createCollisionTriangleShape(const Point3<float> &, const Point3<float> &, const Point3<float> &) const;
+            void findTriangleIndicesInNode(unsigned int, unsigned int, unsigned int, const std::pair<unsigned int, unsigned int> &,
+                    const std::pair<unsigned int, unsigned int> &, float, float, std::vector<std::size_t> &) const;
+            std::pair<bool, bool> trianglesMatchHeight(unsigned int, unsigned int, float, float) const;
+            void retrieveTrianglePoints(std::size_t, Point3<float> *) const;
+            bool rayHitTriangle(const Point3<float> &, const Vector3<float> &, std::size_t, float &) const;
+            void createCollisionTriangleShape(std::size_t) const;
 
             std::vector<Point3<float>> vertices;
             unsigned int xLength;
             unsigned int zLength;
 
             std::unique_ptr<BoxShape<float>> localAABBox;
-            
+            std::vector<HeightRangeLevel> heightRangeTree; //min-max height tree: level 0 contains the height range of each cell
+
+            mutable std::vector<std::size_t> triangleIndices;
             mutable std::vector<CollisionTriangleShape> trianglesInAABBox;
             FixedSizePool<TriangleShape3D<float>> *triangleShapesPool;
     };
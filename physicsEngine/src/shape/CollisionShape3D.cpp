@@ -16,6 +16,8 @@ namespace urchin
 	std::vector<CollisionShape3D::ShapeType> CollisionShape3D::CONCAVE_SHAPES = {CollisionShape3D::HEIGHTFIELD_SHAPE};
 	std::vector<CollisionShape3D::ShapeType> CollisionShape3D::COMPOUND_SHAPES = {CollisionShape3D::COMPOUND_SHAPE};
 	std::vector<CollisionShape3D::ShapeType> CollisionShape3D::SPHERE_SHAPES = {CollisionShape3D::SPHERE_SHAPE};
+	std::vector<CollisionShape3D::ShapeType> CollisionShape3D::BOX_SHAPES = {CollisionShape3D::BOX_SHAPE};
+	std::vector<CollisionShape3D::ShapeType> CollisionShape3D::CAPSULE_SHAPES = {CollisionShape3D::CAPSULE_SHAPE};
 
 	CollisionShape3D::CollisionShape3D() :
 			innerMargin(EagerPropertyLoader::instance()->getCollisionShapeInnerMargin()),
@@ -31,6 +33,13 @@ namespace urchin
 		lastTransform.setPosition(Point3<float>(std::numeric_limits<float>::max(), std::numeric_limits<float>::max(), std::numeric_limits<float>::max()));
 	}
 
+	CollisionShape3D::CollisionShape3D(const CollisionShape3D &collisionShape) :
+			innerMargin(collisionShape.innerMargin),
+			initialInnerMargin(collisionShape.initialInnerMargin)
+	{
+		lastTransform.setPosition(Point3<float>(std::numeric_limits<float>::max(), std::numeric_limits<float>::max(), std::numeric_limits<float>::max()));
+	}
+
 	FixedSizePool<CollisionConvexObject3D> *CollisionShape3D::getObjectsPool() const
 	{
 		return CollisionConvexObjectPool::instance()->getObjectsPool();
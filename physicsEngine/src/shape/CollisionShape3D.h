@@ -20,7 +20,7 @@ namespace urchin
 		public:
 			CollisionShape3D();
 			explicit CollisionShape3D(float);
-			CollisionShape3D(const CollisionShape3D &) = default;
+			CollisionShape3D(const CollisionShape3D &);
 			virtual ~CollisionShape3D() = default;
 
 			enum ShapeType
@@ -40,7 +40,7 @@ namespace urchin
 
 				SHAPE_MAX
 			};
-            static std::vector<ShapeType> CONVEX_SHAPES, CONCAVE_SHAPES, COMPOUND_SHAPES, SPHERE_SHAPES;
+            static std::vector<ShapeType> CONVEX_SHAPES, CONCAVE_SHAPES, COMPOUND_SHAPES, SPHERE_SHAPES, BOX_SHAPES, CAPSULE_SHAPES;
 
 			float getInnerMargin() const;
 			virtual CollisionShape3D::ShapeType getShapeType() const = 0;
@@ -68,6 +68,7 @@ namespace urchin
 
 			mutable AABBox<float> lastAABBox;
 			mutable PhysicsTransform lastTransform;
+			mutable std::mutex lastAABBoxMutex; //AABBox cache can be accessed by several narrow phase threads when shape is shared between bodies
 
 		private:
 			float innerMargin;
@@ -0,0 +1,135 @@
+#include <cstring>
+#include <stdexcept>
+#include <string>
+
+#include "snapshot/PhysicsWorldSnapshot.h"
+
+namespace urchin
+{
+
+	/**
+	 * Removes the data of the snapshot. Memory is kept for the next capture.
+	 */
+	void PhysicsWorldSnapshot::clear()
+	{
+		data.clear();
+	}
+
+	const std::vector<char> &PhysicsWorldSnapshot::getData() const
+	{
+		return data;
+	}
+
+	/**
+	 * @param data Data of a snapshot previously captured (e.g.: received from network)
+	 */
+	void PhysicsWorldSnapshot::setData(const std::vector<char> &data)
+	{
+		this->data = data;
+	}
+
+	void PhysicsWorldSnapshot::writeUnsignedInt(std::uint32_t value)
+	{
+		write(&value, sizeof(value));
+	}
+
+	void PhysicsWorldSnapshot::writeBool(bool value)
+	{
+		data.push_back(value ? 1 : 0);
+	}
+
+	void PhysicsWorldSnapshot::writeFloat(float value)
+	{
+		write(&value, sizeof(value));
+	}
+
+	void PhysicsWorldSnapshot::writeVector(const Vector3<float> &vector)
+	{
+		writeFloat(vector.X);
+		writeFloat(vector.Y);
+		writeFloat(vector.Z);
+	}
+
+	void PhysicsWorldSnapshot::writePoint(const Point3<float> &point)
+	{
+		writeFloat(point.X);
+		writeFloat(point.Y);
+		writeFloat(point.Z);
+	}
+
+	void PhysicsWorldSnapshot::writeQuaternion(const Quaternion<float> &quaternion)
+	{
+		writeFloat(quaternion.X);
+		writeFloat(quaternion.Y);
+		writeFloat(quaternion.Z);
+		writeFloat(quaternion.W);
+	}
+
+	/**
+	 * @param offset [in,out] Offset of the value to read. Offset is moved after the read value.
+	 */
+	std::uint32_t PhysicsWorldSnapshot::readUnsignedInt(std::size_t &offset) const
+	{
+		std::uint32_t value;
+		read(&value, sizeof(value), offset);
+		return value;
+	}
+
+	bool PhysicsWorldSnapshot::readBool(std::size_t &offset) const
+	{
+		char value;
+		read(&value, sizeof(value), offset);
+		return value!=0;
+	}
+
+	float PhysicsWorldSnapshot::readFloat(std::size_t &offset) const
+	{
+		float value;
+		read(&value, sizeof(value), offset);
+		return value;
+	}
+
+	Vector3<float> PhysicsWorldSnapshot::readVector(std::size_t &offset) const
+	{
+		float x = readFloat(offset);
+		float y = readFloat(offset);
+		float z = readFloat(offset);
+		return Vector3<float>(x, y, z);
+	}
+
+	Point3<float> PhysicsWorldSnapshot::readPoint(std::size_t &offset) const
+	{
+		float x = readFloat(offset);
+		float y = readFloat(offset);
+		float z = readFloat(offset);
+		return Point3<float>(x, y, z);
+	}
+
+	Quaternion<float> PhysicsWorldSnapshot::readQuaternion(std::size_t &offset) const
+	{
+		float x = readFloat(offset);
+		float y = readFloat(offset);
+		float z = readFloat(offset);
+		float w = readFloat(offset);
+		return Quaternion<float>(x, y, z, w);
+	}
+
+	void PhysicsWorldSnapshot::write(const void *value, std::size_t size)
+	{
+		std::size_t offset = data.size();
+		data.resize(offset + size);
+		std::memcpy(&data[offset], value, size);
+	}
+
+	void PhysicsWorldSnapshot::read(void *value, std::size_t size, std::size_t &offset) const
+	{
+		if(offset + size > data.size())
+		{
+			throw std::out_of_range("Physics world snapshot data are truncated at offset: " + std::to_string(offset) + ".");
+		}
+
+		std::memcpy(value, &data[offset], size);
+		offset += size;
+	}
+
+}
@@ -0,0 +1,45 @@
+#ifndef URCHINENGINE_PHYSICSWORLDSNAPSHOT_H
+#define URCHINENGINE_PHYSICSWORLDSNAPSHOT_H
+
+#include <vector>
+#include <cstdint>
+#include "UrchinCommon.h"
+
+namespace urchin
+{
+
+	/**
+	* Compact binary snapshot of a physics world: bodies state (transform, velocities, active state) and persistent
+	* contact points. Values are written one after the other in a byte buffer which is kept between two captures.
+	*/
+	class PhysicsWorldSnapshot
+	{
+		public:
+			void clear();
+			const std::vector<char> &getData() const;
+			void setData(const std::vector<char> &);
+
+			void writeUnsignedInt(std::uint32_t);
+			void writeBool(bool);
+			void writeFloat(float);
+			void writeVector(const Vector3<float> &);
+			void writePoint(const Point3<float> &);
+			void writeQuaternion(const Quaternion<float> &);
+
+			std::uint32_t readUnsignedInt(std::size_t &) const;
+			bool readBool(std::size_t &) const;
+			float readFloat(std::size_t &) const;
+			Vector3<float> readVector(std::size_t &) const;
+			Point3<float> readPoint(std::size_t &) const;
+			Quaternion<float> readQuaternion(std::size_t &) const;
+
+		private:
+			void write(const void *, std::size_t);
+			void read(void *, std::size_t, std::size_t &) const;
+
+			std::vector<char> data;
+	};
+
+}
+
+#endif
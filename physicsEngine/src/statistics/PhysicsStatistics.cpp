@@ -0,0 +1,57 @@
+#include <algorithm>
+
+#include "statistics/PhysicsStatistics.h"
+
+namespace urchin
+{
+
+	PhysicsStatistics::PhysicsStatistics()
+	{
+		reset();
+	}
+
+	void PhysicsStatistics::reset()
+	{
+		bodies = 0;
+		awakeBodies = 0;
+		overlappingPairs = 0;
+		std::fill(std::begin(narrowPhaseTests), std::end(narrowPhaseTests), 0);
+		std::fill(std::begin(gjkIterations), std::end(gjkIterations), 0);
+		std::fill(std::begin(epaIterations), std::end(epaIterations), 0);
+		ccdTests = 0;
+		contactsSolved = 0;
+		algorithmPool = PoolStatistics();
+	}
+
+	/**
+	 * Adds the counters of the narrow phase algorithms (tests, iterations and CCD tests) collected in another thread
+	 */
+	void PhysicsStatistics::merge(const PhysicsStatistics &statistics)
+	{
+		for(unsigned int i=0; i<CollisionAlgorithm::ALGORITHM_TYPE_MAX; ++i)
+		{
+			narrowPhaseTests[i] += statistics.narrowPhaseTests[i];
+		}
+		for(unsigned int i=0; i<ITERATION_HISTOGRAM_SIZE; ++i)
+		{
+			gjkIterations[i] += statistics.gjkIterations[i];
+			epaIterations[i] += statistics.epaIterations[i];
+		}
+		ccdTests += statistics.ccdTests;
+	}
+
+	/**
+	 * @return Bucket of the iteration histograms for the number of iterations
+	 */
+	unsigned int PhysicsStatistics::toIterationHistogramBucket(unsigned int iterations)
+	{
+		unsigned int bucket = 0;
+		while(iterations > 0 && bucket < ITERATION_HISTOGRAM_SIZE - 1)
+		{
+			iterations >>= 1;
+			bucket++;
+		}
+		return bucket;
+	}
+
+}
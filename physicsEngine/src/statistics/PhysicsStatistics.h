@@ -0,0 +1,37 @@
+#ifndef URCHINENGINE_PHYSICSSTATISTICS_H
+#define URCHINENGINE_PHYSICSSTATISTICS_H
+
+#include "collision/narrowphase/algorithm/CollisionAlgorithm.h"
+#include "utils/pool/FixedSizePool.h"
+
+namespace urchin
+{
+
+	/**
+	* Counters of one physics step. Iteration histograms count the processes by number of iterations: bucket 0 for no
+	* iteration, bucket n for [2^(n-1), 2^n) iterations and the last bucket for the remaining processes.
+	*/
+	struct PhysicsStatistics
+	{
+		static const unsigned int ITERATION_HISTOGRAM_SIZE = 8;
+
+		PhysicsStatistics();
+
+		void reset();
+		void merge(const PhysicsStatistics &);
+		static unsigned int toIterationHistogramBucket(unsigned int);
+
+		unsigned int bodies; //number of bodies in the world
+		unsigned int awakeBodies; //number of active bodies at the end of the step
+		unsigned int overlappingPairs; //number of pairs of bodies provided by the broad phase
+		unsigned int narrowPhaseTests[CollisionAlgorithm::ALGORITHM_TYPE_MAX]; //number of processes by collision algorithm type (sub algorithms of compound and concave shapes included)
+		unsigned int gjkIterations[ITERATION_HISTOGRAM_SIZE]; //histogram of GJK processes
+		unsigned int epaIterations[ITERATION_HISTOGRAM_SIZE]; //histogram of EPA processes
+		unsigned int ccdTests; //number of time of impact computations for the fast moving bodies
+		unsigned int contactsSolved; //number of contact points solved by the constraint solver
+		PoolStatistics algorithmPool; //usage of the collision algorithms pool
+	};
+
+}
+
+#endif
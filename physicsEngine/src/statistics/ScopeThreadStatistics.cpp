@@ -0,0 +1,31 @@
+#include "statistics/ScopeThreadStatistics.h"
+
+namespace urchin
+{
+
+	ScopeThreadStatistics::ScopeThreadStatistics(PhysicsStatistics *statistics) :
+			previousStatistics(threadStatistics())
+	{
+		threadStatistics() = statistics;
+	}
+
+	ScopeThreadStatistics::~ScopeThreadStatistics()
+	{
+		threadStatistics() = previousStatistics;
+	}
+
+	/**
+	 * @return Statistics bound to the current thread or null if none
+	 */
+	PhysicsStatistics *ScopeThreadStatistics::current()
+	{
+		return threadStatistics();
+	}
+
+	PhysicsStatistics *&ScopeThreadStatistics::threadStatistics()
+	{
+		static thread_local PhysicsStatistics *statistics = nullptr;
+		return statistics;
+	}
+
+}
@@ -0,0 +1,30 @@
+#ifndef URCHINENGINE_SCOPETHREADSTATISTICS_H
+#define URCHINENGINE_SCOPETHREADSTATISTICS_H
+
+#include "statistics/PhysicsStatistics.h"
+
+namespace urchin
+{
+
+	/**
+	* Bind the statistics to the current thread during the scope: the narrow phase algorithms processed by the thread record
+	* their counters in the bound statistics. Algorithms processed outside a scope (e.g.: ray tests from the user thread)
+	* don't record anything.
+	*/
+	class ScopeThreadStatistics
+	{
+		public:
+			explicit ScopeThreadStatistics(PhysicsStatistics *);
+			~ScopeThreadStatistics();
+
+			static PhysicsStatistics *current();
+
+		private:
+			static PhysicsStatistics *&threadStatistics();
+
+			PhysicsStatistics *previousStatistics;
+	};
+
+}
+
+#endif
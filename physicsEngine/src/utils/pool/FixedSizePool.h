@@ -2,13 +2,19 @@
 #define URCHINENGINE_FIXEDSIZEPOOL_H
 
 #include <cassert>
-#include <sstream>
 #include <string>
 #include "UrchinCommon.h"
 
 namespace urchin
 {
 
+	struct PoolStatistics
+	{
+		unsigned int maxElements; //number of elements pre-allocated by the pool
+		unsigned int highWaterMark; //maximum number of elements taken from the pool at the same time
+		unsigned int overflowCount; //number of allocations performed outside the pool because the pool was full
+	};
+
 	/**
 	* Pool which allocate a fixed size of memory defined in constructor argument. This pool offers high performance until the maximum
 	* elements defined in constructor is not reached. Once maximum number of element reached, the performance strongly decrease.
@@ -22,9 +28,16 @@ namespace urchin
 			virtual void* allocate(unsigned int);
 			virtual void free(BaseType *ptr);
 
-		private:
-			void logPoolIsFull();
+			virtual PoolStatistics getStatistics() const;
+
+		protected:
+			void checkAllocationSize(unsigned int) const;
+			bool isInPool(const void *) const;
+			unsigned int takeFreeElements(void **, unsigned int);
+			void giveBackFreeElements(void *const *, unsigned int);
+			void *allocateOutsidePool();
 
+		private:
 			std::string poolName;
 			unsigned int maxElementSize;
 			unsigned int maxElements;
@@ -33,7 +46,8 @@ namespace urchin
 			unsigned char* pool;
 			void* firstFree;
 
-			bool fullPoolLogged;
+			unsigned int highWaterMark;
+			unsigned int overflowCount;
 	};
 
 	#include "FixedSizePool.inl"
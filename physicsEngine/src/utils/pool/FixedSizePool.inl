@@ -9,7 +9,8 @@ template<class BaseType> FixedSizePool<BaseType>::FixedSizePool(const std::strin
 		maxElementSize(maxElementSize),
 		maxElements(maxElements),
 		freeCount(maxElements),
-		fullPoolLogged(false)
+		highWaterMark(0),
+		overflowCount(0)
 {
 	//create pool
 	pool = static_cast<unsigned char *>(operator new(this->maxElementSize * this->maxElements));
@@ -41,23 +42,16 @@ template<class BaseType> FixedSizePool<BaseType>::~FixedSizePool()
  */
 template<class BaseType> void* FixedSizePool<BaseType>::allocate(unsigned int size)
 {
-	if(size > maxElementSize)
-	{
-		throw std::runtime_error("Fixed size pool '" + poolName + "' cannot allocate " + std::to_string(size) + " bytes because max allowed allocation is " + std::to_string(maxElementSize) + " bytes");
-	}
+	checkAllocationSize(size);
 
-	if(freeCount!=0)
+	void* result;
+	if(takeFreeElements(&result, 1) != 0)
 	{ //pool is not full
-		void* result = firstFree;
-		firstFree = *(void**)firstFree;
-		--freeCount;
-
 		return result;
 	}
-	
+
 	//pool is full: allocate new memory location
-	logPoolIsFull();
-	return operator new(maxElementSize);
+	return allocateOutsidePool();
 }
 
 /**
@@ -66,31 +60,74 @@ template<class BaseType> void* FixedSizePool<BaseType>::allocate(unsigned int si
  */
 template<class BaseType> void FixedSizePool<BaseType>::free(BaseType *ptr)
 {
-	if (((unsigned char*)ptr >= pool && (unsigned char*)ptr < pool + maxElementSize*maxElements))
+	if (isInPool(ptr))
 	{ //ptr is in the pool
 		ptr->~BaseType();
-		
-		*(void**)ptr = firstFree;
-		firstFree = ptr;
-		++freeCount;
+
+		void *freeElement = ptr;
+		giveBackFreeElements(&freeElement, 1);
 	}else
 	{
 		delete ptr;
 	}
 }
 
-template<class BaseType> void FixedSizePool<BaseType>::logPoolIsFull()
+template<class BaseType> PoolStatistics FixedSizePool<BaseType>::getStatistics() const
 {
-	if(!fullPoolLogged)
+	PoolStatistics statistics{};
+	statistics.maxElements = maxElements;
+	statistics.highWaterMark = highWaterMark;
+	statistics.overflowCount = overflowCount;
+	return statistics;
+}
+
+template<class BaseType> void FixedSizePool<BaseType>::checkAllocationSize(unsigned int size) const
+{
+	if(size > maxElementSize)
 	{
-		std::stringstream logStream;
-		logStream << "Pool is full of elements." << std::endl;
-        logStream << " - Pool name: " << poolName << std::endl;
-		logStream << " - Element size: " << maxElementSize << std::endl;
-		logStream << " - Maximum elements: " << maxElements;
-		Logger::logger().logWarning(logStream.str());
+		throw std::runtime_error("Fixed size pool '" + poolName + "' cannot allocate " + std::to_string(size) + " bytes because max allowed allocation is " + std::to_string(maxElementSize) + " bytes");
+	}
+}
 
-		fullPoolLogged = true;
+template<class BaseType> bool FixedSizePool<BaseType>::isInPool(const void *ptr) const
+{
+	return (const unsigned char*)ptr >= pool && (const unsigned char*)ptr < pool + maxElementSize*maxElements;
+}
+
+/**
+ * Take free locations from the pool. Taken locations are accounted as used for the pool statistics.
+ * @param freeElements [out] Free locations taken from the pool
+ * @return Number of free locations taken: less than the requested number when the pool becomes full
+ */
+template<class BaseType> unsigned int FixedSizePool<BaseType>::takeFreeElements(void **freeElements, unsigned int requestedCount)
+{
+	unsigned int takenCount = 0;
+	while(takenCount < requestedCount && freeCount != 0)
+	{
+		freeElements[takenCount++] = firstFree;
+		firstFree = *(void**)firstFree;
+		--freeCount;
+	}
+
+	highWaterMark = std::max(highWaterMark, maxElements - freeCount);
+	return takenCount;
+}
+
+/**
+ * Give back free locations to the pool. The elements stored in these locations must be already destroyed.
+ */
+template<class BaseType> void FixedSizePool<BaseType>::giveBackFreeElements(void *const *freeElements, unsigned int count)
+{
+	for(unsigned int i=0; i<count; ++i)
+	{
+		*(void**)freeElements[i] = firstFree;
+		firstFree = freeElements[i];
 	}
+	freeCount += count;
 }
 
+template<class BaseType> void *FixedSizePool<BaseType>::allocateOutsidePool()
+{
+	++overflowCount;
+	return operator new(maxElementSize);
+}
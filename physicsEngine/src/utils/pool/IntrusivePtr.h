@@ -0,0 +1,41 @@
+#ifndef URCHINENGINE_INTRUSIVEPTR_H
+#define URCHINENGINE_INTRUSIVEPTR_H
+
+#include <cstddef>
+
+namespace urchin
+{
+
+	/**
+	* Smart pointer on an object holding its own reference counter. Unlike the shared pointer, no control block is allocated.
+	* The pointed object must provide the methods 'addReference' and 'releaseReference'. The object is responsible to destroy
+	* itself when its last reference is released.
+	*/
+	template<class T> class IntrusivePtr
+	{
+		public:
+			IntrusivePtr();
+			IntrusivePtr(std::nullptr_t);
+			explicit IntrusivePtr(T *);
+			IntrusivePtr(const IntrusivePtr<T> &);
+			IntrusivePtr(IntrusivePtr<T> &&) noexcept;
+			~IntrusivePtr();
+
+			IntrusivePtr<T> &operator=(const IntrusivePtr<T> &);
+			IntrusivePtr<T> &operator=(IntrusivePtr<T> &&) noexcept;
+
+			void reset();
+			T *get() const;
+			T *operator->() const;
+			T &operator*() const;
+			explicit operator bool() const;
+
+		private:
+			T *ptr;
+	};
+
+	#include "IntrusivePtr.inl"
+
+}
+
+#endif
@@ -0,0 +1,92 @@
+template<class T> IntrusivePtr<T>::IntrusivePtr() :
+		ptr(nullptr)
+{
+
+}
+
+template<class T> IntrusivePtr<T>::IntrusivePtr(std::nullptr_t) :
+		ptr(nullptr)
+{
+
+}
+
+template<class T> IntrusivePtr<T>::IntrusivePtr(T *ptr) :
+		ptr(ptr)
+{
+	if(ptr)
+	{
+		ptr->addReference();
+	}
+}
+
+template<class T> IntrusivePtr<T>::IntrusivePtr(const IntrusivePtr<T> &intrusivePtr) :
+		ptr(intrusivePtr.ptr)
+{
+	if(ptr)
+	{
+		ptr->addReference();
+	}
+}
+
+template<class T> IntrusivePtr<T>::IntrusivePtr(IntrusivePtr<T> &&intrusivePtr) noexcept :
+		ptr(intrusivePtr.ptr)
+{
+	intrusivePtr.ptr = nullptr;
+}
+
+template<class T> IntrusivePtr<T>::~IntrusivePtr()
+{
+	reset();
+}
+
+template<class T> IntrusivePtr<T> &IntrusivePtr<T>::operator=(const IntrusivePtr<T> &intrusivePtr)
+{
+	if(intrusivePtr.ptr)
+	{
+		intrusivePtr.ptr->addReference();
+	}
+	reset();
+	ptr = intrusivePtr.ptr;
+	return *this;
+}
+
+template<class T> IntrusivePtr<T> &IntrusivePtr<T>::operator=(IntrusivePtr<T> &&intrusivePtr) noexcept
+{
+	if(this != &intrusivePtr)
+	{
+		reset();
+		ptr = intrusivePtr.ptr;
+		intrusivePtr.ptr = nullptr;
+	}
+	return *this;
+}
+
+template<class T> void IntrusivePtr<T>::reset()
+{
+	if(ptr)
+	{
+		T *releasedPtr = ptr;
+		ptr = nullptr;
+		releasedPtr->releaseReference();
+	}
+}
+
+template<class T> T *IntrusivePtr<T>::get() const
+{
+	return ptr;
+}
+
+template<class T> T *IntrusivePtr<T>::operator->() const
+{
+	return ptr;
+}
+
+template<class T> T &IntrusivePtr<T>::operator*() const
+{
+	return *ptr;
+}
+
+template<class T> IntrusivePtr<T>::operator bool() const
+{
+	return ptr != nullptr;
+}
@@ -1,5 +1,49 @@
+#include <vector>
+
+#include "SyncFixedSizePool.h"
 
 namespace urchin
 {
 
+    namespace
+    {
+        std::mutex threadIndicesMutex;
+        std::vector<unsigned int> freeThreadIndices;
+        unsigned int nextThreadIndex = 0;
+
+        class ThreadIndexHolder
+        {
+            public:
+                ThreadIndexHolder()
+                {
+                    std::lock_guard<std::mutex> lock(threadIndicesMutex);
+                    if(freeThreadIndices.empty())
+                    {
+                        threadIndex = nextThreadIndex++;
+                    }else
+                    {
+                        threadIndex = freeThreadIndices.back();
+                        freeThreadIndices.pop_back();
+                    }
+                }
+
+                ~ThreadIndexHolder()
+                {
+                    std::lock_guard<std::mutex> lock(threadIndicesMutex);
+                    freeThreadIndices.push_back(threadIndex);
+                }
+
+                unsigned int threadIndex;
+        };
+    }
+
+    /**
+     * @return Index of the current thread. Indices are kept small: index of a terminated thread is reused by a new thread.
+     */
+    unsigned int PoolThreadIndex::current()
+    {
+        thread_local ThreadIndexHolder threadIndexHolder;
+        return threadIndexHolder.threadIndex;
+    }
+
 }
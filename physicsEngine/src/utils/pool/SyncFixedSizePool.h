@@ -2,23 +2,49 @@
 #define URCHINENGINE_SYNCFIXEDSIZEPOOL_H
 
 #include <mutex>
+#include <vector>
 
 #include "utils/pool/FixedSizePool.h"
 
 namespace urchin
 {
 
+    /**
+    * Index of the current thread used to select a thread cache. Index is released at thread exit and reused by the next threads.
+    */
+    class PoolThreadIndex
+    {
+        public:
+            static unsigned int current();
+    };
+
+    /**
+    * Pool usable by several threads. Each thread allocates and frees the elements in its own cache of free locations without any
+    * synchronization. Free locations are exchanged with the shared pool by batch: the lock of the shared pool is acquired once per batch.
+    */
     template<class BaseType> class SyncFixedSizePool : public FixedSizePool<BaseType>
     {
         public:
             SyncFixedSizePool(const std::string &, unsigned int, unsigned int);
-            ~SyncFixedSizePool() = default;
+            ~SyncFixedSizePool() override;
 
-            void* allocate(unsigned int);
-            void free(BaseType *ptr);
+            void* allocate(unsigned int) override;
+            void free(BaseType *ptr) override;
+
+            PoolStatistics getStatistics() const override;
 
         private:
-            std::mutex mutex;
+            static const unsigned int MAX_THREAD_CACHES = 32;
+            static const unsigned int BATCH_SIZE = 32;
+
+            struct alignas(64) ThreadCache //aligned on cache line to avoid false sharing between threads
+            {
+                void *freeElements[2 * BATCH_SIZE];
+                unsigned int freeCount = 0;
+            };
+
+            mutable std::mutex mutex;
+            std::vector<ThreadCache> threadCaches;
     };
 
     #include "SyncFixedSizePool.inl"
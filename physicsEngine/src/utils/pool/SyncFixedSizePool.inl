@@ -1,19 +1,78 @@
 template<class BaseType> SyncFixedSizePool<BaseType>::SyncFixedSizePool(const std::string &poolName, unsigned int maxElementSize, unsigned int maxElements) :
-        FixedSizePool<BaseType>(poolName, maxElementSize, maxElements)
+        FixedSizePool<BaseType>(poolName, maxElementSize, maxElements),
+        threadCaches(MAX_THREAD_CACHES)
 {
 
 }
 
+template<class BaseType> SyncFixedSizePool<BaseType>::~SyncFixedSizePool()
+{
+    for(auto &threadCache : threadCaches)
+    {
+        FixedSizePool<BaseType>::giveBackFreeElements(threadCache.freeElements, threadCache.freeCount);
+        threadCache.freeCount = 0;
+    }
+}
+
 template<class BaseType> void* SyncFixedSizePool<BaseType>::allocate(unsigned int size)
 {
-    std::lock_guard<std::mutex> lock(mutex);
+    unsigned int threadIndex = PoolThreadIndex::current();
+    if(threadIndex >= MAX_THREAD_CACHES)
+    { //too many threads: no cache for this thread
+        std::lock_guard<std::mutex> lock(mutex);
+        return FixedSizePool<BaseType>::allocate(size);
+    }
+
+    FixedSizePool<BaseType>::checkAllocationSize(size);
+
+    ThreadCache &threadCache = threadCaches[threadIndex];
+    if(threadCache.freeCount == 0)
+    { //refill the thread cache
+        std::lock_guard<std::mutex> lock(mutex);
+        threadCache.freeCount = FixedSizePool<BaseType>::takeFreeElements(threadCache.freeElements, BATCH_SIZE);
+        if(threadCache.freeCount == 0)
+        { //pool is full: allocate new memory location
+            return FixedSizePool<BaseType>::allocateOutsidePool();
+        }
+    }
 
-    return FixedSizePool<BaseType>::allocate(size);
+    return threadCache.freeElements[--threadCache.freeCount];
 }
 
 template<class BaseType> void SyncFixedSizePool<BaseType>::free(BaseType *ptr)
+{
+    unsigned int threadIndex = PoolThreadIndex::current();
+    if(threadIndex >= MAX_THREAD_CACHES)
+    { //too many threads: no cache for this thread
+        std::lock_guard<std::mutex> lock(mutex);
+        FixedSizePool<BaseType>::free(ptr);
+        return;
+    }
+
+    if(!FixedSizePool<BaseType>::isInPool(ptr))
+    {
+        delete ptr;
+        return;
+    }
+
+    ptr->~BaseType();
+
+    ThreadCache &threadCache = threadCaches[threadIndex];
+    threadCache.freeElements[threadCache.freeCount++] = ptr;
+    if(threadCache.freeCount == 2 * BATCH_SIZE)
+    { //give back a batch to the pool: the remaining batch avoids to refill the cache immediately
+        std::lock_guard<std::mutex> lock(mutex);
+        FixedSizePool<BaseType>::giveBackFreeElements(threadCache.freeElements + BATCH_SIZE, BATCH_SIZE);
+        threadCache.freeCount = BATCH_SIZE;
+    }
+}
+
+/**
+ * @return Statistics of the pool. Free locations kept in the thread caches are accounted as used.
+ */
+template<class BaseType> PoolStatistics SyncFixedSizePool<BaseType>::getStatistics() const
 {
     std::lock_guard<std::mutex> lock(mutex);
 
-    FixedSizePool<BaseType>::free(ptr);
+    return FixedSizePool<BaseType>::getStatistics();
 }
@@ -0,0 +1,56 @@
+#include <thread>
+#include <cmath>
+#include <algorithm>
+
+#include "utils/timer/FixedStepTimer.h"
+
+namespace urchin
+{
+
+	/**
+	 * @param timeStep Time step of the simulation in second
+	 * @param maxSteps Maximum number of steps to process in one time when the simulation is late
+	 */
+	FixedStepTimer::FixedStepTimer(float timeStep, unsigned int maxSteps) :
+			timeStep(timeStep),
+			maxSteps(maxSteps),
+			accumulatedTime(0.0f),
+			previousTime(std::chrono::steady_clock::now())
+	{
+
+	}
+
+	/**
+	 * Waits until at least one step is due.
+	 * @return Number of steps to process. When the simulation is too late, the late steps exceeding the maximum number of
+	 * steps are dropped: this leads to a slow-down of the simulation but each step stays identical.
+	 */
+	unsigned int FixedStepTimer::waitNextSteps()
+	{
+		accumulateElapsedTime();
+		if(accumulatedTime < timeStep)
+		{
+			auto waitingTime = std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::duration<float>(timeStep - accumulatedTime));
+			std::this_thread::sleep_until(previousTime + waitingTime);
+			accumulateElapsedTime();
+		}
+
+		auto numberOfSteps = static_cast<unsigned int>(std::min(std::floor(accumulatedTime / timeStep), static_cast<float>(maxSteps)));
+		accumulatedTime -= static_cast<float>(numberOfSteps) * timeStep;
+
+		if(accumulatedTime >= timeStep)
+		{ //too late: drop late steps
+			accumulatedTime = std::fmod(accumulatedTime, timeStep);
+		}
+
+		return numberOfSteps;
+	}
+
+	void FixedStepTimer::accumulateElapsedTime()
+	{
+		auto currentTime = std::chrono::steady_clock::now();
+		accumulatedTime += std::chrono::duration<float>(currentTime - previousTime).count();
+		previousTime = currentTime;
+	}
+
+}
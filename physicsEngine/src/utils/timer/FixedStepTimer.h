@@ -0,0 +1,32 @@
+#ifndef URCHINENGINE_FIXEDSTEPTIMER_H
+#define URCHINENGINE_FIXEDSTEPTIMER_H
+
+#include <chrono>
+
+namespace urchin
+{
+
+	/**
+	* Timer of a fixed time step simulation: accumulates the elapsed time and determines how many steps must be processed
+	* to stay synchronized with the real time.
+	*/
+	class FixedStepTimer
+	{
+		public:
+			FixedStepTimer(float, unsigned int);
+
+			unsigned int waitNextSteps();
+
+		private:
+			void accumulateElapsedTime();
+
+			const float timeStep;
+			const unsigned int maxSteps;
+
+			float accumulatedTime;
+			std::chrono::steady_clock::time_point previousTime;
+	};
+
+}
+
+#endif
@@ -3,6 +3,7 @@
 #include "common/io/StringUtilTest.h"
 #include "common/io/MapUtilTest.h"
 #include "common/system/FileHandlerTest.h"
+#include "common/tools/thread/ThreadPoolTest.h"
 #include "common/math/algebra/QuaternionTest.h"
 #include "common/math/geometry/OrthogonalProjectionTest.h"
 #include "common/math/geometry/ClosestPointTest.h"
@@ -12,11 +13,19 @@
 #include "common/math/geometry/ResizePolygon2DServiceTest.h"
 #include "common/math/geometry/ConvexHullShape2DTest.h"
 #include "common/math/geometry/SortPointsTest.h"
+#include "common/partitioning/aabbtree/AABBTreeTest.h"
+#include "common/partitioning/aabbtree/AABBTreeBrowseStackTest.h"
 #include "physics/shape/ShapeToAABBoxTest.h"
 #include "physics/shape/ShapeToConvexObjectTest.h"
+#include "physics/shape/CompoundShapeTest.h"
+#include "physics/shape/HeightfieldShapeTest.h"
 #include "physics/object/SupportPointTest.h"
 #include "physics/body/InertiaCalculationTest.h"
+#include "physics/body/BodyStateSnapshotTest.h"
+#include "physics/body/ActiveBodiesTest.h"
+#include "physics/utils/pool/SyncFixedSizePoolTest.h"
 #include "physics/collision/broadphase/aabbtree/BodyAABBTreeTest.h"
+#include "physics/collision/broadphase/HashPairContainerTest.h"
 #include "physics/collision/narrowphase/algorithm/gjk/GJKBoxTest.h"
 #include "physics/collision/narrowphase/algorithm/gjk/GJKConvexHullTest.h"
 #include "physics/collision/narrowphase/algorithm/gjk/GJKSphereTest.h"
@@ -25,8 +34,14 @@
 #include "physics/collision/narrowphase/algorithm/epa/EPASphereTest.h"
 #include "physics/collision/narrowphase/algorithm/epa/EPAConvexHullTest.h"
 #include "physics/collision/narrowphase/algorithm/epa/EPAConvexObjectTest.h"
+#include "physics/collision/narrowphase/algorithm/CollisionAlgorithmTest.h"
 #include "physics/collision/island/IslandContainerTest.h"
 #include "physics/it/FallingObjectIT.h"
+#include "physics/it/BatchQueryIT.h"
+#include "physics/it/PhysicsWorldSchedulerIT.h"
+#include "physics/it/CharacterControllerBatchIT.h"
+#include "physics/it/PhysicsWorldSnapshotIT.h"
+#include "physics/it/PhysicsStatisticsIT.h"
 #include "ai/path/navmesh/csg/CSGPolygonTest.h"
 #include "ai/path/navmesh/csg/PolygonsUnionTest.h"
 #include "ai/path/navmesh/csg/PolygonsSubtractionTest.h"
@@ -47,6 +62,9 @@ void commonTests(CppUnit::TextUi::TestRunner &runner)
     //system - file
     runner.addTest(FileHandlerTest::suite());
 
+    //tools - thread
+    runner.addTest(ThreadPoolTest::suite());
+
     //math - algebra
     runner.addTest(QuaternionTest::suite());
 
@@ -59,6 +77,10 @@ void commonTests(CppUnit::TextUi::TestRunner &runner)
     runner.addTest(ResizePolygon2DServiceTest::suite());
     runner.addTest(ConvexHullShape2DTest::suite());
     runner.addTest(SortPointsTest::suite());
+
+    //partitioning
+    runner.addTest(AABBTreeTest::suite());
+    runner.addTest(AABBTreeBrowseStackTest::suite());
 }
 
 void physicsTests(CppUnit::TextUi::TestRunner &runner)
@@ -66,15 +88,23 @@ void physicsTests(CppUnit::TextUi::TestRunner &runner)
     //shape
     runner.addTest(ShapeToAABBoxTest::suite());
     runner.addTest(ShapeToConvexObjectTest::suite());
+    runner.addTest(CompoundShapeTest::suite());
+    runner.addTest(HeightfieldShapeTest::suite());
 
     //object
     runner.addTest(SupportPointTest::suite());
 
     //body
     runner.addTest(InertiaCalculationTest::suite());
+    runner.addTest(BodyStateSnapshotTest::suite());
+    runner.addTest(ActiveBodiesTest::suite());
+
+    //pool
+    runner.addTest(SyncFixedSizePoolTest::suite());
 
     //broad phase
     runner.addTest(BodyAABBTreeTest::suite());
+    runner.addTest(HashPairContainerTest::suite());
 
     //narrow phase
     runner.addTest(GJKSphereTest::suite());
@@ -85,12 +115,18 @@ void physicsTests(CppUnit::TextUi::TestRunner &runner)
     runner.addTest(EPASphereTest::suite());
     runner.addTest(EPAConvexHullTest::suite());
     runner.addTest(EPAConvexObjectTest::suite());
+    runner.addTest(CollisionAlgorithmTest::suite());
 
     //island
     runner.addTest(IslandContainerTest::suite());
 
     //integration tests (IT)
     runner.addTest(FallingObjectIT::suite());
+    runner.addTest(BatchQueryIT::suite());
+    runner.addTest(PhysicsWorldSchedulerIT::suite());
+    runner.addTest(CharacterControllerBatchIT::suite());
+    runner.addTest(PhysicsWorldSnapshotIT::suite());
+    runner.addTest(PhysicsStatisticsIT::suite());
 }
 
 void aiTests(CppUnit::TextUi::TestRunner &runner)
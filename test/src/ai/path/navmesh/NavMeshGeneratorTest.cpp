@@ -1,6 +1,7 @@
 #include <cppunit/TestSuite.h>
 #include <cppunit/TestCaller.h>
 #include <memory>
+#include <algorithm>
 #include "UrchinCommon.h"
 
 #include "NavMeshGeneratorTest.h"
@@ -104,17 +105,21 @@ void NavMeshGeneratorTest::holeAndCrossingHoleOnWalkableFace()
 
     std::shared_ptr<NavMesh> navMesh = navMeshGenerator.generate(aiWorld);
 
-    AssertHelper::assertUnsignedInt(navMesh->getPolygons().size(), 4);
-    AssertHelper::assertTrue(navMesh->getPolygons()[0]->getName()=="<hole[2]>");
-    AssertHelper::assertTrue(navMesh->getPolygons()[1]->getName()=="<[walkableFace[2]] - [crossingHole]{0}> - <hole>");
-    AssertHelper::assertUnsignedInt(navMesh->getPolygons()[1]->getPoints().size(), 8);
-    AssertHelper::assertUnsignedInt(navMesh->getPolygons()[1]->getTriangles().size(), 8);
-    AssertHelper::assertTrue(navMesh->getPolygons()[2]->getName()=="<[walkableFace[2]] - [crossingHole]{1}>");
-    AssertHelper::assertPoint3FloatEquals(navMesh->getPolygons()[2]->getPoints()[0], Point3<float>(2.0, 0.01, 2.0));
-    AssertHelper::assertPoint3FloatEquals(navMesh->getPolygons()[2]->getPoints()[1], Point3<float>(2.0, 0.01, -2.0));
-    AssertHelper::assertPoint3FloatEquals(navMesh->getPolygons()[2]->getPoints()[2], Point3<float>(1.7, 0.01, -2.0));
-    AssertHelper::assertPoint3FloatEquals(navMesh->getPolygons()[2]->getPoints()[3], Point3<float>(1.7, 0.01, 2.0));
-    AssertHelper::assertTrue(navMesh->getPolygons()[3]->getName()=="<crossingHole[2]>");
+    //polygons order depends on navigation objects AABBTree structure: sort them by name
+    std::vector<std::shared_ptr<NavPolygon>> polygons = navMesh->getPolygons();
+    std::sort(polygons.begin(), polygons.end(), [](const auto &p1, const auto &p2){return p1->getName() < p2->getName();});
+
+    AssertHelper::assertUnsignedInt(polygons.size(), 4);
+    AssertHelper::assertTrue(polygons[0]->getName()=="<[walkableFace[2]] - [crossingHole]{0}> - <hole>");
+    AssertHelper::assertUnsignedInt(polygons[0]->getPoints().size(), 8);
+    AssertHelper::assertUnsignedInt(polygons[0]->getTriangles().size(), 8);
+    AssertHelper::assertTrue(polygons[1]->getName()=="<[walkableFace[2]] - [crossingHole]{1}>");
+    AssertHelper::assertPoint3FloatEquals(polygons[1]->getPoints()[0], Point3<float>(2.0, 0.01, 2.0));
+    AssertHelper::assertPoint3FloatEquals(polygons[1]->getPoints()[1], Point3<float>(2.0, 0.01, -2.0));
+    AssertHelper::assertPoint3FloatEquals(polygons[1]->getPoints()[2], Point3<float>(1.7, 0.01, -2.0));
+    AssertHelper::assertPoint3FloatEquals(polygons[1]->getPoints()[3], Point3<float>(1.7, 0.01, 2.0));
+    AssertHelper::assertTrue(polygons[2]->getName()=="<crossingHole[2]>");
+    AssertHelper::assertTrue(polygons[3]->getName()=="<hole[2]>");
 }
 
 void NavMeshGeneratorTest::moveHoleOnWalkableFace()
@@ -53,6 +53,27 @@ void ClosestPointTest::closestPointLineSegment3D()
 	AssertHelper::assertFloatEquals(barycentrics[1], 0.0);
 }
 
+void ClosestPointTest::closestPointsLineSegments3D()
+{
+	LineSegment3D<float> lineSegment(Point3<float>(0.0, 0.0, 0.0), Point3<float>(2.0, 0.0, 0.0));
+	Point3<float> closestPointThis, closestPointOther;
+
+	//crossing segments
+	lineSegment.closestPoints(LineSegment3D<float>(Point3<float>(1.0, -1.0, 1.0), Point3<float>(1.0, 1.0, 1.0)), closestPointThis, closestPointOther);
+	AssertHelper::assertPoint3FloatEquals(closestPointThis, Point3<float>(1.0, 0.0, 0.0));
+	AssertHelper::assertPoint3FloatEquals(closestPointOther, Point3<float>(1.0, 0.0, 1.0));
+
+	//other segment beyond extremity B
+	lineSegment.closestPoints(LineSegment3D<float>(Point3<float>(3.0, 1.0, 0.0), Point3<float>(3.0, 2.0, 0.0)), closestPointThis, closestPointOther);
+	AssertHelper::assertPoint3FloatEquals(closestPointThis, Point3<float>(2.0, 0.0, 0.0));
+	AssertHelper::assertPoint3FloatEquals(closestPointOther, Point3<float>(3.0, 1.0, 0.0));
+
+	//degenerate other segment
+	lineSegment.closestPoints(LineSegment3D<float>(Point3<float>(0.5, 1.0, 0.0), Point3<float>(0.5, 1.0, 0.0)), closestPointThis, closestPointOther);
+	AssertHelper::assertPoint3FloatEquals(closestPointThis, Point3<float>(0.5, 0.0, 0.0));
+	AssertHelper::assertPoint3FloatEquals(closestPointOther, Point3<float>(0.5, 1.0, 0.0));
+}
+
 void ClosestPointTest::closestPointTriangle3D()
 {
 	float barycentrics[3];
@@ -168,6 +189,7 @@ CppUnit::Test *ClosestPointTest::suite()
 
 	suite->addTest(new CppUnit::TestCaller<ClosestPointTest>("closestPointLineSegment2D", &ClosestPointTest::closestPointLineSegment2D));
 	suite->addTest(new CppUnit::TestCaller<ClosestPointTest>("closestPointLineSegment3D", &ClosestPointTest::closestPointLineSegment3D));
+	suite->addTest(new CppUnit::TestCaller<ClosestPointTest>("closestPointsLineSegments3D", &ClosestPointTest::closestPointsLineSegments3D));
 
 	suite->addTest(new CppUnit::TestCaller<ClosestPointTest>("closestPointTriangle3D", &ClosestPointTest::closestPointTriangle3D));
 
@@ -11,6 +11,7 @@ class ClosestPointTest : public CppUnit::TestFixture
 
 		void closestPointLineSegment2D();
 		void closestPointLineSegment3D();
+		void closestPointsLineSegments3D();
 
 		void closestPointTriangle3D();
 
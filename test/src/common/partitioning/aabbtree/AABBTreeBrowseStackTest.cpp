@@ -0,0 +1,46 @@
+#include <cppunit/TestSuite.h>
+#include <cppunit/TestCaller.h>
+#include "UrchinCommon.h"
+
+#include "common/partitioning/aabbtree/AABBTreeBrowseStackTest.h"
+#include "AssertHelper.h"
+using namespace urchin;
+
+void AABBTreeBrowseStackTest::pushPopInline()
+{
+    AABBTreeBrowseStack<unsigned int> browseStack;
+    browseStack.push(1);
+    browseStack.push(2);
+
+    AssertHelper::assertUnsignedInt(browseStack.pop(), 2);
+    browseStack.push(3);
+    AssertHelper::assertUnsignedInt(browseStack.pop(), 3);
+    AssertHelper::assertUnsignedInt(browseStack.pop(), 1);
+    AssertHelper::assertTrue(browseStack.isEmpty());
+}
+
+void AABBTreeBrowseStackTest::pushPopSpilled()
+{
+    AABBTreeBrowseStack<unsigned int> browseStack;
+    for(unsigned int i=0; i<500; ++i)
+    { //more elements than the inline storage (e.g.: very unbalanced tree)
+        browseStack.push(i);
+    }
+
+    for(unsigned int i=500; i>0; --i)
+    {
+        AssertHelper::assertTrue(!browseStack.isEmpty());
+        AssertHelper::assertUnsignedInt(browseStack.pop(), i - 1);
+    }
+    AssertHelper::assertTrue(browseStack.isEmpty());
+}
+
+CppUnit::Test *AABBTreeBrowseStackTest::suite()
+{
+    auto *suite = new CppUnit::TestSuite("AABBTreeBrowseStackTest");
+
+    suite->addTest(new CppUnit::TestCaller<AABBTreeBrowseStackTest>("pushPopInline", &AABBTreeBrowseStackTest::pushPopInline));
+    suite->addTest(new CppUnit::TestCaller<AABBTreeBrowseStackTest>("pushPopSpilled", &AABBTreeBrowseStackTest::pushPopSpilled));
+
+    return suite;
+}
@@ -0,0 +1,16 @@
+#ifndef URCHINENGINE_AABBTREEBROWSESTACKTEST_H
+#define URCHINENGINE_AABBTREEBROWSESTACKTEST_H
+
+#include <cppunit/TestFixture.h>
+#include <cppunit/Test.h>
+
+class AABBTreeBrowseStackTest : public CppUnit::TestFixture
+{
+    public:
+        static CppUnit::Test *suite();
+
+        void pushPopInline();
+        void pushPopSpilled();
+};
+
+#endif
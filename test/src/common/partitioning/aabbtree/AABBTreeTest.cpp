@@ -0,0 +1,171 @@
+#include <cppunit/extensions/HelperMacros.h>
+#include <algorithm>
+
+#include "AABBTreeTest.h"
+#include "AssertHelper.h"
+using namespace urchin;
+
+namespace
+{
+    struct TestObject
+    {
+        std::string id;
+        AABBox<float> aabbox;
+        bool moving;
+    };
+
+    class TestObjectNodeData : public AABBNodeData<TestObject *>
+    {
+        public:
+            explicit TestObjectNodeData(TestObject *testObject) :
+                    AABBNodeData(testObject)
+            {
+
+            }
+
+            AABBNodeData<TestObject *> *clone() const override
+            {
+                return new TestObjectNodeData(getNodeObject());
+            }
+
+            const std::string &getObjectId() const override
+            {
+                return getNodeObject()->id;
+            }
+
+            AABBox<float> retrieveObjectAABBox() const override
+            {
+                return getNodeObject()->aabbox;
+            }
+
+            bool isObjectMoving() const override
+            {
+                return getNodeObject()->moving;
+            }
+    };
+
+    std::vector<std::unique_ptr<TestObject>> buildAlignedObjects(unsigned int number)
+    {
+        std::vector<std::unique_ptr<TestObject>> testObjects;
+        for(unsigned int i=0; i<number; ++i)
+        {
+            Point3<float> min(static_cast<float>(i) * 2.0f, 0.0f, 0.0f);
+            testObjects.push_back(std::make_unique<TestObject>(TestObject{std::to_string(i), AABBox<float>(min, min + Point3<float>(1.0f, 1.0f, 1.0f)), false}));
+        }
+        return testObjects;
+    }
+}
+
+void AABBTreeTest::balancedTreeOnAlignedObjects()
+{
+    std::vector<std::unique_ptr<TestObject>> testObjects = buildAlignedObjects(1024);
+    AABBTree<TestObject *> aabbTree(0.0f);
+
+    for(const auto &testObject : testObjects)
+    {
+        aabbTree.addObject(new TestObjectNodeData(testObject.get()));
+    }
+
+    AssertHelper::assertTrue(aabbTree.getHeight() >= 10);
+    AssertHelper::assertTrue(aabbTree.getHeight() <= 15, "Tree height must stay close to log2(1024): " + std::to_string(aabbTree.getHeight()));
+}
+
+void AABBTreeTest::queryAfterObjectsRemoval()
+{
+    std::vector<std::unique_ptr<TestObject>> testObjects = buildAlignedObjects(100);
+    AABBTree<TestObject *> aabbTree(0.1f);
+    for(const auto &testObject : testObjects)
+    {
+        aabbTree.addObject(new TestObjectNodeData(testObject.get()));
+    }
+
+    for(std::size_t i=0; i<testObjects.size(); i+=2)
+    {
+        aabbTree.removeObject(testObjects[i].get());
+    }
+    std::vector<TestObject *> objectsHit;
+    aabbTree.aabboxQuery(AABBox<float>(Point3<float>(0.0f, 0.0f, 0.0f), Point3<float>(20.5f, 1.0f, 1.0f)), objectsHit);
+    std::sort(objectsHit.begin(), objectsHit.end(), [](const TestObject *o1, const TestObject *o2){return std::stoi(o1->id) < std::stoi(o2->id);});
+
+    AssertHelper::assertUnsignedInt(objectsHit.size(), 5);
+    for(std::size_t i=0; i<objectsHit.size(); ++i)
+    {
+        AssertHelper::assertString(objectsHit[i]->id, std::to_string(i * 2 + 1));
+    }
+    AssertHelper::assertTrue(!aabbTree.containsObject(testObjects[0].get()));
+    AssertHelper::assertTrue(aabbTree.containsObject(testObjects[1].get()));
+    AssertHelper::assertTrue(aabbTree.getNode(aabbTree.getNodeData(testObjects[1].get())->getNodeId()).getNodeData()->getNodeObject() == testObjects[1].get());
+}
+
+void AABBTreeTest::updateMovingObject()
+{
+    std::vector<std::unique_ptr<TestObject>> testObjects = buildAlignedObjects(10);
+    AABBTree<TestObject *> aabbTree(0.1f);
+    for(const auto &testObject : testObjects)
+    {
+        aabbTree.addObject(new TestObjectNodeData(testObject.get()));
+    }
+
+    testObjects[0]->moving = true;
+    testObjects[0]->aabbox = AABBox<float>(Point3<float>(0.0f, 50.0f, 0.0f), Point3<float>(1.0f, 51.0f, 1.0f));
+    aabbTree.updateObjects();
+
+    std::vector<TestObject *> objectsHit;
+    aabbTree.aabboxQuery(AABBox<float>(Point3<float>(0.0f, 49.0f, 0.0f), Point3<float>(1.0f, 50.5f, 1.0f)), objectsHit);
+    AssertHelper::assertUnsignedInt(objectsHit.size(), 1);
+    AssertHelper::assertString(objectsHit[0]->id, "0");
+
+    objectsHit.clear();
+    aabbTree.rayQuery(Ray<float>(Point3<float>(-1.0f, 0.5f, 0.5f), Point3<float>(100.0f, 0.5f, 0.5f)), objectsHit);
+    AssertHelper::assertUnsignedInt(objectsHit.size(), 9);
+}
+
+void AABBTreeTest::batchRayQuery()
+{
+    std::vector<std::unique_ptr<TestObject>> testObjects = buildAlignedObjects(50);
+    AABBTree<TestObject *> aabbTree(0.1f);
+    for(const auto &testObject : testObjects)
+    {
+        aabbTree.addObject(new TestObjectNodeData(testObject.get()));
+    }
+
+    std::vector<Ray<float>> rays;
+    std::vector<float> enlargeSizes;
+    for(unsigned int i=0; i<20; ++i)
+    {
+        float x = static_cast<float>(i) * 5.1f;
+        rays.emplace_back(Ray<float>(Point3<float>(x, 5.0f, 0.5f), Point3<float>(x + static_cast<float>(i % 3), -5.0f, 0.5f)));
+        enlargeSizes.push_back(i % 2 == 0 ? 0.0f : 0.75f);
+    }
+    std::vector<std::vector<TestObject *>> objectsHitRays;
+    aabbTree.batchRayQuery(rays, enlargeSizes, objectsHitRays);
+
+    AssertHelper::assertUnsignedInt(objectsHitRays.size(), rays.size());
+    for(std::size_t i=0; i<rays.size(); ++i)
+    {
+        std::vector<TestObject *> expectedObjectsHit;
+        if(enlargeSizes[i] == 0.0f)
+        {
+            aabbTree.rayQuery(rays[i], expectedObjectsHit);
+        }else
+        {
+            aabbTree.enlargedRayQuery(rays[i], enlargeSizes[i], nullptr, expectedObjectsHit);
+        }
+
+        std::sort(expectedObjectsHit.begin(), expectedObjectsHit.end());
+        std::sort(objectsHitRays[i].begin(), objectsHitRays[i].end());
+        AssertHelper::assertTrue(expectedObjectsHit == objectsHitRays[i], "Batch ray query must return same objects as single ray query for ray " + std::to_string(i));
+    }
+}
+
+CppUnit::Test *AABBTreeTest::suite()
+{
+    auto *suite = new CppUnit::TestSuite("AABBTreeTest");
+
+    suite->addTest(new CppUnit::TestCaller<AABBTreeTest>("balancedTreeOnAlignedObjects", &AABBTreeTest::balancedTreeOnAlignedObjects));
+    suite->addTest(new CppUnit::TestCaller<AABBTreeTest>("queryAfterObjectsRemoval", &AABBTreeTest::queryAfterObjectsRemoval));
+    suite->addTest(new CppUnit::TestCaller<AABBTreeTest>("updateMovingObject", &AABBTreeTest::updateMovingObject));
+    suite->addTest(new CppUnit::TestCaller<AABBTreeTest>("batchRayQuery", &AABBTreeTest::batchRayQuery));
+
+    return suite;
+}
@@ -0,0 +1,19 @@
+#ifndef URCHINENGINE_AABBTREETEST_H
+#define URCHINENGINE_AABBTREETEST_H
+
+#include <cppunit/TestFixture.h>
+#include <cppunit/Test.h>
+#include "UrchinCommon.h"
+
+class AABBTreeTest : public CppUnit::TestFixture
+{
+    public:
+        static CppUnit::Test *suite();
+
+        void balancedTreeOnAlignedObjects();
+        void queryAfterObjectsRemoval();
+        void updateMovingObject();
+        void batchRayQuery();
+};
+
+#endif
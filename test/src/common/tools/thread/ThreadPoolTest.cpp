@@ -0,0 +1,89 @@
+#include <cppunit/extensions/HelperMacros.h>
+#include <atomic>
+
+#include "ThreadPoolTest.h"
+#include "AssertHelper.h"
+using namespace urchin;
+
+void ThreadPoolTest::serialExecution()
+{
+    ThreadPool threadPool(1);
+    std::vector<unsigned int> executionOrder;
+
+    threadPool.parallelFor(5, [&](unsigned int taskIndex){
+        executionOrder.push_back(taskIndex);
+    });
+
+    AssertHelper::assertUnsignedInt(threadPool.getNumberOfThreads(), 1);
+    AssertHelper::assertUnsignedInt(executionOrder.size(), 5);
+    for(unsigned int i=0; i<executionOrder.size(); ++i)
+    {
+        AssertHelper::assertUnsignedInt(executionOrder[i], i);
+    }
+}
+
+void ThreadPoolTest::parallelExecution()
+{
+    ThreadPool threadPool(4);
+    std::vector<std::atomic<unsigned int>> executionsCount(100);
+
+    threadPool.parallelFor(100, [&](unsigned int taskIndex){
+        executionsCount[taskIndex]++;
+    });
+
+    for(const auto &executionCount : executionsCount)
+    {
+        AssertHelper::assertUnsignedInt(executionCount.load(), 1);
+    }
+}
+
+void ThreadPoolTest::successiveExecutions()
+{
+    ThreadPool threadPool(3);
+    std::atomic<unsigned int> sum(0);
+
+    for(unsigned int i=0; i<200; ++i)
+    {
+        threadPool.parallelFor(4, [&](unsigned int taskIndex){
+            sum += taskIndex;
+        });
+    }
+
+    AssertHelper::assertUnsignedInt(sum.load(), 200 * (0 + 1 + 2 + 3));
+}
+
+void ThreadPoolTest::exceptionInTask()
+{
+    ThreadPool threadPool(2);
+    std::atomic<unsigned int> executionsCount(0);
+
+    bool exceptionThrown = false;
+    try
+    {
+        threadPool.parallelFor(10, [&](unsigned int taskIndex){
+            executionsCount++;
+            if(taskIndex == 5)
+            {
+                throw std::runtime_error("task error");
+            }
+        });
+    }catch(const std::runtime_error &)
+    {
+        exceptionThrown = true;
+    }
+
+    AssertHelper::assertTrue(exceptionThrown);
+    AssertHelper::assertUnsignedInt(executionsCount.load(), 10);
+}
+
+CppUnit::Test *ThreadPoolTest::suite()
+{
+    auto *suite = new CppUnit::TestSuite("ThreadPoolTest");
+
+    suite->addTest(new CppUnit::TestCaller<ThreadPoolTest>("serialExecution", &ThreadPoolTest::serialExecution));
+    suite->addTest(new CppUnit::TestCaller<ThreadPoolTest>("parallelExecution", &ThreadPoolTest::parallelExecution));
+    suite->addTest(new CppUnit::TestCaller<ThreadPoolTest>("successiveExecutions", &ThreadPoolTest::successiveExecutions));
+    suite->addTest(new CppUnit::TestCaller<ThreadPoolTest>("exceptionInTask", &ThreadPoolTest::exceptionInTask));
+
+    return suite;
+}
@@ -0,0 +1,19 @@
+#ifndef URCHINENGINE_THREADPOOLTEST_H
+#define URCHINENGINE_THREADPOOLTEST_H
+
+#include <cppunit/TestFixture.h>
+#include <cppunit/Test.h>
+#include "UrchinCommon.h"
+
+class ThreadPoolTest : public CppUnit::TestFixture
+{
+    public:
+        static CppUnit::Test *suite();
+
+        void serialExecution();
+        void parallelExecution();
+        void successiveExecutions();
+        void exceptionInTask();
+};
+
+#endif
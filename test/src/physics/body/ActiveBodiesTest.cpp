@@ -0,0 +1,93 @@
+#include <cppunit/TestSuite.h>
+#include <cppunit/TestCaller.h>
+#include <memory>
+#include <algorithm>
+#include "UrchinPhysicsEngine.h"
+#include "body/ActiveBodies.h"
+
+#include "AssertHelper.h"
+#include "physics/body/ActiveBodiesTest.h"
+using namespace urchin;
+
+namespace
+{
+	std::unique_ptr<WorkRigidBody> createDynamicBody(const std::string &id)
+	{
+		std::shared_ptr<CollisionBoxShape> cubeShape = std::make_shared<CollisionBoxShape>(Vector3<float>(0.5f, 0.5f, 0.5f));
+		auto body = std::make_unique<WorkRigidBody>(id, PhysicsTransform(), cubeShape);
+		body->setMassProperties(1.0f, Vector3<float>(1.0f, 1.0f, 1.0f));
+		body->setIsActive(false);
+		return body;
+	}
+
+	bool containsBody(const ActiveBodies &activeBodies, const AbstractWorkBody *body)
+	{
+		return std::find(activeBodies.getBodies().begin(), activeBodies.getBodies().end(), body) != activeBodies.getBodies().end();
+	}
+}
+
+void ActiveBodiesTest::activateAndDeactivateBodies()
+{
+	ActiveBodies activeBodies;
+	std::unique_ptr<WorkRigidBody> body1 = createDynamicBody("body1");
+	std::unique_ptr<WorkRigidBody> body2 = createDynamicBody("body2");
+	std::unique_ptr<WorkRigidBody> body3 = createDynamicBody("body3");
+	body1->setActiveBodies(&activeBodies);
+	body2->setActiveBodies(&activeBodies);
+	body3->setActiveBodies(&activeBodies);
+
+	body1->setIsActive(true);
+	body2->setIsActive(true);
+	body3->setIsActive(true);
+	body2->setIsActive(true); //already active
+	body1->setIsActive(false);
+
+	AssertHelper::assertUnsignedInt(activeBodies.getBodies().size(), 2);
+	AssertHelper::assertTrue(containsBody(activeBodies, body2.get()));
+	AssertHelper::assertTrue(containsBody(activeBodies, body3.get()));
+
+	body3->setIsStatic(true);
+	AssertHelper::assertUnsignedInt(activeBodies.getBodies().size(), 1);
+	AssertHelper::assertTrue(activeBodies.getBodies()[0] == body2.get());
+	AssertHelper::assertUnsignedInt(body2->getActiveBodyIndex(), 0);
+}
+
+void ActiveBodiesTest::trackAlreadyActiveBody()
+{
+	ActiveBodies activeBodies;
+	std::unique_ptr<WorkRigidBody> body = createDynamicBody("body");
+	body->setIsActive(true);
+
+	body->setActiveBodies(&activeBodies);
+
+	AssertHelper::assertUnsignedInt(activeBodies.getBodies().size(), 1);
+	AssertHelper::assertTrue(activeBodies.getBodies()[0] == body.get());
+}
+
+void ActiveBodiesTest::deleteActiveBody()
+{
+	ActiveBodies activeBodies;
+	std::unique_ptr<WorkRigidBody> body1 = createDynamicBody("body1");
+	std::unique_ptr<WorkRigidBody> body2 = createDynamicBody("body2");
+	body1->setActiveBodies(&activeBodies);
+	body2->setActiveBodies(&activeBodies);
+	body1->setIsActive(true);
+	body2->setIsActive(true);
+
+	body1.reset();
+
+	AssertHelper::assertUnsignedInt(activeBodies.getBodies().size(), 1);
+	AssertHelper::assertTrue(activeBodies.getBodies()[0] == body2.get());
+	AssertHelper::assertUnsignedInt(body2->getActiveBodyIndex(), 0);
+}
+
+CppUnit::Test *ActiveBodiesTest::suite()
+{
+	auto *suite = new CppUnit::TestSuite("ActiveBodiesTest");
+
+	suite->addTest(new CppUnit::TestCaller<ActiveBodiesTest>("activateAndDeactivateBodies", &ActiveBodiesTest::activateAndDeactivateBodies));
+	suite->addTest(new CppUnit::TestCaller<ActiveBodiesTest>("trackAlreadyActiveBody", &ActiveBodiesTest::trackAlreadyActiveBody));
+	suite->addTest(new CppUnit::TestCaller<ActiveBodiesTest>("deleteActiveBody", &ActiveBodiesTest::deleteActiveBody));
+
+	return suite;
+}
@@ -0,0 +1,17 @@
+#ifndef URCHINENGINE_ACTIVEBODIESTEST_H
+#define URCHINENGINE_ACTIVEBODIESTEST_H
+
+#include <cppunit/TestFixture.h>
+#include <cppunit/Test.h>
+
+class ActiveBodiesTest : public CppUnit::TestFixture
+{
+	public:
+		static CppUnit::Test *suite();
+
+		void activateAndDeactivateBodies();
+		void trackAlreadyActiveBody();
+		void deleteActiveBody();
+};
+
+#endif
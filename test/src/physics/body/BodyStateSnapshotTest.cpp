@@ -0,0 +1,140 @@
+#include <cppunit/TestSuite.h>
+#include <cppunit/TestCaller.h>
+#include <thread>
+#include <atomic>
+#include "UrchinCommon.h"
+#include "UrchinPhysicsEngine.h"
+
+#include "AssertHelper.h"
+#include "physics/body/BodyStateSnapshotTest.h"
+using namespace urchin;
+
+namespace
+{
+	BodyState buildState(float value)
+	{
+		BodyState state;
+		state.position = Point3<float>(value, value, value);
+		state.orientation = Quaternion<float>(0.0f, 0.0f, 0.0f, 1.0f);
+		state.linearVelocity = Vector3<float>(value, value, value);
+		state.angularVelocity = Vector3<float>(value, value, value);
+		return state;
+	}
+}
+
+void BodyStateSnapshotTest::readBeforePublication()
+{
+	BodyStateSnapshot stateSnapshot;
+	unsigned int stateIndex = stateSnapshot.allocateStateIndex();
+
+	stateSnapshot.beginWrite();
+	stateSnapshot.writeState(stateIndex, buildState(1.0f));
+
+	BodyState state;
+	AssertHelper::assertTrue(!stateSnapshot.readState(stateIndex, state), "State must not be readable before publication");
+	AssertHelper::assertTrue(!stateSnapshot.readState(BodyStateSnapshot::NO_STATE_INDEX, state));
+}
+
+void BodyStateSnapshotTest::readPublishedStates()
+{
+	BodyStateSnapshot stateSnapshot;
+	unsigned int stateIndex1 = stateSnapshot.allocateStateIndex();
+	unsigned int stateIndex2 = stateSnapshot.allocateStateIndex();
+
+	for(unsigned int i=0; i<5; ++i)
+	{
+		stateSnapshot.beginWrite();
+		stateSnapshot.writeState(stateIndex1, buildState((float)i));
+		stateSnapshot.writeState(stateIndex2, buildState((float)i + 10.0f));
+		stateSnapshot.publish();
+	}
+
+	BodyState state1, state2;
+	AssertHelper::assertTrue(stateSnapshot.readState(stateIndex1, state1));
+	AssertHelper::assertTrue(stateSnapshot.readState(stateIndex2, state2));
+	AssertHelper::assertFloatEquals(state1.position.X, 4.0f);
+	AssertHelper::assertFloatEquals(state2.linearVelocity.Y, 14.0f);
+	AssertHelper::assertFloatEquals(state1.previousPosition.X, 3.0f);
+	AssertHelper::assertFloatEquals(state2.previousPosition.Z, 13.0f);
+}
+
+void BodyStateSnapshotTest::resetStateHistory()
+{
+	BodyStateSnapshot stateSnapshot;
+	unsigned int stateIndex = stateSnapshot.allocateStateIndex();
+
+	for(unsigned int i=0; i<3; ++i)
+	{
+		if(i==2)
+		{ //body teleported
+			stateSnapshot.resetStateHistory(stateIndex);
+		}
+
+		stateSnapshot.beginWrite();
+		stateSnapshot.writeState(stateIndex, buildState((float)i * 10.0f));
+		stateSnapshot.publish();
+	}
+
+	BodyState state;
+	AssertHelper::assertTrue(stateSnapshot.readState(stateIndex, state));
+	AssertHelper::assertFloatEquals(state.position.X, 20.0f);
+	AssertHelper::assertFloatEquals(state.previousPosition.X, 20.0f);
+
+	stateSnapshot.releaseStateIndex(stateIndex);
+	AssertHelper::assertUnsignedInt(stateSnapshot.allocateStateIndex(), stateIndex);
+}
+
+void BodyStateSnapshotTest::concurrentReadAndWrite()
+{
+	BodyStateSnapshot stateSnapshot;
+	std::vector<unsigned int> stateIndices;
+	for(unsigned int i=0; i<50; ++i)
+	{
+		stateIndices.push_back(stateSnapshot.allocateStateIndex());
+	}
+
+	std::atomic_bool writeFinished(false);
+	std::thread writerThread([&]() {
+		for(unsigned int i=1; i<=2000; ++i)
+		{
+			stateSnapshot.beginWrite();
+			for(unsigned int stateIndex : stateIndices)
+			{
+				stateSnapshot.writeState(stateIndex, buildState((float)i));
+			}
+			stateSnapshot.publish();
+		}
+		writeFinished.store(true);
+	});
+
+	bool consistentStates = true;
+	float lastReadValue = 0.0f;
+	while(!writeFinished.load())
+	{
+		BodyState state;
+		if(stateSnapshot.readState(stateIndices[0], state))
+		{
+			consistentStates &= state.position.X==state.position.Z && state.position.X==state.angularVelocity.Z;
+			consistentStates &= state.position.X >= lastReadValue; //published states never go backward
+			lastReadValue = state.position.X;
+		}
+	}
+	writerThread.join();
+
+	BodyState lastState;
+	AssertHelper::assertTrue(consistentStates, "Read states must be consistent and ordered");
+	AssertHelper::assertTrue(stateSnapshot.readState(stateIndices[49], lastState));
+	AssertHelper::assertFloatEquals(lastState.linearVelocity.X, 2000.0f);
+}
+
+CppUnit::Test *BodyStateSnapshotTest::suite()
+{
+	auto *suite = new CppUnit::TestSuite("BodyStateSnapshotTest");
+
+	suite->addTest(new CppUnit::TestCaller<BodyStateSnapshotTest>("readBeforePublication", &BodyStateSnapshotTest::readBeforePublication));
+	suite->addTest(new CppUnit::TestCaller<BodyStateSnapshotTest>("readPublishedStates", &BodyStateSnapshotTest::readPublishedStates));
+	suite->addTest(new CppUnit::TestCaller<BodyStateSnapshotTest>("resetStateHistory", &BodyStateSnapshotTest::resetStateHistory));
+	suite->addTest(new CppUnit::TestCaller<BodyStateSnapshotTest>("concurrentReadAndWrite", &BodyStateSnapshotTest::concurrentReadAndWrite));
+
+	return suite;
+}
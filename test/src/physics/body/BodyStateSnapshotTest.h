@@ -0,0 +1,18 @@
+#ifndef URCHINENGINE_BODYSTATESNAPSHOTTEST_H
+#define URCHINENGINE_BODYSTATESNAPSHOTTEST_H
+
+#include <cppunit/TestFixture.h>
+#include <cppunit/Test.h>
+
+class BodyStateSnapshotTest : public CppUnit::TestFixture
+{
+	public:
+		static CppUnit::Test *suite();
+
+		void readBeforePublication();
+		void readPublishedStates();
+		void resetStateHistory();
+		void concurrentReadAndWrite();
+};
+
+#endif
@@ -0,0 +1,109 @@
+#include <cppunit/TestSuite.h>
+#include <cppunit/TestCaller.h>
+#include <memory>
+#include "UrchinPhysicsEngine.h"
+#include "collision/broadphase/HashPairContainer.h"
+
+#include "AssertHelper.h"
+#include "physics/collision/broadphase/HashPairContainerTest.h"
+using namespace urchin;
+
+namespace
+{
+	std::vector<std::unique_ptr<WorkRigidBody>> createBodies(unsigned int nbBodies)
+	{
+		std::shared_ptr<CollisionBoxShape> cubeShape = std::make_shared<CollisionBoxShape>(Vector3<float>(0.5f, 0.5f, 0.5f));
+		std::vector<std::unique_ptr<WorkRigidBody>> bodies;
+		for(unsigned int i=0; i<nbBodies; ++i)
+		{
+			bodies.push_back(std::make_unique<WorkRigidBody>("body" + std::to_string(i), PhysicsTransform(), cubeShape));
+		}
+		return bodies;
+	}
+}
+
+void HashPairContainerTest::addSamePairTwice()
+{
+	std::vector<std::unique_ptr<WorkRigidBody>> bodies = createBodies(2);
+	HashPairContainer pairContainer;
+
+	pairContainer.addOverlappingPair(bodies[0].get(), bodies[1].get());
+	pairContainer.addOverlappingPair(bodies[1].get(), bodies[0].get());
+
+	AssertHelper::assertUnsignedInt(pairContainer.getOverlappingPairs().size(), 1);
+}
+
+void HashPairContainerTest::removePair()
+{
+	std::vector<std::unique_ptr<WorkRigidBody>> bodies = createBodies(3);
+	HashPairContainer pairContainer;
+	pairContainer.addOverlappingPair(bodies[0].get(), bodies[1].get());
+	pairContainer.addOverlappingPair(bodies[1].get(), bodies[2].get());
+
+	pairContainer.removeOverlappingPair(bodies[1].get(), bodies[0].get());
+
+	AssertHelper::assertUnsignedInt(pairContainer.getOverlappingPairs().size(), 1);
+	AssertHelper::assertTrue(pairContainer.getOverlappingPairs()[0]->getBodiesId()==OverlappingPair::computeBodiesId(bodies[1].get(), bodies[2].get()));
+
+	pairContainer.removeOverlappingPair(bodies[0].get(), bodies[2].get()); //not existing pair
+	AssertHelper::assertUnsignedInt(pairContainer.getOverlappingPairs().size(), 1);
+}
+
+void HashPairContainerTest::removeBodyPairs()
+{
+	std::vector<std::unique_ptr<WorkRigidBody>> bodies = createBodies(4);
+	HashPairContainer pairContainer;
+	pairContainer.addOverlappingPair(bodies[0].get(), bodies[1].get());
+	pairContainer.addOverlappingPair(bodies[0].get(), bodies[2].get());
+	pairContainer.addOverlappingPair(bodies[2].get(), bodies[3].get());
+
+	pairContainer.removeOverlappingPairs(bodies[0].get());
+
+	AssertHelper::assertUnsignedInt(pairContainer.getOverlappingPairs().size(), 1);
+	AssertHelper::assertTrue(pairContainer.getOverlappingPairs()[0]->getBodiesId()==OverlappingPair::computeBodiesId(bodies[2].get(), bodies[3].get()));
+
+	pairContainer.removeOverlappingPairs(bodies[3].get());
+	AssertHelper::assertUnsignedInt(pairContainer.getOverlappingPairs().size(), 0);
+}
+
+void HashPairContainerTest::manyPairs()
+{
+	std::vector<std::unique_ptr<WorkRigidBody>> bodies = createBodies(60);
+	HashPairContainer pairContainer;
+	for(std::size_t i=0; i<bodies.size(); ++i)
+	{
+		for(std::size_t j=i+1; j<bodies.size(); ++j)
+		{
+			pairContainer.addOverlappingPair(bodies[i].get(), bodies[j].get());
+		}
+	}
+	AssertHelper::assertUnsignedInt(pairContainer.getOverlappingPairs().size(), 60 * 59 / 2);
+
+	for(std::size_t i=0; i<bodies.size(); i+=2)
+	{
+		pairContainer.removeOverlappingPairs(bodies[i].get());
+	}
+	AssertHelper::assertUnsignedInt(pairContainer.getOverlappingPairs().size(), 30 * 29 / 2);
+
+	for(std::size_t i=1; i<bodies.size(); i+=2)
+	{
+		for(std::size_t j=i+2; j<bodies.size(); j+=2)
+		{
+			pairContainer.addOverlappingPair(bodies[j].get(), bodies[i].get()); //already existing pairs
+			pairContainer.removeOverlappingPair(bodies[i].get(), bodies[j].get());
+		}
+	}
+	AssertHelper::assertUnsignedInt(pairContainer.getOverlappingPairs().size(), 0);
+}
+
+CppUnit::Test *HashPairContainerTest::suite()
+{
+	auto *suite = new CppUnit::TestSuite("HashPairContainerTest");
+
+	suite->addTest(new CppUnit::TestCaller<HashPairContainerTest>("addSamePairTwice", &HashPairContainerTest::addSamePairTwice));
+	suite->addTest(new CppUnit::TestCaller<HashPairContainerTest>("removePair", &HashPairContainerTest::removePair));
+	suite->addTest(new CppUnit::TestCaller<HashPairContainerTest>("removeBodyPairs", &HashPairContainerTest::removeBodyPairs));
+	suite->addTest(new CppUnit::TestCaller<HashPairContainerTest>("manyPairs", &HashPairContainerTest::manyPairs));
+
+	return suite;
+}
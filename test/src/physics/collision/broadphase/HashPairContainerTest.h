@@ -0,0 +1,18 @@
+#ifndef URCHINENGINE_HASHPAIRCONTAINERTEST_H
+#define URCHINENGINE_HASHPAIRCONTAINERTEST_H
+
+#include <cppunit/TestFixture.h>
+#include <cppunit/Test.h>
+
+class HashPairContainerTest : public CppUnit::TestFixture
+{
+	public:
+		static CppUnit::Test *suite();
+
+		void addSamePairTwice();
+		void removePair();
+		void removeBodyPairs();
+		void manyPairs();
+};
+
+#endif
@@ -6,12 +6,34 @@
 #include "BodyAABBTreeTest.h"
 using namespace urchin;
 
+namespace
+{
+    class IdCollisionFilter : public CollisionFilter
+    {
+        public:
+            explicit IdCollisionFilter(std::string filteredBodyId) :
+                    filteredBodyId(std::move(filteredBodyId))
+            {
+
+            }
+
+            bool needCollision(const AbstractWorkBody *body1, const AbstractWorkBody *body2) const override
+            {
+                return body1->getId()!=filteredBodyId && body2->getId()!=filteredBodyId;
+            }
+
+        private:
+            std::string filteredBodyId;
+    };
+}
+
 void BodyAABBTreeTest::twoBodiesPairedAndRemove()
 {
     //add bodies test:
     std::shared_ptr<CollisionBoxShape> cubeShape = std::make_shared<CollisionBoxShape>(Vector3<float>(0.5f, 0.5f, 0.5f));
     auto bodyA = std::make_unique<WorkRigidBody>("bodyA", PhysicsTransform(Point3<float>(0.0f, 0.0f, 0.0f), Quaternion<float>()), cubeShape);
     auto bodyB = std::make_unique<WorkRigidBody>("bodyB", PhysicsTransform(Point3<float>(1.0f, 0.0f, 0.0f), Quaternion<float>()), cubeShape);
+    bodyB->setIsStatic(false);
     BodyAABBTree bodyAabbTree;
     bodyAabbTree.addBody(bodyA.get(), nullptr);
     bodyAabbTree.addBody(bodyB.get(), nullptr);
@@ -39,6 +61,63 @@ void BodyAABBTreeTest::twoBodiesNotPaired()
     AssertHelper::assertUnsignedInt(bodyAabbTree.getOverlappingPairs().size(), 0);
 }
 
+void BodyAABBTreeTest::twoStaticBodiesNotPaired()
+{
+    std::shared_ptr<CollisionBoxShape> cubeShape = std::make_shared<CollisionBoxShape>(Vector3<float>(0.5f, 0.5f, 0.5f));
+    auto bodyA = std::make_unique<WorkRigidBody>("bodyA", PhysicsTransform(Point3<float>(0.0f, 0.0f, 0.0f), Quaternion<float>()), cubeShape);
+    auto bodyB = std::make_unique<WorkRigidBody>("bodyB", PhysicsTransform(Point3<float>(1.0f, 0.0f, 0.0f), Quaternion<float>()), cubeShape);
+    BodyAABBTree bodyAabbTree;
+    bodyAabbTree.addBody(bodyA.get(), nullptr);
+    bodyAabbTree.addBody(bodyB.get(), nullptr);
+
+    AssertHelper::assertUnsignedInt(bodyAabbTree.getOverlappingPairs().size(), 0);
+}
+
+void BodyAABBTreeTest::staticBodyBecomesDynamic()
+{
+    std::shared_ptr<CollisionBoxShape> cubeShape = std::make_shared<CollisionBoxShape>(Vector3<float>(0.5f, 0.5f, 0.5f));
+    auto bodyA = std::make_unique<WorkRigidBody>("bodyA", PhysicsTransform(Point3<float>(0.0f, 0.0f, 0.0f), Quaternion<float>()), cubeShape);
+    auto bodyB = std::make_unique<WorkRigidBody>("bodyB", PhysicsTransform(Point3<float>(1.0f, 0.0f, 0.0f), Quaternion<float>()), cubeShape);
+    BodyAABBTree bodyAabbTree;
+    bodyAabbTree.addBody(bodyA.get(), nullptr);
+    bodyAabbTree.addBody(bodyB.get(), nullptr);
+
+    bodyB->setIsStatic(false);
+    bodyAabbTree.updateBodies();
+    AssertHelper::assertUnsignedInt(bodyAabbTree.getOverlappingPairs().size(), 1);
+
+    bodyB->setIsStatic(true);
+    bodyAabbTree.updateBodies();
+    AssertHelper::assertUnsignedInt(bodyAabbTree.getOverlappingPairs().size(), 0);
+}
+
+void BodyAABBTreeTest::removeStaticBodies()
+{
+    std::shared_ptr<CollisionBoxShape> cubeShape = std::make_shared<CollisionBoxShape>(Vector3<float>(0.5f, 0.5f, 0.5f));
+    auto staticBodyA = std::make_unique<WorkRigidBody>("staticBodyA", PhysicsTransform(Point3<float>(0.0f, 0.0f, 0.0f), Quaternion<float>()), cubeShape);
+    auto staticBodyB = std::make_unique<WorkRigidBody>("staticBodyB", PhysicsTransform(Point3<float>(0.9f, 0.0f, 0.0f), Quaternion<float>()), cubeShape);
+    auto staticBodyC = std::make_unique<WorkRigidBody>("staticBodyC", PhysicsTransform(Point3<float>(-0.9f, 0.0f, 0.0f), Quaternion<float>()), cubeShape);
+    auto dynamicBody = std::make_unique<WorkRigidBody>("dynamicBody", PhysicsTransform(Point3<float>(0.0f, 0.9f, 0.0f), Quaternion<float>()), cubeShape);
+    dynamicBody->setIsStatic(false);
+    BodyAABBTree bodyAabbTree;
+    bodyAabbTree.addBody(staticBodyA.get(), nullptr);
+    bodyAabbTree.addBody(staticBodyB.get(), nullptr);
+    bodyAabbTree.addBody(staticBodyC.get(), nullptr);
+    bodyAabbTree.addBody(dynamicBody.get(), nullptr);
+    AssertHelper::assertUnsignedInt(bodyAabbTree.getOverlappingPairs().size(), 3);
+
+    bodyAabbTree.removeBody(staticBodyA.get()); //last static body takes its place
+    AssertHelper::assertUnsignedInt(bodyAabbTree.getOverlappingPairs().size(), 2);
+    bodyAabbTree.removeBody(staticBodyC.get());
+    AssertHelper::assertUnsignedInt(bodyAabbTree.getOverlappingPairs().size(), 1);
+
+    staticBodyB->setIsStatic(false);
+    bodyAabbTree.updateBodies();
+    AssertHelper::assertUnsignedInt(bodyAabbTree.getOverlappingPairs().size(), 1);
+    bodyAabbTree.removeBody(staticBodyB.get());
+    AssertHelper::assertUnsignedInt(bodyAabbTree.getOverlappingPairs().size(), 0);
+}
+
 void BodyAABBTreeTest::oneBodyWithAlternativePairAndRemoveIt()
 {
     oneBodyWithAlternativePairAndRemove(true);
@@ -130,12 +209,60 @@ void BodyAABBTreeTest::threeBodiesPairedAndRemove()
     AssertHelper::assertUnsignedInt(bodyC->getPairContainer()->retrieveCopyOverlappingPairs().size(), 0);
 }
 
+void BodyAABBTreeTest::twoBodiesFilteredByCollisionMask()
+{
+    std::shared_ptr<CollisionBoxShape> cubeShape = std::make_shared<CollisionBoxShape>(Vector3<float>(0.5f, 0.5f, 0.5f));
+    auto bodyA = std::make_unique<WorkRigidBody>("bodyA", PhysicsTransform(Point3<float>(0.0f, 0.0f, 0.0f), Quaternion<float>()), cubeShape);
+    auto bodyB = std::make_unique<WorkRigidBody>("bodyB", PhysicsTransform(Point3<float>(1.0f, 0.0f, 0.0f), Quaternion<float>()), cubeShape);
+    auto bodyC = std::make_unique<WorkRigidBody>("bodyC", PhysicsTransform(Point3<float>(0.5f, 0.0f, 0.0f), Quaternion<float>()), cubeShape);
+    bodyA->setIsStatic(false);
+    bodyA->setCollisionGroup(2);
+    bodyA->setCollisionMask(~2u);
+    bodyB->setIsStatic(false);
+    bodyB->setCollisionGroup(2);
+    bodyB->setCollisionMask(~2u);
+    bodyC->setIsStatic(false);
+    BodyAABBTree bodyAabbTree;
+    bodyAabbTree.addBody(bodyA.get(), nullptr);
+    bodyAabbTree.addBody(bodyB.get(), nullptr);
+    bodyAabbTree.addBody(bodyC.get(), nullptr);
+
+    AssertHelper::assertUnsignedInt(bodyAabbTree.getOverlappingPairs().size(), 2);
+    for(const auto &overlappingPair : bodyAabbTree.getOverlappingPairs())
+    {
+        AssertHelper::assertTrue(overlappingPair->getBody1()->getId()=="bodyC" || overlappingPair->getBody2()->getId()=="bodyC", "Bodies of group 2 must not be paired");
+    }
+}
+
+void BodyAABBTreeTest::twoBodiesFilteredByCollisionFilter()
+{
+    std::shared_ptr<CollisionBoxShape> cubeShape = std::make_shared<CollisionBoxShape>(Vector3<float>(0.5f, 0.5f, 0.5f));
+    auto bodyA = std::make_unique<WorkRigidBody>("bodyA", PhysicsTransform(Point3<float>(0.0f, 0.0f, 0.0f), Quaternion<float>()), cubeShape);
+    auto bodyB = std::make_unique<WorkRigidBody>("bodyB", PhysicsTransform(Point3<float>(1.0f, 0.0f, 0.0f), Quaternion<float>()), cubeShape);
+    bodyB->setIsStatic(false);
+    BodyAABBTree bodyAabbTree;
+    bodyAabbTree.setCollisionFilter(std::make_shared<IdCollisionFilter>("bodyB"));
+    bodyAabbTree.addBody(bodyA.get(), nullptr);
+    bodyAabbTree.addBody(bodyB.get(), nullptr);
+
+    AssertHelper::assertUnsignedInt(bodyAabbTree.getOverlappingPairs().size(), 0);
+
+    std::vector<AbstractWorkBody *> bodiesHit;
+    bodyAabbTree.enlargedRayQuery(Ray<float>(Point3<float>(1.0f, 0.0f, 0.0f), Point3<float>(-1.0f, 0.0f, 0.0f)), 0.5f, bodyB.get(), bodiesHit);
+    AssertHelper::assertUnsignedInt(bodiesHit.size(), 0);
+}
+
 CppUnit::Test *BodyAABBTreeTest::suite()
 {
     auto *suite = new CppUnit::TestSuite("BodyAABBTreeTest");
 
     suite->addTest(new CppUnit::TestCaller<BodyAABBTreeTest>("twoBodiesPairedAndRemove", &BodyAABBTreeTest::twoBodiesPairedAndRemove));
     suite->addTest(new CppUnit::TestCaller<BodyAABBTreeTest>("twoBodiesNotPaired", &BodyAABBTreeTest::twoBodiesNotPaired));
+    suite->addTest(new CppUnit::TestCaller<BodyAABBTreeTest>("twoStaticBodiesNotPaired", &BodyAABBTreeTest::twoStaticBodiesNotPaired));
+    suite->addTest(new CppUnit::TestCaller<BodyAABBTreeTest>("staticBodyBecomesDynamic", &BodyAABBTreeTest::staticBodyBecomesDynamic));
+    suite->addTest(new CppUnit::TestCaller<BodyAABBTreeTest>("removeStaticBodies", &BodyAABBTreeTest::removeStaticBodies));
+    suite->addTest(new CppUnit::TestCaller<BodyAABBTreeTest>("twoBodiesFilteredByCollisionMask", &BodyAABBTreeTest::twoBodiesFilteredByCollisionMask));
+    suite->addTest(new CppUnit::TestCaller<BodyAABBTreeTest>("twoBodiesFilteredByCollisionFilter", &BodyAABBTreeTest::twoBodiesFilteredByCollisionFilter));
 
     suite->addTest(new CppUnit::TestCaller<BodyAABBTreeTest>("oneBodyWithAlternativePairAndRemoveIt", &BodyAABBTreeTest::oneBodyWithAlternativePairAndRemoveIt));
     suite->addTest(new CppUnit::TestCaller<BodyAABBTreeTest>("oneBodyWithAlternativePairAndRemoveOther", &BodyAABBTreeTest::oneBodyWithAlternativePairAndRemoveOther));
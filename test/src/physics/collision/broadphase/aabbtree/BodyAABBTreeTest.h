@@ -11,6 +11,11 @@ class BodyAABBTreeTest : public CppUnit::TestFixture
 
          void twoBodiesPairedAndRemove();
          void twoBodiesNotPaired();
+         void twoStaticBodiesNotPaired();
+         void staticBodyBecomesDynamic();
+         void removeStaticBodies();
+         void twoBodiesFilteredByCollisionMask();
+         void twoBodiesFilteredByCollisionFilter();
 
          void oneBodyWithAlternativePairAndRemoveIt();
          void oneBodyWithAlternativePairAndRemoveOther();
@@ -80,6 +80,51 @@ void IslandContainerTest::createTwoSeparateIslands()
 	delete bodies[0]; delete bodies[1]; delete bodies[2]; delete bodies[3];
 }
 
+/**
+ * Add incrementally 3 bodies where one body is added twice.
+ * Container should contain 3 elements.
+ */
+void IslandContainerTest::addSameElementTwice()
+{
+	TestBody* bodies[] = {new TestBody(), new TestBody(), new TestBody()};
+
+	IslandContainer islandContainer;
+	islandContainer.reset();
+	islandContainer.addElement(bodies[0]);
+	islandContainer.addElement(bodies[1]);
+	islandContainer.addElement(bodies[0]); //body 0 already added
+	islandContainer.addElement(bodies[2]);
+
+	AssertHelper::assertUnsignedInt(islandContainer.getSize(), 3);
+	AssertHelper::assertTrue(islandContainer.containsElement(bodies[0]));
+	AssertHelper::assertTrue(islandContainer.containsElement(bodies[2]));
+
+	delete bodies[0]; delete bodies[1]; delete bodies[2];
+}
+
+/**
+ * Create 4 bodies. Body 1 is in contact with a static element, body 0 is in contact with body 1 and body 2 is in contact with body 3.
+ * Only the island of body 0 and body 1 should be linked to a static element.
+ */
+void IslandContainerTest::linkMergedIslandToStaticElement()
+{
+	TestBody* bodies[] = {new TestBody(), new TestBody(), new TestBody(), new TestBody()};
+	std::vector<IslandElement *> bodiesVector(bodies, bodies + (sizeof(bodies) / sizeof(TestBody*)));
+
+	IslandContainer islandContainer;
+	islandContainer.reset(bodiesVector);
+	islandContainer.linkToStaticElement(bodies[1]); //body 1 is in contact with a static element
+	islandContainer.mergeIsland(bodies[1], bodies[0]); //body 1 is in contact with body 0
+	islandContainer.mergeIsland(bodies[2], bodies[3]); //body 2 is in contact with body 3
+	const std::vector<IslandElementLink> &islandElementsLink = islandContainer.retrieveIslandElements();
+
+	AssertHelper::assertUnsignedInt(islandElementsLink[0].islandIdRef, islandElementsLink[1].islandIdRef);
+	AssertHelper::assertTrue(islandElementsLink[islandElementsLink[0].islandIdRef].linkedToStaticElement);
+	AssertHelper::assertTrue(!islandElementsLink[islandElementsLink[2].islandIdRef].linkedToStaticElement);
+
+	delete bodies[0]; delete bodies[1]; delete bodies[2]; delete bodies[3];
+}
+
 CppUnit::Test *IslandContainerTest::suite()
 {
     auto *suite = new CppUnit::TestSuite("IslandContainerTest");
@@ -87,6 +132,8 @@ CppUnit::Test *IslandContainerTest::suite()
 	suite->addTest(new CppUnit::TestCaller<IslandContainerTest>("cascadeMergeIslands", &IslandContainerTest::cascadeMergeIslands));
 	suite->addTest(new CppUnit::TestCaller<IslandContainerTest>("mergeAllIslands", &IslandContainerTest::mergeAllIslands));
 	suite->addTest(new CppUnit::TestCaller<IslandContainerTest>("createTwoSeparateIslands", &IslandContainerTest::createTwoSeparateIslands));
+	suite->addTest(new CppUnit::TestCaller<IslandContainerTest>("addSameElementTwice", &IslandContainerTest::addSameElementTwice));
+	suite->addTest(new CppUnit::TestCaller<IslandContainerTest>("linkMergedIslandToStaticElement", &IslandContainerTest::linkMergedIslandToStaticElement));
 
 	return suite;
 }
@@ -15,6 +15,8 @@ class IslandContainerTest : public CppUnit::TestFixture
 		void cascadeMergeIslands();
 		void mergeAllIslands();
 		void createTwoSeparateIslands();
+		void addSameElementTwice();
+		void linkMergedIslandToStaticElement();
 };
 
 class TestBody : public urchin::IslandElement
@@ -36,7 +38,7 @@ class TestBody : public urchin::IslandElement
 		}
 
 	private:
-		unsigned int id;
+		unsigned int id = 0;
 };
 
 #endif
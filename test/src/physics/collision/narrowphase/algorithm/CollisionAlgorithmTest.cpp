@@ -0,0 +1,306 @@
+#include <cppunit/TestSuite.h>
+#include <cppunit/TestCaller.h>
+#include <cmath>
+#include "UrchinCommon.h"
+#include "UrchinPhysicsEngine.h"
+
+#include "AssertHelper.h"
+#include "physics/collision/narrowphase/algorithm/CollisionAlgorithmTest.h"
+#include "collision/narrowphase/algorithm/CompoundAnyCollisionAlgorithm.h"
+#include "statistics/ScopeThreadStatistics.h"
+using namespace urchin;
+
+namespace
+{
+	unsigned int countGjkProcesses(const PhysicsStatistics &statistics)
+	{
+		unsigned int gjkProcesses = 0;
+		for(unsigned int gjkIteration : statistics.gjkIterations)
+		{
+			gjkProcesses += gjkIteration;
+		}
+		return gjkProcesses;
+	}
+}
+
+void CollisionAlgorithmTest::boxOnBox()
+{
+	const ManifoldResult &manifoldResult = processAlgorithm(
+			std::make_shared<CollisionBoxShape>(Vector3<float>(0.5, 0.5, 0.5)), PhysicsTransform(Point3<float>(0.0, 0.99, 0.0)),
+			std::make_shared<CollisionBoxShape>(Vector3<float>(2.0, 0.5, 2.0)), PhysicsTransform(Point3<float>(0.0, 0.0, 0.0)));
+
+	AssertHelper::assertUnsignedInt(manifoldResult.getNumContactPoints(), 4);
+	for(unsigned int i=0; i<manifoldResult.getNumContactPoints(); ++i)
+	{
+		const ManifoldContactPoint &contactPoint = manifoldResult.getManifoldContactPoint(i);
+		AssertHelper::assertVector3FloatEquals(contactPoint.getNormalFromObject2(), Vector3<float>(0.0, 1.0, 0.0));
+		AssertHelper::assertFloatEquals(contactPoint.getDepth(), -0.01);
+		AssertHelper::assertFloatEquals(std::abs(contactPoint.getPointOnObject2().X), 0.5);
+		AssertHelper::assertFloatEquals(std::abs(contactPoint.getPointOnObject2().Z), 0.5);
+	}
+}
+
+void CollisionAlgorithmTest::rotatedBoxEdgeOnBox()
+{
+	float edgeHeight = 0.5f + 0.5f * std::sqrt(2.0f) - 0.01f;
+	const ManifoldResult &manifoldResult = processAlgorithm(
+			std::make_shared<CollisionBoxShape>(Vector3<float>(0.5, 0.5, 0.5)), PhysicsTransform(Point3<float>(0.0, edgeHeight, 0.0), Quaternion<float>(Vector3<float>(0.0, 0.0, 1.0), PI_VALUE/4)),
+			std::make_shared<CollisionBoxShape>(Vector3<float>(2.0, 0.5, 2.0)), PhysicsTransform(Point3<float>(0.0, 0.0, 0.0)));
+
+	AssertHelper::assertUnsignedInt(manifoldResult.getNumContactPoints(), 2);
+	for(unsigned int i=0; i<manifoldResult.getNumContactPoints(); ++i)
+	{
+		const ManifoldContactPoint &contactPoint = manifoldResult.getManifoldContactPoint(i);
+		AssertHelper::assertVector3FloatEquals(contactPoint.getNormalFromObject2(), Vector3<float>(0.0, 1.0, 0.0));
+		AssertHelper::assertFloatEquals(contactPoint.getDepth(), -0.01);
+		AssertHelper::assertFloatEquals(contactPoint.getPointOnObject2().X, 0.0);
+		AssertHelper::assertFloatEquals(std::abs(contactPoint.getPointOnObject2().Z), 0.5);
+	}
+}
+
+void CollisionAlgorithmTest::separatedBoxes()
+{
+	const ManifoldResult &manifoldResult = processAlgorithm(
+			std::make_shared<CollisionBoxShape>(Vector3<float>(0.5, 0.5, 0.5)), PhysicsTransform(Point3<float>(0.0, 2.0, 0.0)),
+			std::make_shared<CollisionBoxShape>(Vector3<float>(2.0, 0.5, 2.0)), PhysicsTransform(Point3<float>(0.0, 0.0, 0.0)));
+
+	AssertHelper::assertUnsignedInt(manifoldResult.getNumContactPoints(), 0);
+}
+
+void CollisionAlgorithmTest::separatedCylinderRejectedByCachedAxis()
+{
+	auto cylinderShape = std::make_shared<CollisionCylinderShape>(0.5, 1.0, CylinderShape<float>::CYLINDER_Y);
+	auto boxShape = std::make_shared<CollisionBoxShape>(Vector3<float>(2.0, 0.5, 2.0));
+	PhysicsTransform boxTransform(Point3<float>(0.0, 0.0, 0.0));
+	createAlgorithm(cylinderShape, PhysicsTransform(Point3<float>(0.0, 3.0, 0.0)), boxShape, boxTransform);
+	PhysicsStatistics statistics;
+	ScopeThreadStatistics scopeStatistics(&statistics);
+
+	collisionAlgorithm->processCollisionAlgorithm(CollisionObjectWrapper(*cylinderShape, PhysicsTransform(Point3<float>(0.0, 3.0, 0.0))), CollisionObjectWrapper(*boxShape, boxTransform), false);
+	AssertHelper::assertUnsignedInt(collisionAlgorithm->getConstManifoldResult().getNumContactPoints(), 0);
+	AssertHelper::assertUnsignedInt(countGjkProcesses(statistics), 1);
+
+	collisionAlgorithm->processCollisionAlgorithm(CollisionObjectWrapper(*cylinderShape, PhysicsTransform(Point3<float>(0.1, 2.9, 0.0))), CollisionObjectWrapper(*boxShape, boxTransform), false);
+	AssertHelper::assertUnsignedInt(collisionAlgorithm->getConstManifoldResult().getNumContactPoints(), 0);
+	AssertHelper::assertUnsignedInt(countGjkProcesses(statistics), 1); //rejected by the cached separating axis
+}
+
+void CollisionAlgorithmTest::cylinderMovedIntoContactAfterSeparation()
+{
+	auto cylinderShape = std::make_shared<CollisionCylinderShape>(0.5, 1.0, CylinderShape<float>::CYLINDER_Y);
+	auto boxShape = std::make_shared<CollisionBoxShape>(Vector3<float>(2.0, 0.5, 2.0));
+	PhysicsTransform boxTransform(Point3<float>(0.0, 0.0, 0.0));
+	createAlgorithm(cylinderShape, PhysicsTransform(Point3<float>(0.0, 3.0, 0.0)), boxShape, boxTransform);
+	PhysicsStatistics statistics;
+	ScopeThreadStatistics scopeStatistics(&statistics);
+
+	collisionAlgorithm->processCollisionAlgorithm(CollisionObjectWrapper(*cylinderShape, PhysicsTransform(Point3<float>(0.0, 3.0, 0.0))), CollisionObjectWrapper(*boxShape, boxTransform), false);
+	AssertHelper::assertUnsignedInt(collisionAlgorithm->getConstManifoldResult().getNumContactPoints(), 0);
+
+	collisionAlgorithm->processCollisionAlgorithm(CollisionObjectWrapper(*cylinderShape, PhysicsTransform(Point3<float>(0.0, 0.99, 0.0))), CollisionObjectWrapper(*boxShape, boxTransform), false);
+	AssertHelper::assertTrue(countGjkProcesses(statistics) >= 2, "GJK must be processed once the cached axis doesn't separate the objects anymore");
+	const ManifoldResult &manifoldResult = collisionAlgorithm->getConstManifoldResult();
+	AssertHelper::assertUnsignedInt(manifoldResult.getNumContactPoints(), 1);
+	AssertHelper::assertVector3FloatEquals(manifoldResult.getManifoldContactPoint(0).getNormalFromObject2(), Vector3<float>(0.0, 1.0, 0.0));
+	AssertHelper::assertFloatEquals(manifoldResult.getManifoldContactPoint(0).getDepth(), -0.01);
+}
+
+void CollisionAlgorithmTest::parallelCapsules()
+{
+	const ManifoldResult &manifoldResult = processAlgorithm(
+			std::make_shared<CollisionCapsuleShape>(0.5, 2.0, CapsuleShape<float>::CAPSULE_X), PhysicsTransform(Point3<float>(0.5, 0.99, 0.0)),
+			std::make_shared<CollisionCapsuleShape>(0.5, 2.0, CapsuleShape<float>::CAPSULE_X), PhysicsTransform(Point3<float>(0.0, 0.0, 0.0)));
+
+	AssertHelper::assertUnsignedInt(manifoldResult.getNumContactPoints(), 2);
+	for(unsigned int i=0; i<manifoldResult.getNumContactPoints(); ++i)
+	{
+		const ManifoldContactPoint &contactPoint = manifoldResult.getManifoldContactPoint(i);
+		AssertHelper::assertVector3FloatEquals(contactPoint.getNormalFromObject2(), Vector3<float>(0.0, 1.0, 0.0));
+		AssertHelper::assertFloatEquals(contactPoint.getDepth(), -0.01);
+		AssertHelper::assertFloatEquals(contactPoint.getPointOnObject2().Y, 0.5);
+	}
+	float minX = std::min(manifoldResult.getManifoldContactPoint(0).getPointOnObject2().X, manifoldResult.getManifoldContactPoint(1).getPointOnObject2().X);
+	float maxX = std::max(manifoldResult.getManifoldContactPoint(0).getPointOnObject2().X, manifoldResult.getManifoldContactPoint(1).getPointOnObject2().X);
+	AssertHelper::assertFloatEquals(minX, -0.5);
+	AssertHelper::assertFloatEquals(maxX, 1.0);
+}
+
+void CollisionAlgorithmTest::crossedCapsules()
+{
+	const ManifoldResult &manifoldResult = processAlgorithm(
+			std::make_shared<CollisionCapsuleShape>(0.5, 2.0, CapsuleShape<float>::CAPSULE_X), PhysicsTransform(Point3<float>(0.0, 0.99, 0.0)),
+			std::make_shared<CollisionCapsuleShape>(0.5, 2.0, CapsuleShape<float>::CAPSULE_Z), PhysicsTransform(Point3<float>(0.0, 0.0, 0.0)));
+
+	AssertHelper::assertUnsignedInt(manifoldResult.getNumContactPoints(), 1);
+	AssertHelper::assertVector3FloatEquals(manifoldResult.getManifoldContactPoint(0).getNormalFromObject2(), Vector3<float>(0.0, 1.0, 0.0));
+	AssertHelper::assertFloatEquals(manifoldResult.getManifoldContactPoint(0).getDepth(), -0.01);
+	AssertHelper::assertPoint3FloatEquals(manifoldResult.getManifoldContactPoint(0).getPointOnObject2(), Point3<float>(0.0, 0.5, 0.0));
+}
+
+void CollisionAlgorithmTest::crossedCenteredCapsules()
+{
+	const ManifoldResult &manifoldResult = processAlgorithm(
+			std::make_shared<CollisionCapsuleShape>(0.5, 2.0, CapsuleShape<float>::CAPSULE_X), PhysicsTransform(Point3<float>(0.0, 0.0, 0.0)),
+			std::make_shared<CollisionCapsuleShape>(0.5, 2.0, CapsuleShape<float>::CAPSULE_Z), PhysicsTransform(Point3<float>(0.0, 0.0, 0.0)));
+
+	AssertHelper::assertUnsignedInt(manifoldResult.getNumContactPoints(), 1);
+	AssertHelper::assertVector3FloatEquals(manifoldResult.getManifoldContactPoint(0).getNormalFromObject2(), Vector3<float>(0.0, 1.0, 0.0));
+	AssertHelper::assertFloatEquals(manifoldResult.getManifoldContactPoint(0).getDepth(), -1.0);
+
+	//same capsules with reversed segment: same normal expected
+	const ManifoldResult &reversedManifoldResult = processAlgorithm(
+			std::make_shared<CollisionCapsuleShape>(0.5, 2.0, CapsuleShape<float>::CAPSULE_X), PhysicsTransform(Point3<float>(0.0, 0.0, 0.0), Quaternion<float>(Vector3<float>(0.0, 1.0, 0.0), PI_VALUE)),
+			std::make_shared<CollisionCapsuleShape>(0.5, 2.0, CapsuleShape<float>::CAPSULE_Z), PhysicsTransform(Point3<float>(0.0, 0.0, 0.0)));
+
+	AssertHelper::assertUnsignedInt(reversedManifoldResult.getNumContactPoints(), 1);
+	AssertHelper::assertVector3FloatEquals(reversedManifoldResult.getManifoldContactPoint(0).getNormalFromObject2(), Vector3<float>(0.0, 1.0, 0.0));
+}
+
+void CollisionAlgorithmTest::colinearCapsules()
+{
+	const ManifoldResult &manifoldResult = processAlgorithm(
+			std::make_shared<CollisionCapsuleShape>(0.5, 2.0, CapsuleShape<float>::CAPSULE_X), PhysicsTransform(Point3<float>(0.5, 0.0, 0.0)),
+			std::make_shared<CollisionCapsuleShape>(0.5, 2.0, CapsuleShape<float>::CAPSULE_X), PhysicsTransform(Point3<float>(0.0, 0.0, 0.0)));
+
+	AssertHelper::assertUnsignedInt(manifoldResult.getNumContactPoints(), 2);
+	for(unsigned int i=0; i<manifoldResult.getNumContactPoints(); ++i)
+	{ //normal oriented from the center of capsule 2 to the center of capsule 1
+		AssertHelper::assertVector3FloatEquals(manifoldResult.getManifoldContactPoint(i).getNormalFromObject2(), Vector3<float>(1.0, 0.0, 0.0));
+	}
+}
+
+void CollisionAlgorithmTest::capsuleOnBox()
+{
+	const ManifoldResult &manifoldResult = processAlgorithm(
+			std::make_shared<CollisionCapsuleShape>(0.5, 2.0, CapsuleShape<float>::CAPSULE_X), PhysicsTransform(Point3<float>(0.0, 0.99, 0.0)),
+			std::make_shared<CollisionBoxShape>(Vector3<float>(2.0, 0.5, 2.0)), PhysicsTransform(Point3<float>(0.0, 0.0, 0.0)));
+
+	AssertHelper::assertUnsignedInt(manifoldResult.getNumContactPoints(), 2);
+	for(unsigned int i=0; i<manifoldResult.getNumContactPoints(); ++i)
+	{
+		const ManifoldContactPoint &contactPoint = manifoldResult.getManifoldContactPoint(i);
+		AssertHelper::assertVector3FloatEquals(contactPoint.getNormalFromObject2(), Vector3<float>(0.0, 1.0, 0.0));
+		AssertHelper::assertFloatEquals(contactPoint.getDepth(), -0.01);
+		AssertHelper::assertFloatEquals(std::abs(contactPoint.getPointOnObject2().X), 1.0);
+		AssertHelper::assertFloatEquals(contactPoint.getPointOnObject2().Y, 0.5);
+	}
+}
+
+void CollisionAlgorithmTest::capsuleIntoBox()
+{
+	const ManifoldResult &manifoldResult = processAlgorithm(
+			std::make_shared<CollisionCapsuleShape>(0.5, 2.0, CapsuleShape<float>::CAPSULE_Y), PhysicsTransform(Point3<float>(0.0, 0.5, 0.0)),
+			std::make_shared<CollisionBoxShape>(Vector3<float>(2.0, 0.5, 2.0)), PhysicsTransform(Point3<float>(0.0, 0.0, 0.0)));
+
+	AssertHelper::assertUnsignedInt(manifoldResult.getNumContactPoints(), 1);
+	AssertHelper::assertVector3FloatEquals(manifoldResult.getManifoldContactPoint(0).getNormalFromObject2(), Vector3<float>(0.0, 1.0, 0.0));
+	AssertHelper::assertFloatEquals(manifoldResult.getManifoldContactPoint(0).getDepth(), -1.5);
+	AssertHelper::assertPoint3FloatEquals(manifoldResult.getManifoldContactPoint(0).getPointOnObject2(), Point3<float>(0.0, 0.5, 0.0));
+}
+
+void CollisionAlgorithmTest::boxUnderCapsule()
+{
+	const ManifoldResult &manifoldResult = processAlgorithm(
+			std::make_shared<CollisionBoxShape>(Vector3<float>(2.0, 0.5, 2.0)), PhysicsTransform(Point3<float>(0.0, 0.0, 0.0)),
+			std::make_shared<CollisionCapsuleShape>(0.5, 2.0, CapsuleShape<float>::CAPSULE_X), PhysicsTransform(Point3<float>(0.0, 0.99, 0.0)));
+
+	AssertHelper::assertTrue(collisionAlgorithm->isObjectSwapped(), "Capsule must be the first object of the algorithm");
+	AssertHelper::assertTrue(manifoldResult.getBody1()==body2.get(), "Capsule must be the first body of the manifold result");
+	AssertHelper::assertUnsignedInt(manifoldResult.getNumContactPoints(), 2);
+	AssertHelper::assertVector3FloatEquals(manifoldResult.getManifoldContactPoint(0).getNormalFromObject2(), Vector3<float>(0.0, 1.0, 0.0));
+}
+
+void CollisionAlgorithmTest::compoundChildAlgorithmsAcrossFrames()
+{
+	std::vector<std::shared_ptr<const LocalizedCollisionShape>> localizedShapes;
+	for(std::size_t i=0; i<2; ++i)
+	{ //boxes aligned on X axis: [-0.5+3i, 0.5+3i]
+		auto localizedShape = std::make_shared<LocalizedCollisionShape>();
+		localizedShape->position = i;
+		localizedShape->shape = std::make_shared<CollisionBoxShape>(Vector3<float>(0.5, 0.5, 0.5));
+		localizedShape->transform = PhysicsTransform(Point3<float>(static_cast<float>(i) * 3.0f, 0.0, 0.0));
+		localizedShapes.push_back(localizedShape);
+	}
+	auto compoundShape = std::make_shared<CollisionCompoundShape>(localizedShapes);
+	auto boxShape = std::make_shared<CollisionBoxShape>(Vector3<float>(0.5, 0.5, 0.5));
+	PhysicsTransform compoundTransform(Point3<float>(0.0, 0.0, 0.0));
+
+	collisionAlgorithm.reset(); //algorithm must be released before its selector
+	collisionAlgorithmSelector = std::make_unique<CollisionAlgorithmSelector>();
+	body1 = std::make_unique<WorkRigidBody>("body1", compoundTransform, compoundShape);
+	body2 = std::make_unique<WorkRigidBody>("body2", PhysicsTransform(Point3<float>(0.0, 0.99, 0.0)), boxShape);
+	collisionAlgorithm = collisionAlgorithmSelector->createCollisionAlgorithm(body1.get(), compoundShape.get(), body2.get(), boxShape.get());
+	const auto *compoundAlgorithm = dynamic_cast<const CompoundAnyCollisionAlgorithm *>(collisionAlgorithm.get());
+	AssertHelper::assertTrue(compoundAlgorithm != nullptr, "Compound algorithm expected");
+
+	//frame 1: box on first child
+	collisionAlgorithm->processCollisionAlgorithm(CollisionObjectWrapper(*compoundShape, compoundTransform),
+			CollisionObjectWrapper(*boxShape, PhysicsTransform(Point3<float>(0.0, 0.99, 0.0))), false);
+	const CollisionAlgorithm *firstChildAlgorithm = compoundAlgorithm->getLocalizedShapeAlgorithm(0);
+	AssertHelper::assertTrue(firstChildAlgorithm != nullptr, "Algorithm of overlapping child must be created");
+	AssertHelper::assertTrue(compoundAlgorithm->getLocalizedShapeAlgorithm(1) == nullptr, "Algorithm of non-overlapping child must not be created");
+	AssertHelper::assertUnsignedInt(collisionAlgorithm->getConstManifoldResult().getNumContactPoints(), 4);
+
+	//frame 2: box still on first child
+	collisionAlgorithm->processCollisionAlgorithm(CollisionObjectWrapper(*compoundShape, compoundTransform),
+			CollisionObjectWrapper(*boxShape, PhysicsTransform(Point3<float>(0.1, 0.99, 0.0))), false);
+	AssertHelper::assertTrue(compoundAlgorithm->getLocalizedShapeAlgorithm(0) == firstChildAlgorithm, "Algorithm of child still overlapping must be kept");
+	AssertHelper::assertTrue(compoundAlgorithm->getLocalizedShapeAlgorithm(1) == nullptr, "Algorithm of non-overlapping child must not be created");
+
+	//frame 3: box moved on second child
+	collisionAlgorithm->processCollisionAlgorithm(CollisionObjectWrapper(*compoundShape, compoundTransform),
+			CollisionObjectWrapper(*boxShape, PhysicsTransform(Point3<float>(3.0, 0.99, 0.0))), false);
+	AssertHelper::assertTrue(compoundAlgorithm->getLocalizedShapeAlgorithm(0) == nullptr, "Algorithm of child not overlapping anymore must be released");
+	AssertHelper::assertTrue(compoundAlgorithm->getLocalizedShapeAlgorithm(1) != nullptr, "Algorithm of overlapping child must be created");
+
+	//frame 4: box away from the compound shape
+	collisionAlgorithm->processCollisionAlgorithm(CollisionObjectWrapper(*compoundShape, compoundTransform),
+			CollisionObjectWrapper(*boxShape, PhysicsTransform(Point3<float>(10.0, 5.0, 0.0))), false);
+	AssertHelper::assertTrue(compoundAlgorithm->getLocalizedShapeAlgorithm(0) == nullptr, "Algorithm of non-overlapping child must be released");
+	AssertHelper::assertTrue(compoundAlgorithm->getLocalizedShapeAlgorithm(1) == nullptr, "Algorithm of non-overlapping child must be released");
+}
+
+void CollisionAlgorithmTest::createAlgorithm(const std::shared_ptr<CollisionShape3D> &shape1, const PhysicsTransform &transform1,
+		const std::shared_ptr<CollisionShape3D> &shape2, const PhysicsTransform &transform2)
+{
+	collisionAlgorithm.reset(); //algorithm must be released before its selector
+	collisionAlgorithmSelector = std::make_unique<CollisionAlgorithmSelector>();
+	body1 = std::make_unique<WorkRigidBody>("body1", transform1, shape1);
+	body2 = std::make_unique<WorkRigidBody>("body2", transform2, shape2);
+
+	collisionAlgorithm = collisionAlgorithmSelector->createCollisionAlgorithm(body1.get(), shape1.get(), body2.get(), shape2.get());
+}
+
+const ManifoldResult &CollisionAlgorithmTest::processAlgorithm(const std::shared_ptr<CollisionShape3D> &shape1, const PhysicsTransform &transform1,
+		const std::shared_ptr<CollisionShape3D> &shape2, const PhysicsTransform &transform2)
+{
+	createAlgorithm(shape1, transform1, shape2, transform2);
+	collisionAlgorithm->processCollisionAlgorithm(CollisionObjectWrapper(*shape1, transform1), CollisionObjectWrapper(*shape2, transform2), false);
+
+	return collisionAlgorithm->getConstManifoldResult();
+}
+
+CppUnit::Test *CollisionAlgorithmTest::suite()
+{
+	auto *suite = new CppUnit::TestSuite("CollisionAlgorithmTest");
+
+	suite->addTest(new CppUnit::TestCaller<CollisionAlgorithmTest>("boxOnBox", &CollisionAlgorithmTest::boxOnBox));
+	suite->addTest(new CppUnit::TestCaller<CollisionAlgorithmTest>("rotatedBoxEdgeOnBox", &CollisionAlgorithmTest::rotatedBoxEdgeOnBox));
+	suite->addTest(new CppUnit::TestCaller<CollisionAlgorithmTest>("separatedBoxes", &CollisionAlgorithmTest::separatedBoxes));
+
+	suite->addTest(new CppUnit::TestCaller<CollisionAlgorithmTest>("separatedCylinderRejectedByCachedAxis", &CollisionAlgorithmTest::separatedCylinderRejectedByCachedAxis));
+	suite->addTest(new CppUnit::TestCaller<CollisionAlgorithmTest>("cylinderMovedIntoContactAfterSeparation", &CollisionAlgorithmTest::cylinderMovedIntoContactAfterSeparation));
+
+	suite->addTest(new CppUnit::TestCaller<CollisionAlgorithmTest>("parallelCapsules", &CollisionAlgorithmTest::parallelCapsules));
+	suite->addTest(new CppUnit::TestCaller<CollisionAlgorithmTest>("crossedCapsules", &CollisionAlgorithmTest::crossedCapsules));
+	suite->addTest(new CppUnit::TestCaller<CollisionAlgorithmTest>("crossedCenteredCapsules", &CollisionAlgorithmTest::crossedCenteredCapsules));
+	suite->addTest(new CppUnit::TestCaller<CollisionAlgorithmTest>("colinearCapsules", &CollisionAlgorithmTest::colinearCapsules));
+
+	suite->addTest(new CppUnit::TestCaller<CollisionAlgorithmTest>("capsuleOnBox", &CollisionAlgorithmTest::capsuleOnBox));
+	suite->addTest(new CppUnit::TestCaller<CollisionAlgorithmTest>("capsuleIntoBox", &CollisionAlgorithmTest::capsuleIntoBox));
+	suite->addTest(new CppUnit::TestCaller<CollisionAlgorithmTest>("boxUnderCapsule", &CollisionAlgorithmTest::boxUnderCapsule));
+
+	suite->addTest(new CppUnit::TestCaller<CollisionAlgorithmTest>("compoundChildAlgorithmsAcrossFrames", &CollisionAlgorithmTest::compoundChildAlgorithmsAcrossFrames));
+
+	return suite;
+}
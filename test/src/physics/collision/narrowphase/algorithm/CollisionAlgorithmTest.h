@@ -0,0 +1,44 @@
+#ifndef URCHINENGINE_COLLISIONALGORITHMTEST_H
+#define URCHINENGINE_COLLISIONALGORITHMTEST_H
+
+#include <cppunit/TestFixture.h>
+#include <cppunit/Test.h>
+#include <memory>
+#include "UrchinPhysicsEngine.h"
+#include "collision/narrowphase/algorithm/CollisionAlgorithmSelector.h"
+
+class CollisionAlgorithmTest : public CppUnit::TestFixture
+{
+	public:
+		static CppUnit::Test *suite();
+
+		void boxOnBox();
+		void rotatedBoxEdgeOnBox();
+		void separatedBoxes();
+
+		void separatedCylinderRejectedByCachedAxis();
+		void cylinderMovedIntoContactAfterSeparation();
+
+		void parallelCapsules();
+		void crossedCapsules();
+		void crossedCenteredCapsules();
+		void colinearCapsules();
+
+		void capsuleOnBox();
+		void capsuleIntoBox();
+		void boxUnderCapsule();
+
+		void compoundChildAlgorithmsAcrossFrames();
+
+	private:
+		void createAlgorithm(const std::shared_ptr<urchin::CollisionShape3D> &, const urchin::PhysicsTransform &,
+				const std::shared_ptr<urchin::CollisionShape3D> &, const urchin::PhysicsTransform &);
+		const urchin::ManifoldResult &processAlgorithm(const std::shared_ptr<urchin::CollisionShape3D> &, const urchin::PhysicsTransform &,
+				const std::shared_ptr<urchin::CollisionShape3D> &, const urchin::PhysicsTransform &);
+
+		std::unique_ptr<urchin::CollisionAlgorithmSelector> collisionAlgorithmSelector;
+		std::unique_ptr<urchin::WorkRigidBody> body1, body2;
+		urchin::IntrusivePtr<urchin::CollisionAlgorithm> collisionAlgorithm;
+};
+
+#endif
@@ -41,12 +41,26 @@ void EPASphereTest::overlapSphere()
 	AssertHelper::assertFloatEquals(resultEpa->getContactPointB().Z, 0.0);
 }
 
+void EPASphereTest::deepOverlapSphere()
+{
+	CollisionSphereObject sphere1(1.0, Point3<float>(0.0, 0.0, 0.0));
+	CollisionSphereObject sphere2(1.0, Point3<float>(0.2, 0.0, 0.0));
+
+	std::shared_ptr<EPAResult<float>> resultEpa = EPATestHelper::executeEPA(sphere1, sphere2);
+
+	float epsilon = 0.3f; //high epsilon used because curved shapes are very bad case for EPA
+	AssertHelper::assertTrue(resultEpa->isCollide());
+	AssertHelper::assertFloatEquals(resultEpa->getPenetrationDepth(), 1.8, epsilon);
+	AssertHelper::assertFloatEquals(resultEpa->getContactPointA().vector(resultEpa->getContactPointB()).length(), 1.8, epsilon);
+}
+
 CppUnit::Test *EPASphereTest::suite()
 {
     auto *suite = new CppUnit::TestSuite("EPASphereTest");
 
 	suite->addTest(new CppUnit::TestCaller<EPASphereTest>("identicalSphere", &EPASphereTest::identicalSphere));
 	suite->addTest(new CppUnit::TestCaller<EPASphereTest>("overlapSphere", &EPASphereTest::overlapSphere));
+	suite->addTest(new CppUnit::TestCaller<EPASphereTest>("deepOverlapSphere", &EPASphereTest::deepOverlapSphere));
 
 	return suite;
 }
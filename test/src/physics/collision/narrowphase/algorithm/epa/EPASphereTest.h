@@ -11,6 +11,7 @@ class EPASphereTest : public CppUnit::TestFixture
 
 		void identicalSphere();
 		void overlapSphere();
+		void deepOverlapSphere();
 };
 
 #endif
@@ -23,8 +23,8 @@ void GJKConvexHullTest::identicalBox()
 	};
 	std::vector<Point3<float>> obbPoints2(obbPointsTab2, obbPointsTab2+sizeof(obbPointsTab2)/sizeof(Point3<float>));
 
-	CollisionConvexHullObject ch1(0.0, obbPoints1, obbPoints1);
-	CollisionConvexHullObject ch2(0.0, obbPoints2, obbPoints2);
+	StandaloneConvexHullObject ch1(0.0, obbPoints1, obbPoints1);
+	StandaloneConvexHullObject ch2(0.0, obbPoints2, obbPoints2);
 	std::shared_ptr<GJKResult<float>> result = GJKTestHelper::executeGJK(ch1, ch2);
 
 	AssertHelper::assertTrue(result->isCollide());
@@ -44,8 +44,8 @@ void GJKConvexHullTest::separateBox()
 	};
 	std::vector<Point3<float>> obbPoints(obbPointsTab, obbPointsTab+sizeof(obbPointsTab)/sizeof(Point3<float>));
 
-	CollisionConvexHullObject ch1(0.0, aabbPoints, aabbPoints);
-	CollisionConvexHullObject ch2(0.0, obbPoints, obbPoints);
+	StandaloneConvexHullObject ch1(0.0, aabbPoints, aabbPoints);
+	StandaloneConvexHullObject ch2(0.0, obbPoints, obbPoints);
 	std::shared_ptr<GJKResult<float>> result = GJKTestHelper::executeGJK(ch1, ch2);
 
 	AssertHelper::assertTrue(!result->isCollide());
@@ -71,8 +71,8 @@ void GJKConvexHullTest::cornerInsideBox()
 	};
 	std::vector<Point3<float>> obbPoints(obbPointsTab, obbPointsTab+sizeof(obbPointsTab)/sizeof(Point3<float>));
 
-	CollisionConvexHullObject ch1(0.0, aabbPoints, aabbPoints);
-	CollisionConvexHullObject ch2(0.0, obbPoints, obbPoints);
+	StandaloneConvexHullObject ch1(0.0, aabbPoints, aabbPoints);
+	StandaloneConvexHullObject ch2(0.0, obbPoints, obbPoints);
 	std::shared_ptr<GJKResult<float>> result = GJKTestHelper::executeGJK(ch1, ch2);
 
 	AssertHelper::assertTrue(result->isCollide());
@@ -92,8 +92,8 @@ void GJKConvexHullTest::faceInsideTrapeze()
 	};
 	std::vector<Point3<float>> trapezePoints2(trapezePointsTab2, trapezePointsTab2+sizeof(trapezePointsTab2)/sizeof(Point3<float>));
 
-	CollisionConvexHullObject ch1(0.0, trapezePoints1, trapezePoints1);
-	CollisionConvexHullObject ch2(0.0, trapezePoints2, trapezePoints2);
+	StandaloneConvexHullObject ch1(0.0, trapezePoints1, trapezePoints1);
+	StandaloneConvexHullObject ch2(0.0, trapezePoints2, trapezePoints2);
 	std::shared_ptr<GJKResult<float>> result = GJKTestHelper::executeGJK(ch1, ch2);
 
 	AssertHelper::assertTrue(result->isCollide());
@@ -113,8 +113,8 @@ void GJKConvexHullTest::separateHexagon()
 	};
 	std::vector<Point3<float>> hexagonPoints2(hexagonPointsTab2, hexagonPointsTab2+sizeof(hexagonPointsTab2)/sizeof(Point3<float>));
 
-	CollisionConvexHullObject ch1(0.0, hexagonPoints1, hexagonPoints1);
-	CollisionConvexHullObject ch2(0.0, hexagonPoints2, hexagonPoints2);
+	StandaloneConvexHullObject ch1(0.0, hexagonPoints1, hexagonPoints1);
+	StandaloneConvexHullObject ch2(0.0, hexagonPoints2, hexagonPoints2);
 	std::shared_ptr<GJKResult<float>> result = GJKTestHelper::executeGJK(ch1, ch2);
 
 	AssertHelper::assertTrue(!result->isCollide());
@@ -140,8 +140,8 @@ void GJKConvexHullTest::cornerInsideHexagon()
 	};
 	std::vector<Point3<float>> hexagonPoints2(hexagonPointsTab2, hexagonPointsTab2+sizeof(hexagonPointsTab2)/sizeof(Point3<float>));
 
-	CollisionConvexHullObject ch1(0.0, hexagonPoints1, hexagonPoints1);
-	CollisionConvexHullObject ch2(0.0, hexagonPoints2, hexagonPoints2);
+	StandaloneConvexHullObject ch1(0.0, hexagonPoints1, hexagonPoints1);
+	StandaloneConvexHullObject ch2(0.0, hexagonPoints2, hexagonPoints2);
 	std::shared_ptr<GJKResult<float>> result = GJKTestHelper::executeGJK(ch1, ch2);
 
 	AssertHelper::assertTrue(result->isCollide());
@@ -0,0 +1,76 @@
+#include <cppunit/TestSuite.h>
+#include <cppunit/TestCaller.h>
+#include <memory>
+
+#include "physics/it/BatchQueryIT.h"
+#include "AssertHelper.h"
+#include "UrchinPhysicsEngine.h"
+using namespace urchin;
+
+void BatchQueryIT::synchronousRayAndSweepTests()
+{
+    auto *physicsWorld = new PhysicsWorld();
+    std::shared_ptr<CollisionBoxShape> planeShape = std::make_shared<CollisionBoxShape>(Vector3<float>(1000.0f, 0.5f, 1000.0f));
+    physicsWorld->addBody(new RigidBody("plane", Transform<float>(Point3<float>(0.0f, -0.5f, 0.0f), Quaternion<float>(), 1.0f), planeShape));
+    std::shared_ptr<CollisionBoxShape> cubeShape = std::make_shared<CollisionBoxShape>(Vector3<float>(0.5f, 0.5f, 0.5f));
+    physicsWorld->addBody(new RigidBody("cube", Transform<float>(Point3<float>(0.0f, 0.5f, 0.0f), Quaternion<float>(), 1.0f), cubeShape));
+    physicsWorld->getCollisionWorld()->process(1.0f / 60.0f, Vector3<float>(0.0f, -9.81f, 0.0f));
+
+    BatchQuery batchQuery;
+    unsigned int rayOnCube = batchQuery.addRayTest(Ray<float>(Point3<float>(0.0f, 10.0f, 0.0f), Point3<float>(0.0f, -10.0f, 0.0f)));
+    unsigned int rayOnPlane = batchQuery.addRayTest(Ray<float>(Point3<float>(50.0f, 10.0f, 0.0f), Point3<float>(50.0f, -10.0f, 0.0f)));
+    unsigned int rayInAir = batchQuery.addRayTest(Ray<float>(Point3<float>(-10.0f, 20.0f, 0.0f), Point3<float>(10.0f, 20.0f, 0.0f)));
+    unsigned int sphereSweepOnCube = batchQuery.addSweepTest(std::make_shared<CollisionSphereShape>(0.5f),
+            PhysicsTransform(Point3<float>(-10.0f, 0.5f, 0.0f)), PhysicsTransform(Point3<float>(10.0f, 0.5f, 0.0f)));
+    std::shared_ptr<const BatchQueryResult> batchQueryResult = physicsWorld->synchronousBatchQueryTest(batchQuery);
+
+    AssertHelper::assertTrue(batchQueryResult->isResultReady());
+    AssertHelper::assertUnsignedInt(batchQueryResult->getNumberOfResults(), 4);
+    AssertHelper::assertString(batchQueryResult->getNearestResult(rayOnCube)->getBody2()->getId(), "cube");
+    AssertHelper::assertFloatEquals(batchQueryResult->getNearestResult(rayOnCube)->getHitPointOnObject2().Y, 1.0f, 0.01f);
+    AssertHelper::assertString(batchQueryResult->getNearestResult(rayOnPlane)->getBody2()->getId(), "plane");
+    AssertHelper::assertTrue(!batchQueryResult->hasHit(rayInAir));
+    AssertHelper::assertString(batchQueryResult->getNearestResult(sphereSweepOnCube)->getBody2()->getId(), "cube");
+
+    delete physicsWorld;
+}
+
+void BatchQueryIT::closestHitRayTestOnHeightfield()
+{
+    auto *physicsWorld = new PhysicsWorld();
+    std::vector<Point3<float>> vertices;
+    for(unsigned int z=0; z<33; ++z)
+    {
+        for(unsigned int x=0; x<33; ++x)
+        { //flat ground with a bump at (8, 2, 8)
+            float height = (x==24 && z==24) ? 2.0f : 0.0f;
+            vertices.emplace_back(Point3<float>(static_cast<float>(x) - 16.0f, height, static_cast<float>(z) - 16.0f));
+        }
+    }
+    std::shared_ptr<CollisionHeightfieldShape> heightfieldShape = std::make_shared<CollisionHeightfieldShape>(vertices, 33, 33);
+    physicsWorld->addBody(new RigidBody("ground", Transform<float>(Point3<float>(0.0f, 0.0f, 0.0f), Quaternion<float>(), 1.0f), heightfieldShape));
+    physicsWorld->getCollisionWorld()->process(1.0f / 60.0f, Vector3<float>(0.0f, -9.81f, 0.0f));
+
+    BatchQuery batchQuery;
+    Ray<float> rayThroughBump(Point3<float>(0.0f, 1.0f, 8.3f), Point3<float>(16.0f, 1.0f, 8.3f));
+    unsigned int allHitsRay = batchQuery.addRayTest(rayThroughBump);
+    unsigned int closestHitRay = batchQuery.addClosestHitRayTest(rayThroughBump);
+    std::shared_ptr<const BatchQueryResult> batchQueryResult = physicsWorld->synchronousBatchQueryTest(batchQuery);
+
+    AssertHelper::assertTrue(batchQueryResult->getResults(allHitsRay).size() >= 2, "Ray must hit both sides of the bump");
+    AssertHelper::assertUnsignedInt(batchQueryResult->getResults(closestHitRay).size(), 1);
+    AssertHelper::assertFloatEquals(batchQueryResult->getNearestResult(closestHitRay)->getTimeToHit(), batchQueryResult->getNearestResult(allHitsRay)->getTimeToHit());
+    AssertHelper::assertTrue(batchQueryResult->getNearestResult(closestHitRay)->getHitPointOnObject2().X < 8.0f, "Closest hit must be on the bump front side");
+
+    delete physicsWorld;
+}
+
+CppUnit::Test *BatchQueryIT::suite()
+{
+    auto *suite = new CppUnit::TestSuite("BatchQueryIT");
+
+    suite->addTest(new CppUnit::TestCaller<BatchQueryIT>("synchronousRayAndSweepTests", &BatchQueryIT::synchronousRayAndSweepTests));
+    suite->addTest(new CppUnit::TestCaller<BatchQueryIT>("closestHitRayTestOnHeightfield", &BatchQueryIT::closestHitRayTestOnHeightfield));
+
+    return suite;
+}
@@ -0,0 +1,16 @@
+#ifndef URCHINENGINE_BATCHQUERYIT_H
+#define URCHINENGINE_BATCHQUERYIT_H
+
+#include <cppunit/TestFixture.h>
+#include <cppunit/Test.h>
+
+class BatchQueryIT : public CppUnit::TestFixture
+{
+    public:
+        static CppUnit::Test *suite();
+
+        void synchronousRayAndSweepTests();
+        void closestHitRayTestOnHeightfield();
+};
+
+#endif
@@ -0,0 +1,189 @@
+#include <cppunit/TestSuite.h>
+#include <cppunit/TestCaller.h>
+#include <memory>
+
+#include "physics/it/CharacterControllerBatchIT.h"
+#include "AssertHelper.h"
+#include "UrchinPhysicsEngine.h"
+using namespace urchin;
+
+void CharacterControllerBatchIT::fallOnGround()
+{
+    auto *physicsWorld = new PhysicsWorld();
+    std::shared_ptr<CollisionBoxShape> planeShape = std::make_shared<CollisionBoxShape>(Vector3<float>(1000.0f, 0.5f, 1000.0f));
+    physicsWorld->addBody(new RigidBody("plane", Transform<float>(Point3<float>(0.0f, -0.5f, 0.0f), Quaternion<float>(), 1.0f), planeShape));
+
+    auto characterControllerBatch = std::make_shared<PhysicsCharacterControllerBatch>();
+    std::shared_ptr<CollisionCapsuleShape> characterShape = std::make_shared<CollisionCapsuleShape>(0.25f, 1.0f, CapsuleShape<float>::CAPSULE_Y);
+    std::vector<std::shared_ptr<PhysicsCharacter>> characters;
+    for(std::size_t i=0; i<20; ++i)
+    {
+        PhysicsTransform characterTransform(Point3<float>(static_cast<float>(i) * 2.0f, 3.0f, 0.0f));
+        characters.push_back(std::make_shared<PhysicsCharacter>("character" + std::to_string(i), 80.0f, characterShape, characterTransform));
+        characterControllerBatch->addCharacterController(std::make_shared<PhysicsCharacterController>(characters.back(), physicsWorld));
+    }
+
+    for(std::size_t i=0; i<120; ++i)
+    {
+        physicsWorld->getCollisionWorld()->process(1.0f / 60.0f, Vector3<float>(0.0f, -9.81f, 0.0f));
+        characterControllerBatch->execute(1.0f / 60.0f, Vector3<float>(0.0f, -9.81f, 0.0f));
+    }
+
+    for(const auto &character : characters)
+    {
+        AssertHelper::assertFloatEquals(character->getTransform().getPosition().Y, 0.75f, 0.05f);
+    }
+
+    characterControllerBatch.reset();
+    delete physicsWorld;
+}
+
+void CharacterControllerBatchIT::stopOnWall()
+{
+    auto *physicsWorld = new PhysicsWorld();
+    std::shared_ptr<CollisionBoxShape> planeShape = std::make_shared<CollisionBoxShape>(Vector3<float>(1000.0f, 0.5f, 1000.0f));
+    physicsWorld->addBody(new RigidBody("plane", Transform<float>(Point3<float>(0.0f, -0.5f, 0.0f), Quaternion<float>(), 1.0f), planeShape));
+    std::shared_ptr<CollisionBoxShape> wallShape = std::make_shared<CollisionBoxShape>(Vector3<float>(0.5f, 2.0f, 10.0f));
+    physicsWorld->addBody(new RigidBody("wall", Transform<float>(Point3<float>(2.0f, 2.0f, 0.0f), Quaternion<float>(), 1.0f), wallShape));
+
+    auto characterControllerBatch = std::make_shared<PhysicsCharacterControllerBatch>();
+    std::shared_ptr<CollisionCapsuleShape> characterShape = std::make_shared<CollisionCapsuleShape>(0.25f, 1.0f, CapsuleShape<float>::CAPSULE_Y);
+    auto character = std::make_shared<PhysicsCharacter>("character", 80.0f, characterShape, PhysicsTransform(Point3<float>(0.0f, 0.75f, 0.0f)));
+    auto characterController = std::make_shared<PhysicsCharacterController>(character, physicsWorld);
+    characterController->setMomentum(Vector3<float>(80.0f * 5.0f, 0.0f, 0.0f)); //5 units/s in direction of the wall
+    characterControllerBatch->addCharacterController(characterController);
+
+    for(std::size_t i=0; i<120; ++i)
+    {
+        physicsWorld->getCollisionWorld()->process(1.0f / 60.0f, Vector3<float>(0.0f, -9.81f, 0.0f));
+        characterControllerBatch->execute(1.0f / 60.0f, Vector3<float>(0.0f, -9.81f, 0.0f));
+    }
+
+    AssertHelper::assertTrue(character->getTransform().getPosition().X > 1.0f, "Character must reach the wall");
+    AssertHelper::assertTrue(character->getTransform().getPosition().X < 1.25f + 0.02f, "Character must not pass through the wall");
+    AssertHelper::assertFloatEquals(character->getTransform().getPosition().Y, 0.75f, 0.05f);
+
+    characterControllerBatch.reset();
+    characterController.reset();
+    delete physicsWorld;
+}
+
+void CharacterControllerBatchIT::moveWithSeveralThreads()
+{
+    std::vector<Point3<float>> positionsOneThread = simulateMovingCharacters(1);
+    std::vector<Point3<float>> positionsSeveralThreads = simulateMovingCharacters(4);
+
+    AssertHelper::assertUnsignedInt(positionsOneThread.size(), positionsSeveralThreads.size());
+    for(std::size_t i=0; i<positionsOneThread.size(); ++i)
+    {
+        AssertHelper::assertTrue(positionsOneThread[i]==positionsSeveralThreads[i], "Result must not depend on the number of character threads");
+    }
+}
+
+std::vector<Point3<float>> CharacterControllerBatchIT::simulateMovingCharacters(unsigned int numberOfThreads)
+{
+    auto *physicsWorld = new PhysicsWorld();
+    std::shared_ptr<CollisionBoxShape> planeShape = std::make_shared<CollisionBoxShape>(Vector3<float>(1000.0f, 0.5f, 1000.0f));
+    physicsWorld->addBody(new RigidBody("plane", Transform<float>(Point3<float>(0.0f, -0.5f, 0.0f), Quaternion<float>(), 1.0f), planeShape));
+    std::shared_ptr<CollisionBoxShape> wallShape = std::make_shared<CollisionBoxShape>(Vector3<float>(0.5f, 2.0f, 100.0f));
+    physicsWorld->addBody(new RigidBody("wall", Transform<float>(Point3<float>(2.0f, 2.0f, 0.0f), Quaternion<float>(), 1.0f), wallShape));
+
+    auto characterControllerBatch = std::make_shared<PhysicsCharacterControllerBatch>(numberOfThreads);
+    std::shared_ptr<CollisionCapsuleShape> characterShape = std::make_shared<CollisionCapsuleShape>(0.25f, 1.0f, CapsuleShape<float>::CAPSULE_Y);
+    std::vector<std::shared_ptr<PhysicsCharacter>> characters;
+    for(std::size_t i=0; i<40; ++i)
+    {
+        PhysicsTransform characterTransform(Point3<float>(0.0f, 1.0f + static_cast<float>(i % 3), static_cast<float>(i) * 2.0f));
+        characters.push_back(std::make_shared<PhysicsCharacter>("character" + std::to_string(i), 80.0f, characterShape, characterTransform));
+        auto characterController = std::make_shared<PhysicsCharacterController>(characters.back(), physicsWorld);
+        characterController->setMomentum(Vector3<float>(80.0f * 5.0f, 0.0f, 80.0f * static_cast<float>(i % 5))); //toward the wall
+        characterControllerBatch->addCharacterController(characterController);
+    }
+
+    for(std::size_t i=0; i<90; ++i)
+    {
+        physicsWorld->getCollisionWorld()->process(1.0f / 60.0f, Vector3<float>(0.0f, -9.81f, 0.0f));
+        characterControllerBatch->execute(1.0f / 60.0f, Vector3<float>(0.0f, -9.81f, 0.0f));
+    }
+
+    std::vector<Point3<float>> positions;
+    for(const auto &character : characters)
+    {
+        positions.push_back(character->getTransform().getPosition());
+    }
+
+    characterControllerBatch.reset();
+    delete physicsWorld;
+    return positions;
+}
+
+void CharacterControllerBatchIT::moveOnHeightfieldWithSeveralThreads()
+{
+    std::vector<Point3<float>> positionsOneThread = simulateMovingCharactersOnHeightfield(1);
+    std::vector<Point3<float>> positionsSeveralThreads = simulateMovingCharactersOnHeightfield(4);
+
+    AssertHelper::assertUnsignedInt(positionsOneThread.size(), positionsSeveralThreads.size());
+    for(std::size_t i=0; i<positionsOneThread.size(); ++i)
+    {
+        AssertHelper::assertFloatEquals(positionsSeveralThreads[i].Y, 0.75f, 0.05f);
+        AssertHelper::assertTrue(positionsOneThread[i]==positionsSeveralThreads[i], "Result must not depend on the number of character threads");
+    }
+}
+
+/**
+ * Characters sweep concurrently against the same heightfield: each thread handles more than 8 characters.
+ */
+std::vector<Point3<float>> CharacterControllerBatchIT::simulateMovingCharactersOnHeightfield(unsigned int numberOfThreads)
+{
+    auto *physicsWorld = new PhysicsWorld();
+    std::vector<Point3<float>> vertices;
+    for(unsigned int z=0; z<65; ++z)
+    {
+        for(unsigned int x=0; x<65; ++x)
+        {
+            vertices.emplace_back(Point3<float>(static_cast<float>(x) - 32.0f, 0.0f, static_cast<float>(z) - 32.0f));
+        }
+    }
+    std::shared_ptr<CollisionHeightfieldShape> heightfieldShape = std::make_shared<CollisionHeightfieldShape>(vertices, 65, 65);
+    physicsWorld->addBody(new RigidBody("ground", Transform<float>(Point3<float>(0.0f, 0.0f, 0.0f), Quaternion<float>(), 1.0f), heightfieldShape));
+
+    auto characterControllerBatch = std::make_shared<PhysicsCharacterControllerBatch>(numberOfThreads);
+    std::shared_ptr<CollisionCapsuleShape> characterShape = std::make_shared<CollisionCapsuleShape>(0.25f, 1.0f, CapsuleShape<float>::CAPSULE_Y);
+    std::vector<std::shared_ptr<PhysicsCharacter>> characters;
+    for(std::size_t i=0; i<48; ++i)
+    {
+        PhysicsTransform characterTransform(Point3<float>(static_cast<float>(i % 8) * 6.0f - 24.0f, 1.0f + static_cast<float>(i % 3), static_cast<float>(i / 8) * 6.0f - 24.0f));
+        characters.push_back(std::make_shared<PhysicsCharacter>("character" + std::to_string(i), 80.0f, characterShape, characterTransform));
+        auto characterController = std::make_shared<PhysicsCharacterController>(characters.back(), physicsWorld);
+        characterController->setMomentum(Vector3<float>(80.0f * static_cast<float>(i % 4), 0.0f, 80.0f * static_cast<float>(i % 5)));
+        characterControllerBatch->addCharacterController(characterController);
+    }
+
+    for(std::size_t i=0; i<90; ++i)
+    {
+        physicsWorld->getCollisionWorld()->process(1.0f / 60.0f, Vector3<float>(0.0f, -9.81f, 0.0f));
+        characterControllerBatch->execute(1.0f / 60.0f, Vector3<float>(0.0f, -9.81f, 0.0f));
+    }
+
+    std::vector<Point3<float>> positions;
+    for(const auto &character : characters)
+    {
+        positions.push_back(character->getTransform().getPosition());
+    }
+
+    characterControllerBatch.reset();
+    delete physicsWorld;
+    return positions;
+}
+
+CppUnit::Test *CharacterControllerBatchIT::suite()
+{
+    auto *suite = new CppUnit::TestSuite("CharacterControllerBatchIT");
+
+    suite->addTest(new CppUnit::TestCaller<CharacterControllerBatchIT>("fallOnGround", &CharacterControllerBatchIT::fallOnGround));
+    suite->addTest(new CppUnit::TestCaller<CharacterControllerBatchIT>("stopOnWall", &CharacterControllerBatchIT::stopOnWall));
+    suite->addTest(new CppUnit::TestCaller<CharacterControllerBatchIT>("moveWithSeveralThreads", &CharacterControllerBatchIT::moveWithSeveralThreads));
+    suite->addTest(new CppUnit::TestCaller<CharacterControllerBatchIT>("moveOnHeightfieldWithSeveralThreads", &CharacterControllerBatchIT::moveOnHeightfieldWithSeveralThreads));
+
+    return suite;
+}
@@ -0,0 +1,24 @@
+#ifndef URCHINENGINE_CHARACTERCONTROLLERBATCHIT_H
+#define URCHINENGINE_CHARACTERCONTROLLERBATCHIT_H
+
+#include <cppunit/TestFixture.h>
+#include <cppunit/Test.h>
+#include <vector>
+#include "UrchinCommon.h"
+
+class CharacterControllerBatchIT : public CppUnit::TestFixture
+{
+    public:
+        static CppUnit::Test *suite();
+
+        void fallOnGround();
+        void stopOnWall();
+        void moveWithSeveralThreads();
+        void moveOnHeightfieldWithSeveralThreads();
+
+    private:
+        std::vector<urchin::Point3<float>> simulateMovingCharacters(unsigned int);
+        std::vector<urchin::Point3<float>> simulateMovingCharactersOnHeightfield(unsigned int);
+};
+
+#endif
@@ -34,6 +34,41 @@ void FallingObjectIT::fallOnPlane()
     delete bodyManager;
 }
 
+void FallingObjectIT::fallManyObjectsOnPlane()
+{
+    std::shared_ptr<CollisionBoxShape> planeShape = std::make_shared<CollisionBoxShape>(Vector3<float>(1000.0f, 0.5f, 1000.0f));
+    auto *planeBody = new RigidBody("plane", Transform<float>(Point3<float>(0.0f, -0.5f, 0.0f), Quaternion<float>(), 1.0f), planeShape);
+
+    auto *bodyManager = new BodyManager();
+    bodyManager->addBody(planeBody);
+
+    std::shared_ptr<CollisionBoxShape> cubeShape = std::make_shared<CollisionBoxShape>(Vector3<float>(0.5f, 0.5f, 0.5f));
+    std::vector<RigidBody *> cubeBodies;
+    for(std::size_t i=0; i<40; ++i)
+    {
+        Point3<float> cubePosition(static_cast<float>(i % 8) * 3.0f, 5.0f, static_cast<float>(i / 8) * 3.0f);
+        auto *cubeBody = new RigidBody("cube" + std::to_string(i), Transform<float>(cubePosition, Quaternion<float>(), 1.0f), cubeShape);
+        cubeBody->setMass(10.0f);
+        bodyManager->addBody(cubeBody);
+        cubeBodies.push_back(cubeBody);
+    }
+    auto *collisionWorld = new CollisionWorld(bodyManager);
+
+    for(std::size_t i=0; i<150; ++i)
+    {
+        collisionWorld->process(1.0f / 60.0f, Vector3<float>(0.0f, -9.81f, 0.0f));
+    }
+
+    for(const auto &cubeBody : cubeBodies)
+    {
+        AssertHelper::assertFloatEquals(cubeBody->getTransform().getPosition().Y, 0.5f, 0.1f);
+        AssertHelper::assertTrue(!cubeBody->isActive(), "Body must become inactive when it doesn't move");
+    }
+
+    delete collisionWorld;
+    delete bodyManager;
+}
+
 void FallingObjectIT::fallForever()
 {
     if(!Logger::logger().retrieveContent(std::numeric_limits<unsigned long>::max()).empty())
@@ -68,12 +103,97 @@ void FallingObjectIT::fallForever()
     delete bodyManager;
 }
 
+void FallingObjectIT::fallPilesOfObjectsOnPlane()
+{
+    unsigned int numberOfPiles = 20;
+    unsigned int pileHeight = 3;
+
+    std::vector<Transform<float>> cubeTransforms = simulatePilesOfObjects(numberOfPiles, pileHeight, 4);
+    std::vector<Transform<float>> cubeTransformsSecondRun = simulatePilesOfObjects(numberOfPiles, pileHeight, 4);
+
+    for(std::size_t i=0; i<cubeTransforms.size(); ++i)
+    {
+        float expectedY = 0.5f + static_cast<float>(i % pileHeight);
+        AssertHelper::assertFloatEquals(cubeTransforms[i].getPosition().Y, expectedY, 0.1f);
+
+        AssertHelper::assertTrue(isSameTransform(cubeTransforms[i], cubeTransformsSecondRun[i]), "Islands solved concurrently must give same result on each run");
+    }
+}
+
+void FallingObjectIT::fallPilesOfObjectsWithSeveralThreads()
+{
+    unsigned int numberOfPiles = 20;
+    unsigned int pileHeight = 3;
+
+    std::vector<Transform<float>> cubeTransformsOneThread = simulatePilesOfObjects(numberOfPiles, pileHeight, 1);
+    std::vector<Transform<float>> cubeTransformsSeveralThreads = simulatePilesOfObjects(numberOfPiles, pileHeight, 4);
+
+    AssertHelper::assertUnsignedInt(cubeTransformsOneThread.size(), cubeTransformsSeveralThreads.size());
+    for(std::size_t i=0; i<cubeTransformsOneThread.size(); ++i)
+    {
+        AssertHelper::assertTrue(isSameTransform(cubeTransformsOneThread[i], cubeTransformsSeveralThreads[i]), "Result must not depend on the number of narrow phase and solver threads");
+    }
+}
+
+std::vector<Transform<float>> FallingObjectIT::simulatePilesOfObjects(unsigned int numberOfPiles, unsigned int pileHeight, unsigned int numberOfThreads)
+{
+    std::shared_ptr<CollisionBoxShape> planeShape = std::make_shared<CollisionBoxShape>(Vector3<float>(1000.0f, 0.5f, 1000.0f));
+    auto *planeBody = new RigidBody("plane", Transform<float>(Point3<float>(0.0f, -0.5f, 0.0f), Quaternion<float>(), 1.0f), planeShape);
+
+    auto *bodyManager = new BodyManager();
+    bodyManager->addBody(planeBody);
+
+    std::shared_ptr<CollisionBoxShape> cubeShape = std::make_shared<CollisionBoxShape>(Vector3<float>(0.5f, 0.5f, 0.5f));
+    std::vector<RigidBody *> cubeBodies;
+    for(unsigned int pileIndex=0; pileIndex<numberOfPiles; ++pileIndex)
+    {
+        for(unsigned int heightIndex=0; heightIndex<pileHeight; ++heightIndex)
+        {
+            Point3<float> cubePosition(static_cast<float>(pileIndex % 5) * 3.0f, 0.5f + static_cast<float>(heightIndex) * 1.05f, static_cast<float>(pileIndex / 5) * 3.0f);
+            auto *cubeBody = new RigidBody("cube" + std::to_string(pileIndex) + "_" + std::to_string(heightIndex), Transform<float>(cubePosition, Quaternion<float>(), 1.0f), cubeShape);
+            cubeBody->setMass(10.0f);
+            bodyManager->addBody(cubeBody);
+            cubeBodies.push_back(cubeBody);
+        }
+    }
+    auto *collisionWorld = new CollisionWorld(bodyManager, numberOfThreads, numberOfThreads);
+
+    for(std::size_t i=0; i<150; ++i)
+    {
+        collisionWorld->process(1.0f / 60.0f, Vector3<float>(0.0f, -9.81f, 0.0f));
+    }
+
+    std::vector<Transform<float>> cubeTransforms;
+    for(const auto &cubeBody : cubeBodies)
+    {
+        cubeTransforms.push_back(cubeBody->getTransform());
+    }
+
+    delete collisionWorld;
+    delete bodyManager;
+    return cubeTransforms;
+}
+
+bool FallingObjectIT::isSameTransform(const Transform<float> &transform1, const Transform<float> &transform2) const
+{ //bit-identical comparison
+    const Point3<float> &position1 = transform1.getPosition();
+    const Point3<float> &position2 = transform2.getPosition();
+    const Quaternion<float> &orientation1 = transform1.getOrientation();
+    const Quaternion<float> &orientation2 = transform2.getOrientation();
+
+    return position1.X == position2.X && position1.Y == position2.Y && position1.Z == position2.Z
+            && orientation1.X == orientation2.X && orientation1.Y == orientation2.Y && orientation1.Z == orientation2.Z && orientation1.W == orientation2.W;
+}
+
 CppUnit::Test *FallingObjectIT::suite()
 {
     auto *suite = new CppUnit::TestSuite("FallingObjectIT");
 
     suite->addTest(new CppUnit::TestCaller<FallingObjectIT>("fallOnPlane", &FallingObjectIT::fallOnPlane));
+    suite->addTest(new CppUnit::TestCaller<FallingObjectIT>("fallManyObjectsOnPlane", &FallingObjectIT::fallManyObjectsOnPlane));
     suite->addTest(new CppUnit::TestCaller<FallingObjectIT>("fallForever", &FallingObjectIT::fallForever));
+    suite->addTest(new CppUnit::TestCaller<FallingObjectIT>("fallPilesOfObjectsOnPlane", &FallingObjectIT::fallPilesOfObjectsOnPlane));
+    suite->addTest(new CppUnit::TestCaller<FallingObjectIT>("fallPilesOfObjectsWithSeveralThreads", &FallingObjectIT::fallPilesOfObjectsWithSeveralThreads));
 
     return suite;
 }
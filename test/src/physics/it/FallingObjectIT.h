@@ -3,6 +3,8 @@
 
 #include <cppunit/TestFixture.h>
 #include <cppunit/Test.h>
+#include <vector>
+#include "UrchinCommon.h"
 
 class FallingObjectIT : public CppUnit::TestFixture
 {
@@ -10,7 +12,14 @@ class FallingObjectIT : public CppUnit::TestFixture
         static CppUnit::Test *suite();
 
         void fallOnPlane();
+        void fallManyObjectsOnPlane();
         void fallForever();
+        void fallPilesOfObjectsOnPlane();
+        void fallPilesOfObjectsWithSeveralThreads();
+
+    private:
+        std::vector<urchin::Transform<float>> simulatePilesOfObjects(unsigned int, unsigned int, unsigned int);
+        bool isSameTransform(const urchin::Transform<float> &, const urchin::Transform<float> &) const;
 };
 
 #endif
@@ -0,0 +1,103 @@
+#include <cppunit/TestSuite.h>
+#include <cppunit/TestCaller.h>
+#include <memory>
+
+#include "physics/it/PhysicsStatisticsIT.h"
+#include "AssertHelper.h"
+#include "UrchinPhysicsEngine.h"
+using namespace urchin;
+
+namespace
+{
+    void addPlane(PhysicsWorld *physicsWorld)
+    {
+        std::shared_ptr<CollisionBoxShape> planeShape = std::make_shared<CollisionBoxShape>(Vector3<float>(1000.0f, 0.5f, 1000.0f));
+        physicsWorld->addBody(new RigidBody("plane", Transform<float>(Point3<float>(0.0f, -0.5f, 0.0f), Quaternion<float>(), 1.0f), planeShape));
+    }
+
+    void simulate(PhysicsWorld *physicsWorld, std::size_t numberOfSteps)
+    {
+        for(std::size_t i=0; i<numberOfSteps; ++i)
+        {
+            physicsWorld->getCollisionWorld()->process(1.0f / 60.0f, Vector3<float>(0.0f, -9.81f, 0.0f));
+        }
+    }
+
+    unsigned int sum(const unsigned int *values, unsigned int size)
+    {
+        unsigned int result = 0;
+        for(unsigned int i=0; i<size; ++i)
+        {
+            result += values[i];
+        }
+        return result;
+    }
+}
+
+void PhysicsStatisticsIT::narrowPhaseCounters()
+{
+    auto *physicsWorld = new PhysicsWorld();
+    addPlane(physicsWorld);
+    std::shared_ptr<CollisionBoxShape> cubeShape = std::make_shared<CollisionBoxShape>(Vector3<float>(0.5f, 0.5f, 0.5f));
+    auto *cubeBody = new RigidBody("cube", Transform<float>(Point3<float>(0.0f, 0.6f, 0.0f), Quaternion<float>(), 1.0f), cubeShape);
+    cubeBody->setMass(1.0f);
+    physicsWorld->addBody(cubeBody);
+    std::shared_ptr<CollisionCylinderShape> cylinderShape = std::make_shared<CollisionCylinderShape>(0.5f, 1.0f, CylinderShape<float>::CYLINDER_Y);
+    auto *cylinderBody = new RigidBody("cylinder", Transform<float>(Point3<float>(5.0f, 0.45f, 0.0f), Quaternion<float>(), 1.0f), cylinderShape);
+    cylinderBody->setMass(1.0f);
+    physicsWorld->addBody(cylinderBody);
+
+    simulate(physicsWorld, 5);
+    const PhysicsStatistics &statistics = physicsWorld->getCollisionWorld()->getStatistics();
+
+    AssertHelper::assertUnsignedInt(statistics.bodies, 3);
+    AssertHelper::assertUnsignedInt(statistics.awakeBodies, 2);
+    AssertHelper::assertUnsignedInt(statistics.overlappingPairs, 2);
+    AssertHelper::assertUnsignedInt(statistics.narrowPhaseTests[CollisionAlgorithm::BOX_BOX], 1);
+    AssertHelper::assertUnsignedInt(statistics.narrowPhaseTests[CollisionAlgorithm::CONVEX_CONVEX], 1);
+    AssertHelper::assertTrue(sum(statistics.gjkIterations, PhysicsStatistics::ITERATION_HISTOGRAM_SIZE) > 0, "Cylinder on plane must be processed by GJK");
+    AssertHelper::assertTrue(statistics.contactsSolved > 0, "Contacts of bodies on plane must be solved");
+    AssertHelper::assertTrue(statistics.algorithmPool.highWaterMark >= 2, "Pool must provide the algorithms of the two pairs");
+
+    delete physicsWorld;
+}
+
+void PhysicsStatisticsIT::continuousCollisionCounters()
+{
+    auto *physicsWorld = new PhysicsWorld();
+    addPlane(physicsWorld);
+    std::shared_ptr<CollisionSphereShape> sphereShape = std::make_shared<CollisionSphereShape>(0.5f);
+    auto *sphereBody = new RigidBody("sphere", Transform<float>(Point3<float>(0.0f, 5.0f, 0.0f), Quaternion<float>(), 1.0f), sphereShape);
+    sphereBody->setMass(1.0f);
+    sphereBody->applyCentralMomentum(Vector3<float>(0.0f, -300.0f, 0.0f));
+    physicsWorld->addBody(sphereBody);
+
+    simulate(physicsWorld, 1);
+    const PhysicsStatistics &statistics = physicsWorld->getCollisionWorld()->getStatistics();
+
+    AssertHelper::assertTrue(statistics.ccdTests > 0, "Fast moving sphere must be tested by continuous collision");
+
+    delete physicsWorld;
+}
+
+void PhysicsStatisticsIT::iterationHistogramBuckets()
+{
+    AssertHelper::assertUnsignedInt(PhysicsStatistics::toIterationHistogramBucket(0), 0);
+    AssertHelper::assertUnsignedInt(PhysicsStatistics::toIterationHistogramBucket(1), 1);
+    AssertHelper::assertUnsignedInt(PhysicsStatistics::toIterationHistogramBucket(3), 2);
+    AssertHelper::assertUnsignedInt(PhysicsStatistics::toIterationHistogramBucket(4), 3);
+    AssertHelper::assertUnsignedInt(PhysicsStatistics::toIterationHistogramBucket(63), 6);
+    AssertHelper::assertUnsignedInt(PhysicsStatistics::toIterationHistogramBucket(64), 7);
+    AssertHelper::assertUnsignedInt(PhysicsStatistics::toIterationHistogramBucket(1000), PhysicsStatistics::ITERATION_HISTOGRAM_SIZE - 1);
+}
+
+CppUnit::Test *PhysicsStatisticsIT::suite()
+{
+    auto *suite = new CppUnit::TestSuite("PhysicsStatisticsIT");
+
+    suite->addTest(new CppUnit::TestCaller<PhysicsStatisticsIT>("narrowPhaseCounters", &PhysicsStatisticsIT::narrowPhaseCounters));
+    suite->addTest(new CppUnit::TestCaller<PhysicsStatisticsIT>("continuousCollisionCounters", &PhysicsStatisticsIT::continuousCollisionCounters));
+    suite->addTest(new CppUnit::TestCaller<PhysicsStatisticsIT>("iterationHistogramBuckets", &PhysicsStatisticsIT::iterationHistogramBuckets));
+
+    return suite;
+}
@@ -0,0 +1,17 @@
+#ifndef URCHINENGINE_PHYSICSSTATISTICSIT_H
+#define URCHINENGINE_PHYSICSSTATISTICSIT_H
+
+#include <cppunit/TestFixture.h>
+#include <cppunit/Test.h>
+
+class PhysicsStatisticsIT : public CppUnit::TestFixture
+{
+    public:
+        static CppUnit::Test *suite();
+
+        void narrowPhaseCounters();
+        void continuousCollisionCounters();
+        void iterationHistogramBuckets();
+};
+
+#endif
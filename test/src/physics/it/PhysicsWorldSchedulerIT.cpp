@@ -0,0 +1,174 @@
+#include <cppunit/TestSuite.h>
+#include <cppunit/TestCaller.h>
+#include <memory>
+#include <thread>
+#include <chrono>
+#include <atomic>
+#include <stdexcept>
+
+#include "physics/it/PhysicsWorldSchedulerIT.h"
+#include "AssertHelper.h"
+#include "UrchinPhysicsEngine.h"
+using namespace urchin;
+
+namespace
+{
+    /**
+     * Count the steps of a world. Throw an exception at the first step when asked.
+     */
+    class StepCounterProcessable : public Processable
+    {
+        public:
+            explicit StepCounterProcessable(bool throwException) :
+                    throwException(throwException),
+                    numberOfSteps(0)
+            {
+
+            }
+
+            void initialize(PhysicsWorld *) override
+            {
+
+            }
+
+            void setup(float, const Vector3<float> &) override
+            {
+                if(throwException)
+                {
+                    throw std::runtime_error("Step failure.");
+                }
+            }
+
+            void execute(float, const Vector3<float> &) override
+            {
+                numberOfSteps.fetch_add(1, std::memory_order_relaxed);
+            }
+
+            unsigned int getNumberOfSteps() const
+            {
+                return numberOfSteps.load(std::memory_order_relaxed);
+            }
+
+        private:
+            bool throwException;
+            std::atomic_uint numberOfSteps;
+    };
+
+    void waitSteps(const std::vector<std::shared_ptr<StepCounterProcessable>> &stepCounters, unsigned int expectedNumberOfSteps)
+    {
+        auto deadline = std::chrono::steady_clock::now() + std::chrono::seconds(30);
+        for(const auto &stepCounter : stepCounters)
+        {
+            while(stepCounter->getNumberOfSteps() < expectedNumberOfSteps)
+            {
+                if(std::chrono::steady_clock::now() > deadline)
+                {
+                    throw std::runtime_error("Worlds not processed in time.");
+                }
+                std::this_thread::sleep_for(std::chrono::milliseconds(1));
+            }
+        }
+    }
+}
+
+void PhysicsWorldSchedulerIT::fallInSeveralWorlds()
+{
+    auto *scheduler = new PhysicsWorldScheduler(1.0f / 60.0f, 2);
+    std::shared_ptr<CollisionBoxShape> planeShape = std::make_shared<CollisionBoxShape>(Vector3<float>(1000.0f, 0.5f, 1000.0f));
+    std::shared_ptr<CollisionBoxShape> cubeShape = std::make_shared<CollisionBoxShape>(Vector3<float>(0.5f, 0.5f, 0.5f));
+    std::vector<RigidBody *> cubeBodies;
+    std::vector<std::shared_ptr<StepCounterProcessable>> stepCounters;
+    for(std::size_t i=0; i<4; ++i)
+    {
+        PhysicsWorld *physicsWorld = scheduler->createWorld();
+        physicsWorld->addBody(new RigidBody("plane", Transform<float>(Point3<float>(0.0f, -0.5f, 0.0f), Quaternion<float>(), 1.0f), planeShape));
+        auto *cubeBody = new RigidBody("cube", Transform<float>(Point3<float>(0.0f, 5.0f, 0.0f), Quaternion<float>(), 1.0f), cubeShape);
+        cubeBody->setMass(10.0f);
+        physicsWorld->addBody(cubeBody);
+        cubeBodies.push_back(cubeBody);
+
+        if(i!=0)
+        {
+            auto stepCounter = std::make_shared<StepCounterProcessable>(false);
+            physicsWorld->addProcessable(stepCounter);
+            stepCounters.push_back(stepCounter);
+            physicsWorld->unpause();
+        }
+    }
+
+    scheduler->start();
+    waitSteps(stepCounters, 30);
+    scheduler->interrupt();
+    scheduler->controlExecution();
+
+    AssertHelper::assertFloatEquals(cubeBodies[0]->getTransform().getPosition().Y, 5.0f, 0.001f);
+    for(std::size_t i=1; i<cubeBodies.size(); ++i)
+    {
+        AssertHelper::assertTrue(cubeBodies[i]->getTransform().getPosition().Y < 4.5f, "Cube of world " + std::to_string(i) + " must fall");
+    }
+
+    delete scheduler;
+}
+
+void PhysicsWorldSchedulerIT::exceptionInOneWorld()
+{
+    auto *scheduler = new PhysicsWorldScheduler(1.0f / 60.0f, 2);
+    std::vector<std::shared_ptr<StepCounterProcessable>> stepCounters;
+    for(std::size_t i=0; i<3; ++i)
+    {
+        PhysicsWorld *physicsWorld = scheduler->createWorld();
+        auto stepCounter = std::make_shared<StepCounterProcessable>(i==0);
+        physicsWorld->addProcessable(stepCounter);
+        stepCounters.push_back(stepCounter);
+        physicsWorld->unpause();
+    }
+
+    scheduler->start();
+    waitSteps({stepCounters[1], stepCounters[2]}, 30);
+    scheduler->interrupt();
+    scheduler->controlExecution();
+
+    bool exceptionRethrown = false;
+    try
+    {
+        scheduler->getWorlds()[0]->controlExecution();
+    }catch(std::runtime_error &e)
+    {
+        exceptionRethrown = true;
+    }
+    AssertHelper::assertTrue(exceptionRethrown, "Exception must be rethrown by the failing world");
+    AssertHelper::assertUnsignedInt(stepCounters[0]->getNumberOfSteps(), 0);
+    scheduler->getWorlds()[1]->controlExecution();
+    scheduler->getWorlds()[2]->controlExecution();
+
+    delete scheduler;
+    Logger::logger().purge();
+}
+
+void PhysicsWorldSchedulerIT::setUpScheduledWorld()
+{
+    PhysicsWorldScheduler scheduler(1.0f / 60.0f, 1);
+    PhysicsWorld *physicsWorld = scheduler.createWorld();
+
+    bool setUpRefused = false;
+    try
+    {
+        physicsWorld->setUp(1.0f / 60.0f);
+    }catch(std::runtime_error &e)
+    {
+        setUpRefused = true;
+    }
+
+    AssertHelper::assertTrue(setUpRefused, "Scheduled world cannot be set up");
+}
+
+CppUnit::Test *PhysicsWorldSchedulerIT::suite()
+{
+    auto *suite = new CppUnit::TestSuite("PhysicsWorldSchedulerIT");
+
+    suite->addTest(new CppUnit::TestCaller<PhysicsWorldSchedulerIT>("fallInSeveralWorlds", &PhysicsWorldSchedulerIT::fallInSeveralWorlds));
+    suite->addTest(new CppUnit::TestCaller<PhysicsWorldSchedulerIT>("exceptionInOneWorld", &PhysicsWorldSchedulerIT::exceptionInOneWorld));
+    suite->addTest(new CppUnit::TestCaller<PhysicsWorldSchedulerIT>("setUpScheduledWorld", &PhysicsWorldSchedulerIT::setUpScheduledWorld));
+
+    return suite;
+}
@@ -0,0 +1,17 @@
+#ifndef URCHINENGINE_PHYSICSWORLDSCHEDULERIT_H
+#define URCHINENGINE_PHYSICSWORLDSCHEDULERIT_H
+
+#include <cppunit/TestFixture.h>
+#include <cppunit/Test.h>
+
+class PhysicsWorldSchedulerIT : public CppUnit::TestFixture
+{
+    public:
+        static CppUnit::Test *suite();
+
+        void fallInSeveralWorlds();
+        void exceptionInOneWorld();
+        void setUpScheduledWorld();
+};
+
+#endif
@@ -0,0 +1,178 @@
+#include <cppunit/TestSuite.h>
+#include <cppunit/TestCaller.h>
+#include <memory>
+#include <stdexcept>
+
+#include "physics/it/PhysicsWorldSnapshotIT.h"
+#include "AssertHelper.h"
+#include "UrchinPhysicsEngine.h"
+using namespace urchin;
+
+namespace
+{
+    std::vector<RigidBody *> createCubesWorld(PhysicsWorld *physicsWorld)
+    {
+        std::shared_ptr<CollisionBoxShape> planeShape = std::make_shared<CollisionBoxShape>(Vector3<float>(1000.0f, 0.5f, 1000.0f));
+        physicsWorld->addBody(new RigidBody("plane", Transform<float>(Point3<float>(0.0f, -0.5f, 0.0f), Quaternion<float>(), 1.0f), planeShape));
+
+        std::vector<RigidBody *> cubeBodies;
+        std::shared_ptr<CollisionBoxShape> cubeShape = std::make_shared<CollisionBoxShape>(Vector3<float>(0.5f, 0.5f, 0.5f));
+        for(std::size_t i=0; i<4; ++i)
+        {
+            Point3<float> cubePosition(static_cast<float>(i) * 0.2f, 0.5f + static_cast<float>(i) * 1.1f, 0.0f);
+            auto *cubeBody = new RigidBody("cube" + std::to_string(i), Transform<float>(cubePosition, Quaternion<float>(), 1.0f), cubeShape);
+            cubeBody->setMass(1.0f);
+            physicsWorld->addBody(cubeBody);
+            cubeBodies.push_back(cubeBody);
+        }
+
+        std::shared_ptr<CollisionSphereShape> sphereShape = std::make_shared<CollisionSphereShape>(0.5f);
+        auto *sphereBody = new RigidBody("sphere", Transform<float>(Point3<float>(-4.0f, 0.5f, 0.0f), Quaternion<float>(), 1.0f), sphereShape);
+        sphereBody->setMass(2.0f);
+        sphereBody->applyCentralMomentum(Vector3<float>(4.0f, 0.0f, 0.0f));
+        physicsWorld->addBody(sphereBody);
+        cubeBodies.push_back(sphereBody);
+
+        return cubeBodies;
+    }
+
+    std::vector<Transform<float>> simulate(PhysicsWorld *physicsWorld, const std::vector<RigidBody *> &bodies, std::size_t numberOfSteps)
+    {
+        for(std::size_t i=0; i<numberOfSteps; ++i)
+        {
+            physicsWorld->getCollisionWorld()->process(1.0f / 60.0f, Vector3<float>(0.0f, -9.81f, 0.0f));
+        }
+
+        std::vector<Transform<float>> transforms;
+        for(const auto &body : bodies)
+        {
+            transforms.push_back(body->getTransform());
+        }
+        return transforms;
+    }
+}
+
+void PhysicsWorldSnapshotIT::restoreTransforms()
+{
+    auto *physicsWorld = new PhysicsWorld();
+    std::vector<RigidBody *> bodies = createCubesWorld(physicsWorld);
+    std::vector<Transform<float>> capturedTransforms = simulate(physicsWorld, bodies, 20);
+
+    PhysicsWorldSnapshot snapshot;
+    physicsWorld->captureSnapshot(snapshot);
+    simulate(physicsWorld, bodies, 60);
+    physicsWorld->restoreSnapshot(snapshot);
+
+    for(std::size_t i=0; i<bodies.size(); ++i)
+    {
+        AssertHelper::assertTrue(bodies[i]->getTransform().getPosition()==capturedTransforms[i].getPosition(), "Position of body " + std::to_string(i) + " must be restored");
+        AssertHelper::assertTrue(bodies[i]->getTransform().getOrientation()==capturedTransforms[i].getOrientation(), "Orientation of body " + std::to_string(i) + " must be restored");
+    }
+
+    delete physicsWorld;
+}
+
+void PhysicsWorldSnapshotIT::deterministicResimulation()
+{
+    auto *physicsWorld = new PhysicsWorld();
+    std::vector<RigidBody *> bodies = createCubesWorld(physicsWorld);
+    simulate(physicsWorld, bodies, 20);
+
+    PhysicsWorldSnapshot snapshot;
+    physicsWorld->captureSnapshot(snapshot);
+    physicsWorld->restoreSnapshot(snapshot);
+    std::vector<Transform<float>> firstSimulationTransforms = simulate(physicsWorld, bodies, 60);
+    physicsWorld->restoreSnapshot(snapshot);
+    std::vector<Transform<float>> secondSimulationTransforms = simulate(physicsWorld, bodies, 60);
+
+    for(std::size_t i=0; i<bodies.size(); ++i)
+    {
+        AssertHelper::assertTrue(secondSimulationTransforms[i].getPosition()==firstSimulationTransforms[i].getPosition(), "Position of body " + std::to_string(i) + " must be identical");
+        AssertHelper::assertTrue(secondSimulationTransforms[i].getOrientation()==firstSimulationTransforms[i].getOrientation(), "Orientation of body " + std::to_string(i) + " must be identical");
+    }
+
+    delete physicsWorld;
+}
+
+void PhysicsWorldSnapshotIT::restoreInDifferentWorld()
+{
+    auto *physicsWorld = new PhysicsWorld();
+    std::vector<RigidBody *> bodies = createCubesWorld(physicsWorld);
+    simulate(physicsWorld, bodies, 1);
+    PhysicsWorldSnapshot snapshot;
+    physicsWorld->captureSnapshot(snapshot);
+    delete physicsWorld;
+
+    auto *otherPhysicsWorld = new PhysicsWorld();
+    std::shared_ptr<CollisionSphereShape> sphereShape = std::make_shared<CollisionSphereShape>(0.5f);
+    std::vector<RigidBody *> otherBodies = {new RigidBody("sphere", Transform<float>(), sphereShape)};
+    otherPhysicsWorld->addBody(otherBodies[0]);
+    simulate(otherPhysicsWorld, otherBodies, 1);
+
+    bool restoreRefused = false;
+    try
+    {
+        otherPhysicsWorld->restoreSnapshot(snapshot);
+    }catch(std::invalid_argument &e)
+    {
+        restoreRefused = true;
+    }
+
+    AssertHelper::assertTrue(restoreRefused, "Snapshot cannot be restored in a world with different bodies");
+    delete otherPhysicsWorld;
+}
+
+void PhysicsWorldSnapshotIT::restoreTruncatedSnapshot()
+{
+    auto *physicsWorld = new PhysicsWorld();
+    std::vector<RigidBody *> bodies = createCubesWorld(physicsWorld);
+    simulate(physicsWorld, bodies, 20);
+    PhysicsWorldSnapshot snapshot;
+    physicsWorld->captureSnapshot(snapshot);
+    simulate(physicsWorld, bodies, 60);
+    PhysicsWorldSnapshot snapshotBeforeRestore;
+    physicsWorld->captureSnapshot(snapshotBeforeRestore);
+
+    std::vector<char> snapshotData = snapshot.getData();
+    std::size_t rigidBodyStateSize = sizeof(float) * (3 + 4 + 4 * 3) + 2;
+    std::size_t bodiesStateSize = sizeof(std::uint32_t) + 6 * rigidBodyStateSize;
+    AssertHelper::assertTrue(snapshotData.size() > bodiesStateSize + sizeof(std::uint32_t), "Snapshot must contain manifolds");
+
+    std::vector<std::vector<char>> truncatedDataList = {
+            std::vector<char>(snapshotData.begin(), snapshotData.begin() + (long)(sizeof(std::uint32_t) + 5 * rigidBodyStateSize + 10)), //in the state of the last body
+            std::vector<char>(snapshotData.begin(), snapshotData.end() - 3) //in the last manifold: the states of all bodies are complete
+    };
+    for(const auto &truncatedData : truncatedDataList)
+    {
+        PhysicsWorldSnapshot truncatedSnapshot;
+        truncatedSnapshot.setData(truncatedData);
+
+        bool restoreRefused = false;
+        try
+        {
+            physicsWorld->restoreSnapshot(truncatedSnapshot);
+        }catch(std::out_of_range &e)
+        {
+            restoreRefused = true;
+        }
+
+        AssertHelper::assertTrue(restoreRefused, "Truncated snapshot cannot be restored");
+        PhysicsWorldSnapshot snapshotAfterRestore;
+        physicsWorld->captureSnapshot(snapshotAfterRestore);
+        AssertHelper::assertTrue(snapshotAfterRestore.getData()==snapshotBeforeRestore.getData(), "World must be untouched by a refused restoration");
+    }
+
+    delete physicsWorld;
+}
+
+CppUnit::Test *PhysicsWorldSnapshotIT::suite()
+{
+    auto *suite = new CppUnit::TestSuite("PhysicsWorldSnapshotIT");
+
+    suite->addTest(new CppUnit::TestCaller<PhysicsWorldSnapshotIT>("restoreTransforms", &PhysicsWorldSnapshotIT::restoreTransforms));
+    suite->addTest(new CppUnit::TestCaller<PhysicsWorldSnapshotIT>("deterministicResimulation", &PhysicsWorldSnapshotIT::deterministicResimulation));
+    suite->addTest(new CppUnit::TestCaller<PhysicsWorldSnapshotIT>("restoreInDifferentWorld", &PhysicsWorldSnapshotIT::restoreInDifferentWorld));
+    suite->addTest(new CppUnit::TestCaller<PhysicsWorldSnapshotIT>("restoreTruncatedSnapshot", &PhysicsWorldSnapshotIT::restoreTruncatedSnapshot));
+
+    return suite;
+}
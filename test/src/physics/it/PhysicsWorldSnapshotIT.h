@@ -0,0 +1,18 @@
+#ifndef URCHINENGINE_PHYSICSWORLDSNAPSHOTIT_H
+#define URCHINENGINE_PHYSICSWORLDSNAPSHOTIT_H
+
+#include <cppunit/TestFixture.h>
+#include <cppunit/Test.h>
+
+class PhysicsWorldSnapshotIT : public CppUnit::TestFixture
+{
+    public:
+        static CppUnit::Test *suite();
+
+        void restoreTransforms();
+        void deterministicResimulation();
+        void restoreInDifferentWorld();
+        void restoreTruncatedSnapshot();
+};
+
+#endif
@@ -82,7 +82,7 @@ void SupportPointTest::convexHullSupportPoint()
 
 	std::vector<Point3<float>> obbPointsWithMargin(obbPointsWithMarginTab, obbPointsWithMarginTab+sizeof(obbPointsWithMarginTab)/sizeof(Point3<float>));
 	std::vector<Point3<float>> obbPointsWithoutMargin(obbPointsWithoutMarginTab, obbPointsWithoutMarginTab+sizeof(obbPointsWithoutMarginTab)/sizeof(Point3<float>));
-	CollisionConvexHullObject convexHullObject(0.04f, obbPointsWithMargin, obbPointsWithoutMargin);
+	StandaloneConvexHullObject convexHullObject(0.04f, obbPointsWithMargin, obbPointsWithoutMargin);
 
 	AssertHelper::assertPoint3FloatEquals(convexHullObject.getSupportPoint(Vector3<float>(1.0, 0.0, -0.1), false), Point3<float>(0.2, 0.0, -1.0));
 	AssertHelper::assertPoint3FloatEquals(convexHullObject.getSupportPoint(Vector3<float>(1.0, 0.0, 0.1), false), Point3<float>(0.2, 0.0, 0.0));
@@ -90,6 +90,20 @@ void SupportPointTest::convexHullSupportPoint()
 	AssertHelper::assertPoint3FloatEquals(convexHullObject.getSupportPoint(Vector3<float>(1.0, 0.0, 0.1), true), Point3<float>(0.24, 0.0, 0.04));
 }
 
+void SupportPointTest::transformedConvexHullSupportPoint()
+{
+	std::vector<Point3<float>> localCubePoints = {
+			Point3<float>(-1.0, -1.0, -1.0), Point3<float>(1.0, -1.0, -1.0), Point3<float>(1.0, 1.0, -1.0), Point3<float>(-1.0, 1.0, -1.0),
+			Point3<float>(-1.0, -1.0, 1.0), Point3<float>(1.0, -1.0, 1.0), Point3<float>(1.0, 1.0, 1.0), Point3<float>(-1.0, 1.0, 1.0)
+	};
+	CollisionConvexHullObject convexHullObject(0.0f, &localCubePoints, &localCubePoints, Point3<float>(10.0, 0.0, 0.0),
+			Quaternion<float>(Vector3<float>(0.0, 0.0, 1.0), PI_VALUE/4)); //rotate 45° on Z axis
+
+	AssertHelper::assertPoint3FloatEquals(convexHullObject.getSupportPoint(Vector3<float>(1.0, 0.0, 0.1), false), Point3<float>(11.41421356, 0.0, 1.0));
+	AssertHelper::assertPoint3FloatEquals(convexHullObject.getSupportPoint(Vector3<float>(0.0, -1.0, -0.1), true), Point3<float>(10.0, -1.41421356, -1.0));
+	AssertHelper::assertPoint3FloatEquals(convexHullObject.getPointsWithMargin()[1], Point3<float>(11.41421356, 0.0, -1.0));
+}
+
 CppUnit::Test *SupportPointTest::suite()
 {
     auto *suite = new CppUnit::TestSuite("SupportPointTest");
@@ -100,6 +114,7 @@ CppUnit::Test *SupportPointTest::suite()
 	suite->addTest(new CppUnit::TestCaller<SupportPointTest>("cylinderSupportPoint", &SupportPointTest::cylinderSupportPoint));
 	suite->addTest(new CppUnit::TestCaller<SupportPointTest>("coneSupportPoint", &SupportPointTest::coneSupportPoint));
 	suite->addTest(new CppUnit::TestCaller<SupportPointTest>("convexHullSupportPoint", &SupportPointTest::convexHullSupportPoint));
+	suite->addTest(new CppUnit::TestCaller<SupportPointTest>("transformedConvexHullSupportPoint", &SupportPointTest::transformedConvexHullSupportPoint));
 
 	return suite;
 }
@@ -0,0 +1,67 @@
+#include <cppunit/TestSuite.h>
+#include <cppunit/TestCaller.h>
+#include <algorithm>
+#include "UrchinCommon.h"
+#include "UrchinPhysicsEngine.h"
+
+#include "AssertHelper.h"
+#include "physics/shape/CompoundShapeTest.h"
+using namespace urchin;
+
+void CompoundShapeTest::findLocalizedShapes()
+{
+	std::vector<std::shared_ptr<const LocalizedCollisionShape>> localizedShapes;
+	for(std::size_t i=0; i<10; ++i)
+	{ //boxes aligned on X axis: [-0.5+3i, 0.5+3i]
+		auto localizedShape = std::make_shared<LocalizedCollisionShape>();
+		localizedShape->position = i;
+		localizedShape->shape = std::make_shared<CollisionBoxShape>(Vector3<float>(0.5, 0.5, 0.5));
+		localizedShape->transform = PhysicsTransform(Point3<float>(static_cast<float>(i) * 3.0f, 0.0, 0.0));
+		localizedShapes.push_back(localizedShape);
+	}
+	CollisionCompoundShape compoundShape(localizedShapes);
+
+	std::vector<std::size_t> localizedShapeIndices;
+	compoundShape.findLocalizedShapes(AABBox<float>(Point3<float>(8.8, -0.1, -0.1), Point3<float>(9.2, 0.1, 0.1)), localizedShapeIndices);
+	AssertHelper::assertUnsignedInt(localizedShapeIndices.size(), 1);
+	AssertHelper::assertUnsignedInt(localizedShapeIndices[0], 3);
+
+	localizedShapeIndices.clear();
+	compoundShape.findLocalizedShapes(AABBox<float>(Point3<float>(5.9, -0.1, -0.1), Point3<float>(12.1, 0.1, 0.1)), localizedShapeIndices);
+	std::sort(localizedShapeIndices.begin(), localizedShapeIndices.end());
+	AssertHelper::assertUnsignedInt(localizedShapeIndices.size(), 3);
+	AssertHelper::assertUnsignedInt(localizedShapeIndices[0], 2);
+	AssertHelper::assertUnsignedInt(localizedShapeIndices[2], 4);
+
+	localizedShapeIndices.clear();
+	compoundShape.findLocalizedShapes(AABBox<float>(Point3<float>(1.0, -0.1, -0.1), Point3<float>(2.0, 0.1, 0.1)), localizedShapeIndices);
+	AssertHelper::assertUnsignedInt(localizedShapeIndices.size(), 0);
+}
+
+void CompoundShapeTest::findRotatedLocalizedShapes()
+{
+	auto localizedShape1 = std::make_shared<LocalizedCollisionShape>();
+	localizedShape1->position = 0;
+	localizedShape1->shape = std::make_shared<CollisionBoxShape>(Vector3<float>(2.0, 0.1, 0.1));
+	localizedShape1->transform = PhysicsTransform(Point3<float>(0.0, 0.0, 0.0), Quaternion<float>(Vector3<float>(0.0, 0.0, 1.0), PI_VALUE/2)); //vertical box
+	auto localizedShape2 = std::make_shared<LocalizedCollisionShape>();
+	localizedShape2->position = 1;
+	localizedShape2->shape = std::make_shared<CollisionSphereShape>(0.5);
+	localizedShape2->transform = PhysicsTransform(Point3<float>(5.0, 0.0, 0.0));
+	CollisionCompoundShape compoundShape({localizedShape1, localizedShape2});
+
+	std::vector<std::size_t> localizedShapeIndices;
+	compoundShape.findLocalizedShapes(AABBox<float>(Point3<float>(-0.1, 1.8, -0.1), Point3<float>(0.1, 2.2, 0.1)), localizedShapeIndices);
+	AssertHelper::assertUnsignedInt(localizedShapeIndices.size(), 1);
+	AssertHelper::assertUnsignedInt(localizedShapeIndices[0], 0);
+}
+
+CppUnit::Test *CompoundShapeTest::suite()
+{
+	auto *suite = new CppUnit::TestSuite("CompoundShapeTest");
+
+	suite->addTest(new CppUnit::TestCaller<CompoundShapeTest>("findLocalizedShapes", &CompoundShapeTest::findLocalizedShapes));
+	suite->addTest(new CppUnit::TestCaller<CompoundShapeTest>("findRotatedLocalizedShapes", &CompoundShapeTest::findRotatedLocalizedShapes));
+
+	return suite;
+}
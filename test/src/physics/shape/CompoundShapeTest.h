@@ -0,0 +1,16 @@
+#ifndef URCHINENGINE_COMPOUNDSHAPETEST_H
+#define URCHINENGINE_COMPOUNDSHAPETEST_H
+
+#include <cppunit/TestFixture.h>
+#include <cppunit/Test.h>
+
+class CompoundShapeTest : public CppUnit::TestFixture
+{
+	public:
+		static CppUnit::Test *suite();
+
+		void findLocalizedShapes();
+		void findRotatedLocalizedShapes();
+};
+
+#endif
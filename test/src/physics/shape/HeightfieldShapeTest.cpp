@@ -0,0 +1,122 @@
+#include <cppunit/TestSuite.h>
+#include <cppunit/TestCaller.h>
+#include <algorithm>
+#include <memory>
+#include "UrchinCommon.h"
+#include "UrchinPhysicsEngine.h"
+
+#include "AssertHelper.h"
+#include "physics/shape/HeightfieldShapeTest.h"
+using namespace urchin;
+
+void HeightfieldShapeTest::findTriangleIndices()
+{
+	std::vector<Point3<float>> vertices;
+	for(unsigned int z=0; z<4; ++z)
+	{
+		for(unsigned int x=0; x<4; ++x)
+		{
+			vertices.emplace_back(Point3<float>(static_cast<float>(x) - 1.5f, static_cast<float>(x * z) * 0.1f, static_cast<float>(z) - 1.5f));
+		}
+	}
+	CollisionHeightfieldShape heightfieldShape(vertices, 4, 4);
+	AABBox<float> box(Point3<float>(-0.2, -1.0, -0.2), Point3<float>(0.2, 1.0, 0.2));
+
+	std::vector<std::size_t> triangleIndices;
+	heightfieldShape.findTriangleIndicesInAABBox(box, triangleIndices);
+	const std::vector<CollisionTriangleShape> &triangles = heightfieldShape.findTrianglesInAABBox(box);
+
+	AssertHelper::assertUnsignedInt(triangleIndices.size(), triangles.size());
+	for(std::size_t i=0; i<triangleIndices.size(); ++i)
+	{
+		CollisionTriangleShape triangleShape = heightfieldShape.createTriangleShape(triangleIndices[i]);
+		const auto *triangle = dynamic_cast<const TriangleShape3D<float> *>(triangleShape.getSingleShape());
+		const auto *expectedTriangle = dynamic_cast<const TriangleShape3D<float> *>(triangles[i].getSingleShape());
+		for(unsigned int j=0; j<3; ++j)
+		{
+			AssertHelper::assertPoint3FloatEquals(triangle->getPoints()[j], expectedTriangle->getPoints()[j]);
+		}
+	}
+}
+
+namespace
+{
+	/**
+	 * Flat heightfield of 32x32 cells (from -16 to 16 on X and Z axis) having a bump of 2 units at (8.0, 8.0)
+	 */
+	std::unique_ptr<CollisionHeightfieldShape> buildBumpHeightfield()
+	{
+		std::vector<Point3<float>> vertices;
+		for(unsigned int z=0; z<33; ++z)
+		{
+			for(unsigned int x=0; x<33; ++x)
+			{
+				float height = (x==24 && z==24) ? 2.0f : 0.0f;
+				vertices.emplace_back(Point3<float>(static_cast<float>(x) - 16.0f, height, static_cast<float>(z) - 16.0f));
+			}
+		}
+		return std::make_unique<CollisionHeightfieldShape>(vertices, 33, 33);
+	}
+
+	float triangleMinX(const CollisionTriangleShape &triangleShape)
+	{
+		const Point3<float> *points = dynamic_cast<const TriangleShape3D<float> *>(triangleShape.getSingleShape())->getPoints();
+		return std::min(std::min(points[0].X, points[1].X), points[2].X);
+	}
+
+	float triangleMaxX(const CollisionTriangleShape &triangleShape)
+	{
+		const Point3<float> *points = dynamic_cast<const TriangleShape3D<float> *>(triangleShape.getSingleShape())->getPoints();
+		return std::max(std::max(points[0].X, points[1].X), points[2].X);
+	}
+}
+
+void HeightfieldShapeTest::cullFlatRegions()
+{
+	std::unique_ptr<CollisionHeightfieldShape> heightfieldShape = buildBumpHeightfield();
+
+	std::vector<std::size_t> triangleIndices;
+	heightfieldShape->findTriangleIndicesInAABBox(AABBox<float>(Point3<float>(-16.0, 1.0, -16.0), Point3<float>(16.0, 3.0, 16.0)), triangleIndices);
+
+	AssertHelper::assertUnsignedInt(triangleIndices.size(), 6); //triangles sharing the bump vertex
+	AssertHelper::assertTrue(std::is_sorted(triangleIndices.begin(), triangleIndices.end()));
+}
+
+void HeightfieldShapeTest::rayHitClosestTriangle()
+{
+	std::unique_ptr<CollisionHeightfieldShape> heightfieldShape = buildBumpHeightfield();
+
+	LineSegment3D<float> ray(Point3<float>(0.0, 1.0, 8.3), Point3<float>(16.0, 1.0, 8.3));
+	const std::vector<CollisionTriangleShape> &triangles = heightfieldShape->findTrianglesHitByRay(ray, true);
+
+	AssertHelper::assertUnsignedInt(triangles.size(), 1);
+	AssertHelper::assertTrue(triangleMinX(triangles[0]) >= 6.9f && triangleMaxX(triangles[0]) <= 8.1f, "Closest triangle must be on the bump front side");
+}
+
+void HeightfieldShapeTest::rayHitAllTriangles()
+{
+	std::unique_ptr<CollisionHeightfieldShape> heightfieldShape = buildBumpHeightfield();
+
+	LineSegment3D<float> verticalRay(Point3<float>(-3.3, 5.0, -2.2), Point3<float>(-3.3, -5.0, -2.2));
+	AssertHelper::assertUnsignedInt(heightfieldShape->findTrianglesHitByRay(verticalRay, false).size(), 1);
+
+	LineSegment3D<float> groundRay(Point3<float>(-20.0, 0.0, 0.5), Point3<float>(20.0, 0.0, 0.5));
+	const std::vector<CollisionTriangleShape> &triangles = heightfieldShape->findTrianglesHitByRay(groundRay, false);
+	AssertHelper::assertUnsignedInt(triangles.size(), 64); //ray lying on the ground: all triangles of the row are kept
+	AssertHelper::assertTrue(triangleMinX(triangles[0]) < triangleMinX(triangles[63]), "Triangles must be sorted along the ray");
+
+	LineSegment3D<float> skyRay(Point3<float>(-20.0, 3.0, 0.5), Point3<float>(20.0, 3.0, 8.0));
+	AssertHelper::assertUnsignedInt(heightfieldShape->findTrianglesHitByRay(skyRay, false).size(), 0);
+}
+
+CppUnit::Test *HeightfieldShapeTest::suite()
+{
+	auto *suite = new CppUnit::TestSuite("HeightfieldShapeTest");
+
+	suite->addTest(new CppUnit::TestCaller<HeightfieldShapeTest>("findTriangleIndices", &HeightfieldShapeTest::findTriangleIndices));
+	suite->addTest(new CppUnit::TestCaller<HeightfieldShapeTest>("cullFlatRegions", &HeightfieldShapeTest::cullFlatRegions));
+	suite->addTest(new CppUnit::TestCaller<HeightfieldShapeTest>("rayHitClosestTriangle", &HeightfieldShapeTest::rayHitClosestTriangle));
+	suite->addTest(new CppUnit::TestCaller<HeightfieldShapeTest>("rayHitAllTriangles", &HeightfieldShapeTest::rayHitAllTriangles));
+
+	return suite;
+}
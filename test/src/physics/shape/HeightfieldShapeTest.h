@@ -0,0 +1,18 @@
+#ifndef URCHINENGINE_HEIGHTFIELDSHAPETEST_H
+#define URCHINENGINE_HEIGHTFIELDSHAPETEST_H
+
+#include <cppunit/TestFixture.h>
+#include <cppunit/Test.h>
+
+class HeightfieldShapeTest : public CppUnit::TestFixture
+{
+	public:
+		static CppUnit::Test *suite();
+
+		void findTriangleIndices();
+		void cullFlatRegions();
+		void rayHitClosestTriangle();
+		void rayHitAllTriangles();
+};
+
+#endif
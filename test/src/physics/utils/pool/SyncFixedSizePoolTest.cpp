@@ -0,0 +1,118 @@
+#include <cppunit/TestSuite.h>
+#include <cppunit/TestCaller.h>
+#include <thread>
+#include <atomic>
+#include <vector>
+#include "UrchinPhysicsEngine.h"
+#include "utils/pool/SyncFixedSizePool.h"
+
+#include "AssertHelper.h"
+#include "physics/utils/pool/SyncFixedSizePoolTest.h"
+using namespace urchin;
+
+namespace
+{
+	class PoolElement
+	{
+		public:
+			explicit PoolElement(unsigned int value) : value(value) { }
+			virtual ~PoolElement() = default;
+
+			unsigned int value;
+	};
+
+	PoolElement *newElement(FixedSizePool<PoolElement> &pool, unsigned int value)
+	{
+		void *memPtr = pool.allocate(sizeof(PoolElement));
+		return new(memPtr) PoolElement(value);
+	}
+}
+
+void SyncFixedSizePoolTest::allocateAndFree()
+{
+	SyncFixedSizePool<PoolElement> pool("testPool", sizeof(PoolElement), 100);
+
+	std::vector<PoolElement *> elements;
+	for(unsigned int i=0; i<40; ++i)
+	{
+		elements.push_back(newElement(pool, i));
+	}
+	for(unsigned int i=0; i<40; ++i)
+	{
+		AssertHelper::assertUnsignedInt(elements[i]->value, i);
+		pool.free(elements[i]);
+	}
+
+	PoolStatistics statistics = pool.getStatistics();
+	AssertHelper::assertUnsignedInt(statistics.maxElements, 100);
+	AssertHelper::assertTrue(statistics.highWaterMark >= 40);
+	AssertHelper::assertUnsignedInt(statistics.overflowCount, 0);
+}
+
+void SyncFixedSizePoolTest::poolOverflow()
+{
+	SyncFixedSizePool<PoolElement> pool("testPool", sizeof(PoolElement), 10);
+
+	std::vector<PoolElement *> elements;
+	for(unsigned int i=0; i<15; ++i)
+	{
+		elements.push_back(newElement(pool, i));
+	}
+	for(auto element : elements)
+	{
+		pool.free(element);
+	}
+
+	PoolStatistics statistics = pool.getStatistics();
+	AssertHelper::assertUnsignedInt(statistics.highWaterMark, 10);
+	AssertHelper::assertUnsignedInt(statistics.overflowCount, 5);
+}
+
+void SyncFixedSizePoolTest::allocateFromSeveralThreads()
+{
+	SyncFixedSizePool<PoolElement> pool("testPool", sizeof(PoolElement), 1000);
+
+	std::vector<std::thread> threads;
+	std::atomic_uint threadsSucceed(0);
+	for(unsigned int threadIndex=0; threadIndex<4; ++threadIndex)
+	{
+		threads.emplace_back([&pool, &threadsSucceed, threadIndex]() {
+			bool succeed = true;
+			for(unsigned int loop=0; loop<100; ++loop)
+			{
+				std::vector<PoolElement *> elements;
+				for(unsigned int i=0; i<100; ++i)
+				{
+					elements.push_back(newElement(pool, threadIndex * 1000 + i));
+				}
+				for(unsigned int i=0; i<100; ++i)
+				{
+					succeed = succeed && elements[i]->value == threadIndex * 1000 + i;
+					pool.free(elements[i]);
+				}
+			}
+			if(succeed)
+			{
+				threadsSucceed.fetch_add(1);
+			}
+		});
+	}
+	for(auto &thread : threads)
+	{
+		thread.join();
+	}
+
+	AssertHelper::assertUnsignedInt(threadsSucceed.load(), 4);
+	AssertHelper::assertUnsignedInt(pool.getStatistics().overflowCount, 0);
+}
+
+CppUnit::Test *SyncFixedSizePoolTest::suite()
+{
+	auto *suite = new CppUnit::TestSuite("SyncFixedSizePoolTest");
+
+	suite->addTest(new CppUnit::TestCaller<SyncFixedSizePoolTest>("allocateAndFree", &SyncFixedSizePoolTest::allocateAndFree));
+	suite->addTest(new CppUnit::TestCaller<SyncFixedSizePoolTest>("poolOverflow", &SyncFixedSizePoolTest::poolOverflow));
+	suite->addTest(new CppUnit::TestCaller<SyncFixedSizePoolTest>("allocateFromSeveralThreads", &SyncFixedSizePoolTest::allocateFromSeveralThreads));
+
+	return suite;
+}
@@ -0,0 +1,17 @@
+#ifndef URCHINENGINE_SYNCFIXEDSIZEPOOLTEST_H
+#define URCHINENGINE_SYNCFIXEDSIZEPOOLTEST_H
+
+#include <cppunit/TestFixture.h>
+#include <cppunit/Test.h>
+
+class SyncFixedSizePoolTest : public CppUnit::TestFixture
+{
+	public:
+		static CppUnit::Test *suite();
+
+		void allocateAndFree();
+		void poolOverflow();
+		void allocateFromSeveralThreads();
+};
+
+#endif